@@ -22,6 +22,7 @@
 #ifndef SDL2PP_COLOR_HH
 #define SDL2PP_COLOR_HH
 
+#include <cstddef>
 #include <ostream>
 
 #include <SDL_pixels.h>
@@ -207,6 +208,101 @@ public:
 		a = na;
 		return *this;
 	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Interpolate between two arrays of colors
+	///
+	/// All four channels are interpolated with 8 bit fixed point
+	/// weight. Loop is branchless and works on bytes, so it is
+	/// vectorized by the compiler.
+	///
+	/// \param[in] from Colors at t = 0
+	/// \param[in] to Colors at t = 1
+	/// \param[out] out Array which receives interpolated colors,
+	///                 may be the same as from or to
+	/// \param[in] count Number of colors
+	/// \param[in] t Interpolation factor, clamped to [0, 1]
+	///
+	////////////////////////////////////////////////////////////
+	static void Lerp(const Color* from, const Color* to, Color* out, size_t count, float t);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Fill array with linear gradient
+	///
+	/// \param[out] colors Array to fill
+	/// \param[in] count Number of colors
+	/// \param[in] from Color of the first element
+	/// \param[in] to Color of the last element
+	///
+	////////////////////////////////////////////////////////////
+	static void FillGradient(Color* colors, size_t count, const Color& from, const Color& to);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Multiply color channels of array of colors by alpha
+	///
+	/// Uses the same rounding as Surface::PremultiplyAlpha()
+	///
+	/// \param[in,out] colors Array of colors
+	/// \param[in] count Number of colors
+	///
+	////////////////////////////////////////////////////////////
+	static void Premultiply(Color* colors, size_t count);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Apply gamma curve to color channels of array of colors
+	///
+	/// Each channel c is replaced with 255 * (c / 255) ^ gamma,
+	/// through a lookup table built once per call. Alpha is not
+	/// changed.
+	///
+	/// \param[in,out] colors Array of colors
+	/// \param[in] count Number of colors
+	/// \param[in] gamma Exponent
+	///
+	////////////////////////////////////////////////////////////
+	static void ApplyGamma(Color* colors, size_t count, float gamma);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Convert array of colors from sRGB to linear space
+	///
+	/// Alpha is not changed. Note that 8 bits are not enough to
+	/// represent dark linear values without banding.
+	///
+	/// \param[in,out] colors Array of colors
+	/// \param[in] count Number of colors
+	///
+	////////////////////////////////////////////////////////////
+	static void SRGBToLinear(Color* colors, size_t count);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Convert array of colors from linear to sRGB space
+	///
+	/// Inverse of SRGBToLinear(). Alpha is not changed.
+	///
+	/// \param[in,out] colors Array of colors
+	/// \param[in] count Number of colors
+	///
+	////////////////////////////////////////////////////////////
+	static void LinearToSRGB(Color* colors, size_t count);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Map array of colors to pixel values
+	///
+	/// Batch version of SDL_MapRGBA(). For formats without
+	/// palette, channel shifts are hoisted out of the loop,
+	/// which is then vectorized by the compiler; palettized
+	/// formats fall back to SDL_MapRGBA() per color.
+	///
+	/// \param[in] colors Array of colors
+	/// \param[in] count Number of colors
+	/// \param[in] format Target pixel format
+	/// \param[out] pixels Array of at least count elements which
+	///                    receives pixel values
+	///
+	/// \see http://wiki.libsdl.org/SDL_MapRGBA
+	///
+	////////////////////////////////////////////////////////////
+	static void MapRGBA(const Color* colors, size_t count, const SDL_PixelFormat& format, Uint32* pixels);
 };
 
 }
@@ -0,0 +1,167 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include <SDL_pixels.h>
+
+#include <SDL2pp/Color.hh>
+
+namespace SDL2pp {
+
+namespace {
+
+static_assert(sizeof(Color) == 4, "Color arrays are processed as plain bytes");
+
+struct ColorTable {
+	Uint8 value[256];
+};
+
+// Same rounding as in Surface::PremultiplyAlpha()
+inline Uint32 MulDiv255(Uint32 c, Uint32 a) {
+	Uint32 t = c * a + 128;
+	return (t + (t >> 8)) >> 8;
+}
+
+Uint8 ClampToByte(double v) {
+	return static_cast<Uint8>(std::min(std::max(v * 255.0 + 0.5, 0.0), 255.0));
+}
+
+ColorTable MakeGammaTable(double gamma) {
+	ColorTable table;
+	for (int i = 0; i < 256; i++)
+		table.value[i] = ClampToByte(std::pow(i / 255.0, gamma));
+	return table;
+}
+
+ColorTable MakeSRGBToLinearTable() {
+	ColorTable table;
+	for (int i = 0; i < 256; i++) {
+		double c = i / 255.0;
+		table.value[i] = ClampToByte(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+	}
+	return table;
+}
+
+ColorTable MakeLinearToSRGBTable() {
+	ColorTable table;
+	for (int i = 0; i < 256; i++) {
+		double c = i / 255.0;
+		table.value[i] = ClampToByte(c <= 0.0031308 ? c * 12.92 : 1.055 * std::pow(c, 1.0 / 2.4) - 0.055);
+	}
+	return table;
+}
+
+void ApplyTable(Color* colors, size_t count, const ColorTable& table) {
+	for (Color* color = colors; color != colors + count; ++color) {
+		color->r = table.value[color->r];
+		color->g = table.value[color->g];
+		color->b = table.value[color->b];
+	}
+}
+
+}
+
+void Color::Lerp(const Color* from, const Color* to, Color* out, size_t count, float t) {
+	const Uint32 w = static_cast<Uint32>(std::min(std::max(t, 0.0f), 1.0f) * 256.0f + 0.5f);
+	const Uint32 iw = 256 - w;
+
+	const Uint8* a = reinterpret_cast<const Uint8*>(from);
+	const Uint8* b = reinterpret_cast<const Uint8*>(to);
+	Uint8* o = reinterpret_cast<Uint8*>(out);
+
+	for (size_t i = 0; i < count * 4; i++)
+		o[i] = static_cast<Uint8>((a[i] * iw + b[i] * w + 128) >> 8);
+}
+
+void Color::FillGradient(Color* colors, size_t count, const Color& from, const Color& to) {
+	if (count == 0)
+		return;
+
+	if (count == 1) {
+		colors[0] = from;
+		return;
+	}
+
+	// 16.16 fixed point per channel steps, last element gets
+	// exactly the target color
+	const Sint32 steps = static_cast<Sint32>(count - 1);
+	const Sint32 dr = ((to.r - from.r) * 65536) / steps;
+	const Sint32 dg = ((to.g - from.g) * 65536) / steps;
+	const Sint32 db = ((to.b - from.b) * 65536) / steps;
+	const Sint32 da = ((to.a - from.a) * 65536) / steps;
+
+	for (size_t i = 0; i < count; i++) {
+		const Sint32 k = static_cast<Sint32>(i);
+		colors[i].r = static_cast<Uint8>((from.r * 65536 + dr * k + 32768) >> 16);
+		colors[i].g = static_cast<Uint8>((from.g * 65536 + dg * k + 32768) >> 16);
+		colors[i].b = static_cast<Uint8>((from.b * 65536 + db * k + 32768) >> 16);
+		colors[i].a = static_cast<Uint8>((from.a * 65536 + da * k + 32768) >> 16);
+	}
+
+	colors[count - 1] = to;
+}
+
+void Color::Premultiply(Color* colors, size_t count) {
+	for (Color* color = colors; color != colors + count; ++color) {
+		color->r = static_cast<Uint8>(MulDiv255(color->r, color->a));
+		color->g = static_cast<Uint8>(MulDiv255(color->g, color->a));
+		color->b = static_cast<Uint8>(MulDiv255(color->b, color->a));
+	}
+}
+
+void Color::ApplyGamma(Color* colors, size_t count, float gamma) {
+	ApplyTable(colors, count, MakeGammaTable(gamma));
+}
+
+void Color::SRGBToLinear(Color* colors, size_t count) {
+	static const ColorTable table = MakeSRGBToLinearTable();
+	ApplyTable(colors, count, table);
+}
+
+void Color::LinearToSRGB(Color* colors, size_t count) {
+	static const ColorTable table = MakeLinearToSRGBTable();
+	ApplyTable(colors, count, table);
+}
+
+void Color::MapRGBA(const Color* colors, size_t count, const SDL_PixelFormat& format, Uint32* pixels) {
+	if (format.palette != nullptr) {
+		for (size_t i = 0; i < count; i++)
+			pixels[i] = SDL_MapRGBA(&format, colors[i].r, colors[i].g, colors[i].b, colors[i].a);
+		return;
+	}
+
+	// same formula SDL_MapRGBA() uses for non-palettized formats
+	const Uint32 rloss = format.Rloss, gloss = format.Gloss, bloss = format.Bloss, aloss = format.Aloss;
+	const Uint32 rshift = format.Rshift, gshift = format.Gshift, bshift = format.Bshift, ashift = format.Ashift;
+	const Uint32 amask = format.Amask;
+
+	for (size_t i = 0; i < count; i++) {
+		pixels[i] =
+			(static_cast<Uint32>(colors[i].r) >> rloss) << rshift |
+			(static_cast<Uint32>(colors[i].g) >> gloss) << gshift |
+			(static_cast<Uint32>(colors[i].b) >> bloss) << bshift |
+			((static_cast<Uint32>(colors[i].a) >> aloss) << ashift & amask);
+	}
+}
+
+}
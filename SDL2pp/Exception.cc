@@ -25,22 +25,25 @@
 
 namespace SDL2pp {
 
-std::string Exception::make_what(const char* function, const char* sdl_error) {
-	std::string tmp(function);
-	tmp += " failed: ";
-	tmp += sdl_error;
-	return tmp;
-}
-
+// std::runtime_error message is unused as what() is overridden;
+// it's initialized with empty string, which does not allocate
+// with common standard library implementations
 Exception::Exception(const char* function)
-	: std::runtime_error(make_what(function, SDL_GetError())),
-	  sdl_function_(function),
-	  sdl_error_(SDL_GetError()) {
+	: std::runtime_error(""),
+	  sdl_function_(function) {
+	SDL_strlcpy(sdl_error_, SDL_GetError(), error_buffer_size);
+	what_[0] = '\0';
 }
 
 Exception::~Exception() noexcept {
 }
 
+const char* Exception::what() const noexcept {
+	if (what_[0] == '\0')
+		SDL_snprintf(what_, what_buffer_size, "%s failed: %s", sdl_function_, sdl_error_);
+	return what_;
+}
+
 std::string Exception::GetSDLFunction() const {
 	return sdl_function_;
 }
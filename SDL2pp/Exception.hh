@@ -22,6 +22,7 @@
 #ifndef SDL2PP_EXCEPTION_HH
 #define SDL2PP_EXCEPTION_HH
 
+#include <cstddef>
 #include <string>
 #include <stdexcept>
 
@@ -45,6 +46,12 @@ namespace SDL2pp {
 /// what() usually contains a name of SDL2 function which failed,
 /// e.g. "SDL_Init() failed"
 ///
+/// Throwing the exception does not allocate memory: function
+/// name is stored as a pointer (so it must be a string literal
+/// or otherwise outlive the exception), SDL error text is copied
+/// into a fixed size buffer (and truncated if it doesn't fit),
+/// and what() message is formatted on first access.
+///
 /// Note: this Exception object is used to report errors from
 /// SDL2 satellite libraries (SDL_image, SDL_mixer, SDL_ttf)
 /// as well. Though they use their own error handling functions
@@ -69,18 +76,21 @@ namespace SDL2pp {
 ///
 ////////////////////////////////////////////////////////////
 class SDL2PP_EXPORT Exception : public std::runtime_error {
-private:
-	std::string sdl_function_; ///< SDL function which caused an error
-	std::string sdl_error_;    ///< SDL error string
+public:
+	static constexpr size_t error_buffer_size = 256;                   ///< Size of stored SDL error, including terminating null
+	static constexpr size_t what_buffer_size = error_buffer_size + 64; ///< Size of what() message, including terminating null
 
 private:
-	static std::string make_what(const char* sdl_function, const char* sdl_error);
+	const char* sdl_function_;            ///< SDL function which caused an error
+	char sdl_error_[error_buffer_size];   ///< SDL error string
+	mutable char what_[what_buffer_size]; ///< what() message, empty until first access
 
 public:
 	////////////////////////////////////////////////////////////
 	/// \brief Construct exception, storing result of SDL_GetError()
 	///
-	/// \param[in] function Name of SDL function which generated an error
+	/// \param[in] function Name of SDL function which generated an error,
+	///                     must outlive the exception
 	///
 	////////////////////////////////////////////////////////////
 	explicit Exception(const char* function);
@@ -97,6 +107,14 @@ public:
 	////////////////////////////////////////////////////////////
 	virtual ~Exception() noexcept;
 
+	////////////////////////////////////////////////////////////
+	/// \brief Get explanatory string
+	///
+	/// \returns String in form "<function> failed: <SDL error>"
+	///
+	////////////////////////////////////////////////////////////
+	const char* what() const noexcept override;
+
 	////////////////////////////////////////////////////////////
 	/// \brief Get name of SDL function which caused an error
 	///
@@ -0,0 +1,67 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <cmath>
+
+#include <SDL2pp/FPoint.hh>
+
+#include <SDL2pp/FRect.hh>
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+
+namespace SDL2pp {
+
+FPoint FPoint::GetClamped(const FRect& rect) const {
+	FPoint p = *this;
+	p.Clamp(rect);
+	return p;
+}
+
+FPoint& FPoint::Clamp(const FRect& rect) {
+	if (x < rect.x)
+		x = rect.x;
+	if (x > rect.GetX2())
+		x = rect.GetX2();
+	if (y < rect.y)
+		y = rect.y;
+	if (y > rect.GetY2())
+		y = rect.GetY2();
+	return *this;
+}
+
+Point FPoint::GetRounded() const {
+	return Point(static_cast<int>(std::lround(x)), static_cast<int>(std::lround(y)));
+}
+
+}
+
+std::ostream& operator<<(std::ostream& stream, const SDL2pp::FPoint& point) {
+	stream << "[x:" << point.x << ",y:" << point.y << "]";
+	return stream;
+}
+
+bool operator<(const SDL2pp::FPoint& a, const SDL2pp::FPoint& b) {
+	if (a.x == b.x)
+		return a.y < b.y;
+	return a.x < b.x;
+}
+
+#endif
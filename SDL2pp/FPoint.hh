@@ -0,0 +1,451 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_FPOINT_HH
+#define SDL2PP_FPOINT_HH
+
+#include <iostream>
+#include <functional>
+
+#include <SDL_version.h>
+#include <SDL_rect.h>
+
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Export.hh>
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+
+namespace SDL2pp {
+
+class FRect;
+
+////////////////////////////////////////////////////////////
+/// \brief 2D point with floating point coordinates
+///
+/// \ingroup geometry
+///
+/// \headerfile SDL2pp/FPoint.hh
+///
+/// Floating point counterpart of Point, which allows subpixel
+/// positioning with Renderer methods which accept it. This
+/// class is public-derived from SDL_FPoint structure, may
+/// generally used as it if passed via pointer or reference.
+/// It also supports direct access to x and y members.
+///
+/// \see http://wiki.libsdl.org/SDL_FPoint
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT FPoint : public SDL_FPoint {
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Default constructor
+	///
+	/// Creates a FPoint(0, 0)
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint() : SDL_FPoint{0.0f, 0.0f} {
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct a point from existing SDL_FPoint
+	///
+	/// \param[in] point Existing SDL_FPoint
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint(const SDL_FPoint& point) : SDL_FPoint{point.x, point.y} {
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct the point from given coordinates
+	///
+	/// \param[in] x X coordinate
+	/// \param[in] y Y coordinate
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint(float x, float y) : SDL_FPoint{x, y} {
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct the point from integer point
+	///
+	/// \param[in] point Integer point
+	///
+	////////////////////////////////////////////////////////////
+	constexpr explicit FPoint(const Point& point) : SDL_FPoint{static_cast<float>(point.x), static_cast<float>(point.y)} {
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Copy constructor
+	///
+	////////////////////////////////////////////////////////////
+	FPoint(const FPoint&) noexcept = default;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Move constructor
+	///
+	////////////////////////////////////////////////////////////
+	FPoint(FPoint&&) noexcept = default;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Assignment operator
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FPoint& operator=(const FPoint&) noexcept = default;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Move assignment operator
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FPoint& operator=(FPoint&&) noexcept = default;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get X coordinate of the point
+	///
+	/// \returns X coordinate of the point
+	///
+	////////////////////////////////////////////////////////////
+	constexpr float GetX() const {
+		return x;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set X coordinate of the point
+	///
+	/// \param[in] nx New X coordinate value
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FPoint& SetX(float nx) {
+		x = nx;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get Y coordinate of the point
+	///
+	/// \returns Y coordinate of the point
+	///
+	////////////////////////////////////////////////////////////
+	constexpr float GetY() const {
+		return y;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set Y coordinate of the point
+	///
+	/// \param[in] ny New Y coordinate value
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FPoint& SetY(float ny) {
+		y = ny;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get point's memberwise negation
+	///
+	/// \returns New FPoint representing memberwise negation
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint operator-() const {
+		return FPoint(-x, -y);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get point's memberwise addition with another point
+	///
+	/// \param[in] other Point to add
+	///
+	/// \returns New FPoint representing memberwise addition with another point
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint operator+(const FPoint& other) const {
+		return FPoint(x + other.x, y + other.y);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get point's memberwise subtraction with another point
+	///
+	/// \param[in] other Point to subtract
+	///
+	/// \returns New FPoint representing memberwise subtraction of another point
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint operator-(const FPoint& other) const {
+		return FPoint(x - other.x, y - other.y);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get point's memberwise division by a number
+	///
+	/// \param[in] value Divisor
+	///
+	/// \returns New FPoint representing memberwise division of
+	///          point by a number
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint operator/(float value) const {
+		return FPoint(x / value, y / value);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get point's memberwise division by another point
+	///
+	/// \param[in] other Divisor
+	///
+	/// \returns New FPoint representing memberwise division of
+	///          point by another point
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint operator/(const FPoint& other) const {
+		return FPoint(x / other.x, y / other.y);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get point's memberwise multiplication by a number
+	///
+	/// \param[in] value Multiplier
+	///
+	/// \returns New FPoint representing memberwise multiplication
+	///          of point by a number
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint operator*(float value) const {
+		return FPoint(x * value, y * value);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get point's memberwise multiplication by another
+	///        point
+	///
+	/// \param[in] other Multiplier
+	///
+	/// \returns New FPoint representing memberwise multiplication
+	///          of point by another point
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint operator*(const FPoint& other) const {
+		return FPoint(x * other.x, y * other.y);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Memberwise add another point
+	///
+	/// \param[in] other Point to add to the current one
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FPoint& operator+=(const FPoint& other) {
+		x += other.x;
+		y += other.y;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Memberwise subtract another point
+	///
+	/// \param[in] other Point to subtract from the current one
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FPoint& operator-=(const FPoint& other) {
+		x -= other.x;
+		y -= other.y;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Memberwise divide by a number
+	///
+	/// \param[in] value Divisor
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FPoint& operator/=(float value) {
+		x /= value;
+		y /= value;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Memberwise divide by another point
+	///
+	/// \param[in] other Divisor
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FPoint& operator/=(const FPoint& other) {
+		x /= other.x;
+		y /= other.y;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Memberwise multiply by a number
+	///
+	/// \param[in] value Multiplier
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FPoint& operator*=(float value) {
+		x *= value;
+		y *= value;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Memberwise multiply by another point
+	///
+	/// \param[in] other Multiplier
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FPoint& operator*=(const FPoint& other) {
+		x *= other.x;
+		y *= other.y;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get a point with coordinates modified so it fits
+	///        into a given rect
+	///
+	/// \param[in] rect Rectangle to clamp with
+	///
+	/// \returns Clamped point
+	///
+	////////////////////////////////////////////////////////////
+	FPoint GetClamped(const FRect& rect) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Clamp point coordinates to make it fit into a
+	///        given rect
+	///
+	/// \param[in] rect Rectangle to clamp with
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FPoint& Clamp(const FRect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get integer point with rounded coordinates
+	///
+	/// \returns Point with coordinates rounded to nearest integers
+	///
+	////////////////////////////////////////////////////////////
+	Point GetRounded() const;
+};
+
+// arrays of FPoint are passed to SDL functions as arrays of SDL_FPoint
+static_assert(sizeof(FPoint) == sizeof(SDL_FPoint), "FPoint must be layout compatible with SDL_FPoint");
+
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Equality operator for SDL2pp::FPoint
+///
+/// \param[in] a First argument for comparison
+/// \param[in] b Second argument for comparison
+///
+/// \returns True if two points are identical
+///
+////////////////////////////////////////////////////////////
+constexpr bool operator==(const SDL2pp::FPoint& a, const SDL2pp::FPoint& b) {
+	return a.x == b.x && a.y == b.y;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inequality operator for SDL2pp::FPoint
+///
+/// \param[in] a First argument for comparison
+/// \param[in] b Second argument for comparison
+///
+/// \returns True if two points are not identical
+///
+////////////////////////////////////////////////////////////
+constexpr bool operator!=(const SDL2pp::FPoint& a, const SDL2pp::FPoint& b) {
+	return !(a == b);
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Less-than operator for SDL2pp::FPoint
+///
+/// \param[in] a First argument for comparison
+/// \param[in] b Second argument for comparison
+///
+/// \returns True if a < b
+///
+////////////////////////////////////////////////////////////
+SDL2PP_EXPORT bool operator<(const SDL2pp::FPoint& a, const SDL2pp::FPoint& b);
+
+////////////////////////////////////////////////////////////
+/// \brief Stream output operator overload for SDL2pp::FPoint
+///
+/// \param[in] stream Stream to output to
+/// \param[in] point Point to output
+///
+/// \returns stream
+///
+////////////////////////////////////////////////////////////
+SDL2PP_EXPORT std::ostream& operator<<(std::ostream& stream, const SDL2pp::FPoint& point);
+
+namespace std {
+
+////////////////////////////////////////////////////////////
+/// \brief std::hash specialization for SDL2pp::FPoint
+///
+////////////////////////////////////////////////////////////
+template<>
+struct hash<SDL2pp::FPoint> {
+	////////////////////////////////////////////////////////////
+	/// \brief Hash function for SDL2pp::FPoint
+	///
+	/// \param[in] p Input FPoint
+	///
+	/// \returns Hash value
+	///
+	////////////////////////////////////////////////////////////
+	size_t operator()(const SDL2pp::FPoint& p) const {
+		size_t seed = std::hash<float>()(p.x);
+		seed ^= std::hash<float>()(p.y) + 0x9e3779b9 + (seed<<6) + (seed>>2);
+		return seed;
+	}
+};
+
+}
+
+#endif
+
+#endif
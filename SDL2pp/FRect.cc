@@ -0,0 +1,105 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+#include <cmath>
+
+#include <SDL2pp/FRect.hh>
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+
+namespace SDL2pp {
+
+FRect FRect::GetUnion(const FRect& rect) const {
+	return FRect::FromCorners(
+			std::min(x, rect.x),
+			std::min(y, rect.y),
+			std::max(GetX2(), rect.GetX2()),
+			std::max(GetY2(), rect.GetY2())
+		);
+}
+
+FRect& FRect::Union(const FRect& rect) {
+	return *this = GetUnion(rect);
+}
+
+FRect FRect::GetExtension(float amount) const {
+	FRect r = *this;
+	r.Extend(amount);
+	return r;
+}
+
+FRect FRect::GetExtension(float hamount, float vamount) const {
+	FRect r = *this;
+	r.Extend(hamount, vamount);
+	return r;
+}
+
+FRect& FRect::Extend(float amount) {
+	return Extend(amount, amount);
+}
+
+FRect& FRect::Extend(float hamount, float vamount) {
+	x -= hamount;
+	y -= vamount;
+	w += hamount * 2.0f;
+	h += vamount * 2.0f;
+	return *this;
+}
+
+Optional<FRect> FRect::GetIntersection(const FRect& rect) const {
+	if (!Intersects(rect))
+		return NullOpt;
+
+	return FRect::FromCorners(
+			std::max(x, rect.x),
+			std::max(y, rect.y),
+			std::min(GetX2(), rect.GetX2()),
+			std::min(GetY2(), rect.GetY2())
+		);
+}
+
+Rect FRect::GetRounded() const {
+	const int x1 = static_cast<int>(std::lround(x));
+	const int y1 = static_cast<int>(std::lround(y));
+	return Rect(x1, y1, static_cast<int>(std::lround(GetX2())) - x1, static_cast<int>(std::lround(GetY2())) - y1);
+}
+
+}
+
+std::ostream& operator<<(std::ostream& stream, const SDL2pp::FRect& rect) {
+	stream << "[x:" << rect.x << ",y:" << rect.y << ",w:" << rect.w << ",h:" << rect.h << "]";
+	return stream;
+}
+
+bool operator<(const SDL2pp::FRect& a, const SDL2pp::FRect& b) {
+	if (a.x == b.x) {
+		if (a.y == b.y) {
+			if (a.w == b.w)
+				return a.h < b.h;
+			return a.w < b.w;
+		}
+		return a.y < b.y;
+	}
+	return a.x < b.x;
+}
+
+#endif
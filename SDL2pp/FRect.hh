@@ -0,0 +1,662 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_FRECT_HH
+#define SDL2PP_FRECT_HH
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+#include <SDL_version.h>
+#include <SDL_rect.h>
+
+#include <SDL2pp/Optional.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/FPoint.hh>
+#include <SDL2pp/Export.hh>
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+
+namespace SDL2pp {
+
+////////////////////////////////////////////////////////////
+/// \brief 2D rectangle with floating point coordinates
+///
+/// \ingroup geometry
+///
+/// \headerfile SDL2pp/FRect.hh
+///
+/// Floating point counterpart of Rect, which allows subpixel
+/// positioning and scaling with Renderer methods which accept
+/// it. This class is public-derived from SDL_FRect structure,
+/// may generally used as it if passed via pointer or
+/// reference. It also supports direct access to x, y, w
+/// and h members.
+///
+/// Unlike Rect, which describes a set of whole pixels, FRect
+/// is a continuous area: its right and bottom edges are at
+/// x + w and y + h, it contains points on its left and top
+/// edges but not on the right and bottom ones, and rectangles
+/// which only touch each other do not intersect.
+///
+/// \see http://wiki.libsdl.org/SDL_FRect
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT FRect : public SDL_FRect {
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Default constructor
+	///
+	/// Creates a FRect(0, 0, 0, 0)
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FRect() : SDL_FRect{0.0f, 0.0f, 0.0f, 0.0f} {
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct a rect from existing SDL_FRect
+	///
+	/// \param[in] rect Existing SDL_FRect
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FRect(const SDL_FRect& rect) : SDL_FRect{rect.x, rect.y, rect.w, rect.h} {
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct the rect from given corner coordinates, and size
+	///
+	/// \param[in] corner Coordinates of the top left rectangle corner
+	/// \param[in] size Dimensions of the rectangle
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FRect(const FPoint& corner, const FPoint& size) : SDL_FRect{corner.x, corner.y, size.x, size.y} {
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct the rect from given corner coordinates, width and height
+	///
+	/// \param[in] x X coordinate of the top left rectangle corner
+	/// \param[in] y Y coordinate of the top left rectangle corner
+	/// \param[in] w Width of the rectangle
+	/// \param[in] h Height of the rectangle
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FRect(float x, float y, float w, float h) : SDL_FRect{x, y, w, h} {
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct the rect from integer rect
+	///
+	/// \param[in] rect Integer rect
+	///
+	////////////////////////////////////////////////////////////
+	constexpr explicit FRect(const Rect& rect) : SDL_FRect{static_cast<float>(rect.x), static_cast<float>(rect.y), static_cast<float>(rect.w), static_cast<float>(rect.h)} {
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct the rect from given center coordinates, width and height
+	///
+	/// \param[in] cx X coordinate of the rectangle center
+	/// \param[in] cy Y coordinate of the rectangle center
+	/// \param[in] w Width of the rectangle
+	/// \param[in] h Height of the rectangle
+	///
+	////////////////////////////////////////////////////////////
+	static constexpr FRect FromCenter(float cx, float cy, float w, float h) {
+		return FRect(cx - w / 2.0f, cy - h / 2.0f, w, h);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct the rect from given center coordinates and size
+	///
+	/// \param[in] center Coordinates of the rectangle center
+	/// \param[in] size Dimensions of the rectangle
+	///
+	////////////////////////////////////////////////////////////
+	static constexpr FRect FromCenter(const FPoint& center, const FPoint& size) {
+		return FRect(center - size / 2.0f, size);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct the rect from given corners coordinates
+	///
+	/// \param[in] x1 X coordinate of the top left rectangle corner
+	/// \param[in] y1 Y coordinate of the top left rectangle corner
+	/// \param[in] x2 X coordinate of the bottom right rectangle corner
+	/// \param[in] y2 Y coordinate of the bottom right rectangle corner
+	///
+	////////////////////////////////////////////////////////////
+	static constexpr FRect FromCorners(float x1, float y1, float x2, float y2) {
+		return FRect(x1, y1, x2 - x1, y2 - y1);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct the rect from given corners coordinates
+	///
+	/// \param[in] p1 Coordinates of the top left rectangle corner
+	/// \param[in] p2 Coordinates of the bottom right rectangle corner
+	///
+	////////////////////////////////////////////////////////////
+	static constexpr FRect FromCorners(const FPoint& p1, const FPoint& p2) {
+		return FRect(p1, p2 - p1);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Copy constructor
+	///
+	////////////////////////////////////////////////////////////
+	FRect(const FRect&) noexcept = default;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Move constructor
+	///
+	////////////////////////////////////////////////////////////
+	FRect(FRect&&) noexcept = default;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Assignment operator
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FRect& operator=(const FRect&) noexcept = default;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Move assignment operator
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FRect& operator=(FRect&&) noexcept = default;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get X coordinate of the rect corner
+	///
+	/// \returns X coordinate of the rect corner
+	///
+	////////////////////////////////////////////////////////////
+	constexpr float GetX() const {
+		return x;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set X coordinate of the rect corner
+	///
+	/// \param[in] nx New X coordinate value
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FRect& SetX(float nx) {
+		x = nx;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get Y coordinate of the rect corner
+	///
+	/// \returns Y coordinate of the rect corner
+	///
+	////////////////////////////////////////////////////////////
+	constexpr float GetY() const {
+		return y;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set Y coordinate of the rect corner
+	///
+	/// \param[in] ny New Y coordinate value
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FRect& SetY(float ny) {
+		y = ny;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get width of the rect
+	///
+	/// \returns Width of the rect
+	///
+	////////////////////////////////////////////////////////////
+	constexpr float GetW() const {
+		return w;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set width of the rect
+	///
+	/// \param[in] nw New width of the rect
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FRect& SetW(float nw) {
+		w = nw;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get height of the rect
+	///
+	/// \returns Height of the rect
+	///
+	////////////////////////////////////////////////////////////
+	constexpr float GetH() const {
+		return h;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set height of the rect
+	///
+	/// \param[in] nh New height of the rect
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FRect& SetH(float nh) {
+		h = nh;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get X coordinate of the rect right edge
+	///
+	/// \returns X coordinate of the rect right edge
+	///
+	////////////////////////////////////////////////////////////
+	constexpr float GetX2() const {
+		return x + w;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set X coordinate of the rect right edge
+	///
+	/// \param[in] x2 New X coordinate value
+	///
+	/// This modifies rectangle width internally
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FRect& SetX2(float x2) {
+		w = x2 - x;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get Y coordinate of the rect bottom edge
+	///
+	/// \returns Y coordinate of the rect bottom edge
+	///
+	////////////////////////////////////////////////////////////
+	constexpr float GetY2() const {
+		return y + h;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set Y coordinate of the rect bottom edge
+	///
+	/// \param[in] y2 New Y coordinate value
+	///
+	/// This modifies rectangle height internally
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FRect& SetY2(float y2) {
+		h = y2 - y;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get top left corner of the rect
+	///
+	/// \returns Top left corner of the rect
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint GetTopLeft() const {
+		return FPoint(x, y);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get top right corner of the rect
+	///
+	/// \returns Top right corner of the rect
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint GetTopRight() const {
+		return FPoint(GetX2(), y);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get bottom left corner of the rect
+	///
+	/// \returns bottom left corner of the rect
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint GetBottomLeft() const {
+		return FPoint(x, GetY2());
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get bottom right corner of the rect
+	///
+	/// \returns Bottom right corner of the rect
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint GetBottomRight() const {
+		return FPoint(GetX2(), GetY2());
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get size of the rect
+	///
+	/// \returns Size of the rect
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint GetSize() const {
+		return FPoint(w, h);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get centroid of the rect
+	///
+	/// \returns Centroid of the rect
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FPoint GetCentroid() const {
+		return FPoint(x + w / 2.0f, y + h / 2.0f);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check whether the rect contains given point
+	///
+	/// \param[in] px X coordinate of a point
+	/// \param[in] py Y coordinate of a point
+	///
+	/// \returns True if the point is contained in the rect
+	///
+	////////////////////////////////////////////////////////////
+	constexpr bool Contains(float px, float py) const {
+		return px >= x && py >= y && px < GetX2() && py < GetY2();
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check whether the rect contains given point
+	///
+	/// \param[in] point Point to check
+	///
+	/// \returns True if the point is contained in the rect
+	///
+	////////////////////////////////////////////////////////////
+	constexpr bool Contains(const FPoint& point) const {
+		return Contains(point.x, point.y);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check whether the rect contains another rect
+	///
+	/// \param[in] rect Rect to check
+	///
+	/// \returns True if the checked rect is contained in this rect
+	///
+	////////////////////////////////////////////////////////////
+	constexpr bool Contains(const FRect& rect) const {
+		return rect.x >= x && rect.y >= y && rect.GetX2() <= GetX2() && rect.GetY2() <= GetY2();
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check whether the rect intersects another rect
+	///
+	/// Empty rectangles do not intersect anything
+	///
+	/// \param[in] rect Rect to check
+	///
+	/// \returns True if rectangles have common area
+	///
+	////////////////////////////////////////////////////////////
+	constexpr bool Intersects(const FRect& rect) const {
+		return std::max(x, rect.x) < std::min(GetX2(), rect.GetX2()) && std::max(y, rect.y) < std::min(GetY2(), rect.GetY2());
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Calculate union with another rect
+	///
+	/// \param[in] rect Rect to union with
+	///
+	/// \returns Rect representing union of two rectangles
+	///
+	////////////////////////////////////////////////////////////
+	FRect GetUnion(const FRect& rect) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Union rect with another rect
+	///
+	/// \param[in] rect Rect to union with
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FRect& Union(const FRect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get a rect extended by specified amount in all directions
+	///
+	/// \param[in] amount Amount to extend by
+	///
+	/// \returns Extended rect
+	///
+	////////////////////////////////////////////////////////////
+	FRect GetExtension(float amount) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get a rect extended by specified amounts in vertical and horizontal directions
+	///
+	/// \param[in] hamount Amount to extend by in horizontal direction
+	/// \param[in] vamount Amount to extend by in vertical direction
+	///
+	/// \returns Extended rect
+	///
+	////////////////////////////////////////////////////////////
+	FRect GetExtension(float hamount, float vamount) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Extend a rect by specified amount in all directions
+	///
+	/// \param[in] amount Amount to extend by
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FRect& Extend(float amount);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Extend a rect by specified amounts in vertical and horizontal directions
+	///
+	/// \param[in] hamount Amount to extend by in horizontal direction
+	/// \param[in] vamount Amount to extend by in vertical direction
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FRect& Extend(float hamount, float vamount);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Calculate intersection with another rect
+	///
+	/// \param[in] rect Rect to intersect with
+	///
+	/// \returns Rect representing intersection area or NullOpt if there was no intersection
+	///
+	////////////////////////////////////////////////////////////
+	Optional<FRect> GetIntersection(const FRect& rect) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get integer rect with rounded edges
+	///
+	/// Edges are rounded independently, so adjacent rectangles
+	/// produce adjacent integer rectangles without gaps
+	///
+	/// \returns Rect with edges rounded to nearest integers
+	///
+	////////////////////////////////////////////////////////////
+	Rect GetRounded() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get rectangle moved by a given offset
+	///
+	/// \param[in] offset Point specifying an offset
+	///
+	/// \returns Moved rectangle
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FRect operator+(const FPoint& offset) const {
+		return FRect(x + offset.x, y + offset.y, w, h);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get rectangle moved by an opposite of given offset
+	///
+	/// \param[in] offset Point specifying an offset
+	///
+	/// \returns Moved rectangle
+	///
+	////////////////////////////////////////////////////////////
+	constexpr FRect operator-(const FPoint& offset) const {
+		return FRect(x - offset.x, y - offset.y, w, h);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Move by then given offset
+	///
+	/// \param[in] offset Point specifying an offset
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FRect& operator+=(const FPoint& offset) {
+		x += offset.x;
+		y += offset.y;
+		return *this;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Move by an opposite of the given offset
+	///
+	/// \param[in] offset Point specifying an offset
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	FRect& operator-=(const FPoint& offset) {
+		x -= offset.x;
+		y -= offset.y;
+		return *this;
+	}
+};
+
+// arrays of FRect are passed to SDL functions as arrays of SDL_FRect
+static_assert(sizeof(FRect) == sizeof(SDL_FRect), "FRect must be layout compatible with SDL_FRect");
+
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Equality operator for SDL2pp::FRect
+///
+/// \param[in] a First argument for comparison
+/// \param[in] b Second argument for comparison
+///
+/// \returns True if two rectangles are identical
+///
+////////////////////////////////////////////////////////////
+constexpr bool operator==(const SDL2pp::FRect& a, const SDL2pp::FRect& b) {
+	return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inequality operator for SDL2pp::FRect
+///
+/// \param[in] a First argument for comparison
+/// \param[in] b Second argument for comparison
+///
+/// \returns True if two rectangles are not identical
+///
+////////////////////////////////////////////////////////////
+constexpr bool operator!=(const SDL2pp::FRect& a, const SDL2pp::FRect& b) {
+	return !(a == b);
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Less-than operator for SDL2pp::FRect
+///
+/// \param[in] a First argument for comparison
+/// \param[in] b Second argument for comparison
+///
+/// \returns True if a < b
+///
+////////////////////////////////////////////////////////////
+SDL2PP_EXPORT bool operator<(const SDL2pp::FRect& a, const SDL2pp::FRect& b);
+
+////////////////////////////////////////////////////////////
+/// \brief Stream output operator overload for SDL2pp::FRect
+///
+/// \param[in] stream Stream to output to
+/// \param[in] rect Rect to output
+///
+/// \returns stream
+///
+////////////////////////////////////////////////////////////
+SDL2PP_EXPORT std::ostream& operator<<(std::ostream& stream, const SDL2pp::FRect& rect);
+
+namespace std {
+
+////////////////////////////////////////////////////////////
+/// \brief std::hash specialization for SDL2pp::FRect
+///
+////////////////////////////////////////////////////////////
+template<>
+struct hash<SDL2pp::FRect> {
+	////////////////////////////////////////////////////////////
+	/// \brief Hash function for SDL2pp::FRect
+	///
+	/// \param[in] r Input FRect
+	///
+	/// \returns Hash value
+	///
+	////////////////////////////////////////////////////////////
+	size_t operator()(const SDL2pp::FRect& r) const {
+		size_t seed = std::hash<float>()(r.x);
+		seed ^= std::hash<float>()(r.y) + 0x9e3779b9 + (seed<<6) + (seed>>2);
+		seed ^= std::hash<float>()(r.w) + 0x9e3779b9 + (seed<<6) + (seed>>2);
+		seed ^= std::hash<float>()(r.h) + 0x9e3779b9 + (seed<<6) + (seed>>2);
+		return seed;
+	}
+};
+
+}
+
+#endif
+
+#endif
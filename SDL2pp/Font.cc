@@ -19,7 +19,11 @@
   3. This notice may not be removed or altered from any source distribution.
 */
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <SDL_ttf.h>
@@ -27,9 +31,209 @@
 #include <SDL2pp/Font.hh>
 #include <SDL2pp/RWops.hh>
 #include <SDL2pp/Exception.hh>
+#include <SDL2pp/Profiler.hh>
+#include <SDL2pp/private/UTF8.hh>
 
 namespace SDL2pp {
 
+namespace {
+
+// Decoders of supported text encodings; each returns next code
+// point and advances the pointer, or returns 0 at the end. UTF-8
+// one is shared with TextLayout
+using Private::NextUTF8;
+
+Uint32 NextLatin1(const char*& text, const char* end) {
+	return text == end ? 0 : static_cast<Uint8>(*text++);
+}
+
+Uint32 NextUCS2(const Uint16*& text, const Uint16* end) {
+	return text == end ? 0 : *text++;
+}
+
+// Kerning between two code points, regardless of whether kerning
+// is enabled for the font
+int GetKerningSize(TTF_Font* font, Uint32 prev, Uint32 ch) {
+#if SDL_TTF_VERSION_ATLEAST(2, 0, 18)
+	return TTF_GetFontKerningSizeGlyphs32(font, prev, ch);
+#elif SDL_TTF_VERSION_ATLEAST(2, 0, 14)
+	return (prev <= 0xffff && ch <= 0xffff) ? TTF_GetFontKerningSizeGlyphs(font, static_cast<Uint16>(prev), static_cast<Uint16>(ch)) : 0;
+#else
+	(void)font, (void)prev, (void)ch;
+	return 0;
+#endif
+}
+
+}
+
+// Glyph metrics and availability queried from SDL_ttf; Latin-1
+// chars which make up most of the text are kept in a flat table
+struct Font::MetricsTable {
+	struct Entry {
+		int minx, maxx, miny, maxy, advance;
+		int index;        ///< Glyph index, if has_index is set
+		bool has_metrics; ///< Whether metrics are filled
+		bool has_index;   ///< Whether glyph index is filled
+	};
+
+	std::array<Entry, 256> latin1{};
+	std::unordered_map<Uint32, Entry> other;
+
+	Entry& GetEntry(Uint32 ch) {
+		return ch < latin1.size() ? latin1[ch] : other[ch];
+	}
+
+	// failures are not cached, so the error is reported with
+	// the actual SDL_ttf message on each call
+	const Entry* FindMetrics(TTF_Font* font, Uint32 ch) {
+		Entry& entry = GetEntry(ch);
+		if (!entry.has_metrics) {
+#if SDL_TTF_VERSION_ATLEAST(2, 0, 18)
+			if (TTF_GlyphMetrics32(font, ch, &entry.minx, &entry.maxx, &entry.miny, &entry.maxy, &entry.advance) != 0)
+				return nullptr;
+#else
+			if (ch > 0xffff || TTF_GlyphMetrics(font, static_cast<Uint16>(ch), &entry.minx, &entry.maxx, &entry.miny, &entry.maxy, &entry.advance) != 0)
+				return nullptr;
+#endif
+			entry.has_metrics = true;
+		}
+		return &entry;
+	}
+
+	const Entry& GetMetrics(TTF_Font* font, Uint16 ch) {
+		const Entry* entry = FindMetrics(font, ch);
+		if (entry == nullptr)
+			throw Exception("TTF_GlyphMetrics");
+		return *entry;
+	}
+
+	int GetIndex(TTF_Font* font, Uint16 ch) {
+		Entry& entry = GetEntry(ch);
+		if (!entry.has_index) {
+			entry.index = TTF_GlyphIsProvided(font, ch);
+			entry.has_index = true;
+		}
+		return entry.index;
+	}
+};
+
+// Coverage masks of glyphs rendered with SDL_ttf, taken from
+// alpha channel of white blended glyph surfaces. Placement of
+// glyphs comes from the metrics table of the font
+//
+// Number of cached masks is limited: text in scripts with large
+// character sets would otherwise keep a mask for every glyph ever
+// drawn. When the limit is reached, the cache is dropped and
+// refilled with glyphs in use
+struct Font::GlyphCache {
+	static constexpr size_t max_glyphs = 1024;
+
+	struct Glyph {
+		std::vector<Uint8> mask; ///< Coverage values, width by height
+		int width;               ///< Width of the mask
+		int height;              ///< Height of the mask
+		int origin;              ///< X coordinate of pen position in the mask
+	};
+
+	std::unordered_map<Uint32, Glyph> glyphs;
+
+	const Glyph& GetGlyph(TTF_Font* font, Uint32 ch, const MetricsTable::Entry* metrics) {
+		auto found = glyphs.find(ch);
+		if (found != glyphs.end())
+			return found->second;
+
+		if (glyphs.size() >= max_glyphs)
+			glyphs.clear();
+
+		Glyph glyph = { {}, 0, 0, 0 };
+
+#if SDL_TTF_VERSION_ATLEAST(2, 0, 18)
+		SDL_Surface* rendered = TTF_RenderGlyph32_Blended(font, ch, SDL_Color{255, 255, 255, 255});
+#else
+		SDL_Surface* rendered = ch <= 0xffff ? TTF_RenderGlyph_Blended(font, static_cast<Uint16>(ch), SDL_Color{255, 255, 255, 255}) : nullptr;
+#endif
+
+		// SDL_ttf fails to render zero width glyphs, these are
+		// kept with empty mask
+		if (rendered != nullptr) {
+			Surface surface(rendered);
+			Surface::LockHandle lock = surface.Lock();
+
+			glyph.width = surface.GetWidth();
+			glyph.height = surface.GetHeight();
+			glyph.origin = metrics != nullptr ? std::max(-metrics->minx, 0) : 0;
+			glyph.mask.resize(static_cast<size_t>(glyph.width) * glyph.height);
+
+			// blended glyphs are always ARGB8888
+			for (int y = 0; y < glyph.height; y++) {
+				const Uint32* row = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(lock.GetPixels()) + y * lock.GetPitch());
+				Uint8* mask = glyph.mask.data() + static_cast<size_t>(y) * glyph.width;
+				for (int x = 0; x < glyph.width; x++)
+					mask[x] = static_cast<Uint8>(row[x] >> 24);
+			}
+		}
+
+		return glyphs.emplace(ch, std::move(glyph)).first->second;
+	}
+
+	// Calls func(glyph, x) for each glyph of the text, where x is
+	// the left edge of glyph mask relative to the start of the line
+	template <class Next, class F>
+	void Layout(TTF_Font* font, MetricsTable& table, Next&& next, F&& func) {
+		const bool kerning = TTF_GetFontKerning(font) != 0;
+
+		int pen = 0;
+		Uint32 prev = 0;
+		for (Uint32 ch = next(); ch != 0; prev = ch, ch = next()) {
+			if (kerning && prev != 0)
+				pen += GetKerningSize(font, prev, ch);
+
+			// glyphs without metrics advance by width of the mask
+			const MetricsTable::Entry* metrics = table.FindMetrics(font, ch);
+			const Glyph& glyph = GetGlyph(font, ch, metrics);
+			func(glyph, pen - glyph.origin);
+			pen += metrics != nullptr ? metrics->advance : glyph.width;
+		}
+	}
+
+	template <class Next>
+	Rect Render(TTF_Font* font, MetricsTable& table, Next&& next, SDL_Color fg, Surface& dst, const Point& position) {
+		SDL2PP_PROFILE_SCOPE(FontRender);
+
+		int left = 0, right = 0;
+		bool empty = true;
+
+		Layout(font, table, next, [&](const Glyph& glyph, int x) {
+				if (glyph.width == 0)
+					return;
+
+				dst.BlendMask(Rect(position.x + x, position.y, glyph.width, glyph.height), glyph.mask.data(), glyph.width, fg);
+
+				left = empty ? x : std::min(left, x);
+				right = empty ? x + glyph.width : std::max(right, x + glyph.width);
+				empty = false;
+			});
+
+		if (empty)
+			return Rect(position, Point(0, 0));
+
+		const Optional<Rect> touched = Rect(position.x + left, position.y, right - left, TTF_FontHeight(font)).GetIntersection(Rect(dst.Get()->clip_rect));
+		return touched ? *touched : Rect(position, Point(0, 0));
+	}
+};
+
+Font::GlyphCache& Font::GetGlyphCache() {
+	if (!glyphs_)
+		glyphs_.reset(new GlyphCache);
+	return *glyphs_;
+}
+
+Font::MetricsTable& Font::GetMetricsTable() const {
+	if (!metrics_)
+		metrics_.reset(new MetricsTable);
+	return *metrics_;
+}
+
 Font::Font(TTF_Font* font) : font_(font) {
 	assert(font);
 }
@@ -49,7 +253,7 @@ Font::~Font() {
 		TTF_CloseFont(font_);
 }
 
-Font::Font(Font&& other) noexcept : font_(other.font_) {
+Font::Font(Font&& other) noexcept : font_(other.font_), glyphs_(std::move(other.glyphs_)), metrics_(std::move(other.metrics_)) {
 	other.font_ = nullptr;
 }
 
@@ -59,6 +263,8 @@ Font& Font::operator=(Font&& other) noexcept {
 	if (font_ != nullptr)
 		TTF_CloseFont(font_);
 	font_ = other.font_;
+	glyphs_ = std::move(other.glyphs_);
+	metrics_ = std::move(other.metrics_);
 	other.font_ = nullptr;
 	return *this;
 }
@@ -73,6 +279,8 @@ int Font::GetStyle() const {
 
 Font& Font::SetStyle(int style) {
 	TTF_SetFontStyle(font_, style);
+	glyphs_.reset();
+	metrics_.reset();
 	return *this;
 }
 
@@ -82,6 +290,8 @@ int Font::GetOutline() const {
 
 Font& Font::SetOutline(int outline) {
 	TTF_SetFontOutline(font_, outline);
+	glyphs_.reset();
+	metrics_.reset();
 	return *this;
 }
 
@@ -91,6 +301,8 @@ int Font::GetHinting() const {
 
 Font& Font::SetHinting(int hinting) {
 	TTF_SetFontHinting(font_, hinting);
+	glyphs_.reset();
+	metrics_.reset();
 	return *this;
 }
 
@@ -142,26 +354,38 @@ Optional<std::string> Font::GetStyleName() const {
 }
 
 int Font::IsGlyphProvided(Uint16 ch) const {
-	return TTF_GlyphIsProvided(font_, ch);
+	return GetMetricsTable().GetIndex(font_, ch);
 }
 
 void Font::GetGlyphMetrics(Uint16 ch, int& minx, int& maxx, int& miny, int& maxy, int& advance) const {
-	if (TTF_GlyphMetrics(font_, ch, &minx, &maxx, &miny, &maxy, &advance) != 0)
-		throw Exception("TTF_GlyphMetrics");
+	const MetricsTable::Entry& metrics = GetMetricsTable().GetMetrics(font_, ch);
+	minx = metrics.minx;
+	maxx = metrics.maxx;
+	miny = metrics.miny;
+	maxy = metrics.maxy;
+	advance = metrics.advance;
 }
 
 Rect Font::GetGlyphRect(Uint16 ch) const {
-	int minx, maxx, miny, maxy;
-	if (TTF_GlyphMetrics(font_, ch, &minx, &maxx, &miny, &maxy, nullptr) != 0)
-		throw Exception("TTF_GlyphMetrics");
-	return Rect(minx, miny, maxx - minx, maxy - miny);
+	const MetricsTable::Entry& metrics = GetMetricsTable().GetMetrics(font_, ch);
+	return Rect(metrics.minx, metrics.miny, metrics.maxx - metrics.minx, metrics.maxy - metrics.miny);
 }
 
 int Font::GetGlyphAdvance(Uint16 ch) const {
-	int advance;
-	if (TTF_GlyphMetrics(font_, ch, nullptr, nullptr, nullptr, nullptr, &advance) != 0)
-		throw Exception("TTF_GlyphMetrics");
-	return advance;
+	return GetMetricsTable().GetMetrics(font_, ch).advance;
+}
+
+int Font::GetGlyphKerning(Uint16 prev, Uint16 ch) const {
+	return GetKerningSize(font_, prev, ch);
+}
+
+Font& Font::PreloadGlyphMetrics(Uint16 first, Uint16 last) {
+	MetricsTable& table = GetMetricsTable();
+	for (Uint32 ch = first; ch <= last; ch++) {
+		table.GetMetrics(font_, static_cast<Uint16>(ch));
+		table.GetIndex(font_, static_cast<Uint16>(ch));
+	}
+	return *this;
 }
 
 Point Font::GetSizeText(const std::string& text) const {
@@ -192,6 +416,8 @@ Point Font::GetSizeUNICODE(const std::u16string& text) const {
 }
 
 Surface Font::RenderText_Solid(const std::string& text, SDL_Color fg) {
+	SDL2PP_PROFILE_SCOPE(FontRender);
+
 	SDL_Surface* surface = TTF_RenderText_Solid(font_, text.c_str(), fg);
 	if (surface == nullptr)
 		throw Exception("TTF_RenderText_Solid");
@@ -199,6 +425,8 @@ Surface Font::RenderText_Solid(const std::string& text, SDL_Color fg) {
 }
 
 Surface Font::RenderUTF8_Solid(const std::string& text, SDL_Color fg) {
+	SDL2PP_PROFILE_SCOPE(FontRender);
+
 	SDL_Surface* surface = TTF_RenderUTF8_Solid(font_, text.c_str(), fg);
 	if (surface == nullptr)
 		throw Exception("TTF_RenderUTF8_Solid");
@@ -206,6 +434,8 @@ Surface Font::RenderUTF8_Solid(const std::string& text, SDL_Color fg) {
 }
 
 Surface Font::RenderUNICODE_Solid(const Uint16* text, SDL_Color fg) {
+	SDL2PP_PROFILE_SCOPE(FontRender);
+
 	SDL_Surface* surface = TTF_RenderUNICODE_Solid(font_, text, fg);
 	if (surface == nullptr)
 		throw Exception("TTF_RenderUNICODE_Solid");
@@ -219,6 +449,8 @@ Surface Font::RenderUNICODE_Solid(const std::u16string& text, SDL_Color fg) {
 }
 
 Surface Font::RenderGlyph_Solid(Uint16 ch, SDL_Color fg) {
+	SDL2PP_PROFILE_SCOPE(FontRender);
+
 	SDL_Surface* surface = TTF_RenderGlyph_Solid(font_, ch, fg);
 	if (surface == nullptr)
 		throw Exception("TTF_RenderGlyph_Solid");
@@ -226,6 +458,8 @@ Surface Font::RenderGlyph_Solid(Uint16 ch, SDL_Color fg) {
 }
 
 Surface Font::RenderText_Shaded(const std::string& text, SDL_Color fg, SDL_Color bg) {
+	SDL2PP_PROFILE_SCOPE(FontRender);
+
 	SDL_Surface* surface = TTF_RenderText_Shaded(font_, text.c_str(), fg, bg);
 	if (surface == nullptr)
 		throw Exception("TTF_RenderText_Shaded");
@@ -233,6 +467,8 @@ Surface Font::RenderText_Shaded(const std::string& text, SDL_Color fg, SDL_Color
 }
 
 Surface Font::RenderUTF8_Shaded(const std::string& text, SDL_Color fg, SDL_Color bg) {
+	SDL2PP_PROFILE_SCOPE(FontRender);
+
 	SDL_Surface* surface = TTF_RenderUTF8_Shaded(font_, text.c_str(), fg, bg);
 	if (surface == nullptr)
 		throw Exception("TTF_RenderUTF8_Shaded");
@@ -240,6 +476,8 @@ Surface Font::RenderUTF8_Shaded(const std::string& text, SDL_Color fg, SDL_Color
 }
 
 Surface Font::RenderUNICODE_Shaded(const Uint16* text, SDL_Color fg, SDL_Color bg) {
+	SDL2PP_PROFILE_SCOPE(FontRender);
+
 	SDL_Surface* surface = TTF_RenderUNICODE_Shaded(font_, text, fg, bg);
 	if (surface == nullptr)
 		throw Exception("TTF_RenderUNICODE_Shaded");
@@ -253,6 +491,8 @@ Surface Font::RenderUNICODE_Shaded(const std::u16string& text, SDL_Color fg, SDL
 }
 
 Surface Font::RenderGlyph_Shaded(Uint16 ch, SDL_Color fg, SDL_Color bg) {
+	SDL2PP_PROFILE_SCOPE(FontRender);
+
 	SDL_Surface* surface = TTF_RenderGlyph_Shaded(font_, ch, fg, bg);
 	if (surface == nullptr)
 		throw Exception("TTF_RenderGlyph_Shaded");
@@ -260,6 +500,8 @@ Surface Font::RenderGlyph_Shaded(Uint16 ch, SDL_Color fg, SDL_Color bg) {
 }
 
 Surface Font::RenderText_Blended(const std::string& text, SDL_Color fg) {
+	SDL2PP_PROFILE_SCOPE(FontRender);
+
 	SDL_Surface* surface = TTF_RenderText_Blended(font_, text.c_str(), fg);
 	if (surface == nullptr)
 		throw Exception("TTF_RenderText_Blended");
@@ -267,6 +509,8 @@ Surface Font::RenderText_Blended(const std::string& text, SDL_Color fg) {
 }
 
 Surface Font::RenderUTF8_Blended(const std::string& text, SDL_Color fg) {
+	SDL2PP_PROFILE_SCOPE(FontRender);
+
 	SDL_Surface* surface = TTF_RenderUTF8_Blended(font_, text.c_str(), fg);
 	if (surface == nullptr)
 		throw Exception("TTF_RenderUTF8_Blended");
@@ -274,6 +518,8 @@ Surface Font::RenderUTF8_Blended(const std::string& text, SDL_Color fg) {
 }
 
 Surface Font::RenderUNICODE_Blended(const Uint16* text, SDL_Color fg) {
+	SDL2PP_PROFILE_SCOPE(FontRender);
+
 	SDL_Surface* surface = TTF_RenderUNICODE_Blended(font_, text, fg);
 	if (surface == nullptr)
 		throw Exception("TTF_RenderUNICODE_Blended");
@@ -287,10 +533,68 @@ Surface Font::RenderUNICODE_Blended(const std::u16string& text, SDL_Color fg) {
 }
 
 Surface Font::RenderGlyph_Blended(Uint16 ch, SDL_Color fg) {
+	SDL2PP_PROFILE_SCOPE(FontRender);
+
 	SDL_Surface* surface = TTF_RenderGlyph_Blended(font_, ch, fg);
 	if (surface == nullptr)
 		throw Exception("TTF_RenderGlyph_Blended");
 	return Surface(surface);
 }
 
+Rect Font::RenderText_Blended(const std::string& text, SDL_Color fg, Surface& dst, const Point& position) {
+	const char* current = text.data();
+	const char* end = text.data() + text.size();
+	return GetGlyphCache().Render(font_, GetMetricsTable(), [&]() { return NextLatin1(current, end); }, fg, dst, position);
+}
+
+Rect Font::RenderUTF8_Blended(const std::string& text, SDL_Color fg, Surface& dst, const Point& position) {
+	const char* current = text.data();
+	const char* end = text.data() + text.size();
+	return GetGlyphCache().Render(font_, GetMetricsTable(), [&]() { return NextUTF8(current, end); }, fg, dst, position);
+}
+
+Rect Font::RenderUNICODE_Blended(const Uint16* text, SDL_Color fg, Surface& dst, const Point& position) {
+	const Uint16* end = text;
+	while (*end != 0)
+		++end;
+	return GetGlyphCache().Render(font_, GetMetricsTable(), [&]() { return NextUCS2(text, end); }, fg, dst, position);
+}
+
+Rect Font::RenderUNICODE_Blended(const std::u16string& text, SDL_Color fg, Surface& dst, const Point& position) {
+	const Uint16* current = reinterpret_cast<const Uint16*>(text.data());
+	const Uint16* end = current + text.size();
+	return GetGlyphCache().Render(font_, GetMetricsTable(), [&]() { return NextUCS2(current, end); }, fg, dst, position);
+}
+
+Rect Font::RenderGlyph_Blended(Uint16 ch, SDL_Color fg, Surface& dst, const Point& position) {
+	const Uint16* current = &ch;
+	return GetGlyphCache().Render(font_, GetMetricsTable(), [&]() { return NextUCS2(current, &ch + 1); }, fg, dst, position);
+}
+
+SurfacePool::Lease Font::RenderUTF8_Blended(const std::string& text, SDL_Color fg, SurfacePool& pool) {
+	GlyphCache& cache = GetGlyphCache();
+
+	// measure first, to know the size of the surface
+	const char* current = text.data();
+	const char* end = text.data() + text.size();
+
+	int left = 0, right = 0;
+	cache.Layout(font_, GetMetricsTable(), [&]() { return NextUTF8(current, end); }, [&](const GlyphCache::Glyph& glyph, int x) {
+			left = std::min(left, x);
+			right = std::max(right, x + glyph.width);
+		});
+
+	SurfacePool::Lease lease = pool.Acquire(SDL_PIXELFORMAT_ARGB8888, std::max(right - left, 1), TTF_FontHeight(font_));
+	Surface& surface = lease.GetSurface();
+
+	// transparent pixels have text color, so blending does not
+	// darken edges of glyphs
+	surface.SetClipRect();
+	surface.FillRect(NullOpt, SDL_MapRGBA(surface.Get()->format, fg.r, fg.g, fg.b, 0));
+
+	RenderUTF8_Blended(text, fg, surface, Point(-left, 0));
+
+	return lease;
+}
+
 }
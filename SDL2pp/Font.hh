@@ -22,13 +22,16 @@
 #ifndef SDL2PP_FONT_HH
 #define SDL2PP_FONT_HH
 
+#include <memory>
 #include <string>
 
 #include <SDL_ttf.h>
 
 #include <SDL2pp/Optional.hh>
 #include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
 #include <SDL2pp/Surface.hh>
+#include <SDL2pp/SurfacePool.hh>
 #include <SDL2pp/Export.hh>
 
 namespace SDL2pp {
@@ -47,7 +50,29 @@ class RWops;
 ////////////////////////////////////////////////////////////
 class SDL2PP_EXPORT Font {
 private:
-	TTF_Font* font_; ///< Managed TTF_Font object
+	struct GlyphCache;
+	struct MetricsTable;
+
+	TTF_Font* font_;                               ///< Managed TTF_Font object
+	std::unique_ptr<GlyphCache> glyphs_;           ///< Cache of rendered glyphs, created on first use
+	mutable std::unique_ptr<MetricsTable> metrics_; ///< Cache of glyph metrics, created on first use
+
+private:
+	////////////////////////////////////////////////////////////
+	/// \brief Get glyph cache, creating it if needed
+	///
+	/// \returns Reference to glyph cache
+	///
+	////////////////////////////////////////////////////////////
+	GlyphCache& GetGlyphCache();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get glyph metrics table, creating it if needed
+	///
+	/// \returns Reference to glyph metrics table
+	///
+	////////////////////////////////////////////////////////////
+	MetricsTable& GetMetricsTable() const;
 
 public:
 
@@ -195,6 +220,9 @@ public:
 	/// In this case, you should probably turn off these styles and draw your
 	/// own strikethroughs and underlines.
 	///
+	/// \note This also flushes glyphs cached for rendering into
+	/// existing surfaces, and cached glyph metrics
+	///
 	/// \returns Reference to self
 	///
 	/// \see https://www.libsdl.org/projects/SDL_ttf/docs/SDL_ttf.html#SEC22
@@ -220,7 +248,9 @@ public:
 	///
 	/// \note This will flush the internal cache of previously rendered
 	/// glyphs, even if there is no change in outline size, so it may be best
-	/// to check the current outline size by using GetOutline() first
+	/// to check the current outline size by using GetOutline() first. This
+	/// also applies to glyphs cached for rendering into existing surfaces
+	/// and to cached glyph metrics
 	///
 	/// \returns Reference to self
 	///
@@ -260,7 +290,9 @@ public:
 	///
 	/// \note This will flush the internal cache of previously rendered
 	/// glyphs, even if there is no change in hinting, so it may be best
-	/// to check the current hinting by using GetHinting() first
+	/// to check the current hinting by using GetHinting() first. This
+	/// also applies to glyphs cached for rendering into existing surfaces
+	/// and to cached glyph metrics
 	///
 	/// \returns Reference to self
 	///
@@ -449,6 +481,8 @@ public:
 	///
 	/// \returns The index of the glyph for ch in font, or 0 for an undefined character code
 	///
+	/// Result is cached in the font, see PreloadGlyphMetrics()
+	///
 	/// \see https://www.libsdl.org/projects/SDL_ttf/docs/SDL_ttf.html#SEC37
 	///
 	////////////////////////////////////////////////////////////
@@ -464,6 +498,8 @@ public:
 	/// \param[out] maxy Variable to store the returned maximum Y offset into
 	/// \param[out] advance Variable to store the returned advance offset into
 	///
+	/// Metrics are cached in the font, see PreloadGlyphMetrics()
+	///
 	/// \throws SDL2pp::Exception
 	///
 	/// \see https://www.libsdl.org/projects/SDL_ttf/docs/SDL_ttf.html#SEC38
@@ -479,6 +515,8 @@ public:
 	///
 	/// \returns Rect representing glyph offset info
 	///
+	/// Metrics are cached in the font, see PreloadGlyphMetrics()
+	///
 	/// \throws SDL2pp::Exception
 	///
 	/// \see https://www.libsdl.org/projects/SDL_ttf/docs/SDL_ttf.html#SEC38
@@ -494,6 +532,8 @@ public:
 	///
 	/// \returns Advance offset into
 	///
+	/// Metrics are cached in the font, see PreloadGlyphMetrics()
+	///
 	/// \throws SDL2pp::Exception
 	///
 	/// \see https://www.libsdl.org/projects/SDL_ttf/docs/SDL_ttf.html#SEC38
@@ -502,6 +542,45 @@ public:
 	////////////////////////////////////////////////////////////
 	int GetGlyphAdvance(Uint16 ch) const;
 
+	////////////////////////////////////////////////////////////
+	/// \brief Get kerning between two UNICODE chars
+	///
+	/// \param[in] prev UNICODE char preceding ch
+	/// \param[in] ch UNICODE char to get the kerning for
+	///
+	/// \returns Offset to add to pen position between the chars,
+	///          or 0 if the font has no kerning information or
+	///          SDL_ttf is older than 2.0.14
+	///
+	/// This does not check whether kerning is enabled with
+	/// SetKerning()
+	///
+	/// \see https://wiki.libsdl.org/SDL_ttf/TTF_GetFontKerningSizeGlyphs
+	///
+	////////////////////////////////////////////////////////////
+	int GetGlyphKerning(Uint16 prev, Uint16 ch) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Fill glyph metrics cache for a range of chars
+	///
+	/// Glyph metrics and availability are queried from SDL_ttf
+	/// once per char and cached in the font: in a flat table for
+	/// Latin-1 chars and in a hash table for the rest. Normally
+	/// cache is filled on first use of each char; this fills it
+	/// in advance, for instance during loading, so no SDL_ttf
+	/// calls are made later. Cache is flushed by SetStyle(),
+	/// SetOutline() and SetHinting().
+	///
+	/// \param[in] first First UNICODE char of the range
+	/// \param[in] last Last UNICODE char of the range, inclusive
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Font& PreloadGlyphMetrics(Uint16 first = 0x20, Uint16 last = 0xff);
+
 	///@}
 
 	///@{
@@ -825,6 +904,128 @@ public:
 	Surface RenderGlyph_Blended(Uint16 ch, SDL_Color fg);
 
 	///@}
+
+	///@{
+	/// \name Rendering: blended into existing surface
+	///
+	/// These render text straight into a given surface, alpha
+	/// blending it over existing pixels, without allocating an
+	/// intermediate surface for the text. Glyphs are rendered
+	/// once with SDL_ttf and cached in the font as coverage
+	/// masks, then composited in any color. At most 1024 masks
+	/// are kept; when more distinct glyphs are drawn, the cache
+	/// is dropped and refilled with glyphs in use.
+	///
+	/// Glyphs are placed by their advances, taken from the same
+	/// metrics cache as GetGlyphMetrics(), and, if enabled,
+	/// kerning, without complex text shaping, so results may
+	/// differ slightly from the functions above. The top of the
+	/// text line is at given position, and line height is
+	/// GetHeight(). Surface clipping rectangle is respected.
+	///
+	/// Glyph cache is flushed by SetStyle(), SetOutline() and
+	/// SetHinting(). Changing these through Get() leaves stale
+	/// glyphs in the cache.
+
+	////////////////////////////////////////////////////////////
+	/// \brief Render LATIN1 text into existing surface using blended mode
+	///
+	/// \param[in] text LATIN1 string to render
+	/// \param[in] fg Color to render the text in
+	/// \param[in] dst Surface to render into
+	/// \param[in] position Top left corner of the text in dst
+	///
+	/// \returns Rectangle of dst pixels which may have been modified,
+	///          empty if text is entirely clipped
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Rect RenderText_Blended(const std::string& text, SDL_Color fg, Surface& dst, const Point& position);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Render UTF8 text into existing surface using blended mode
+	///
+	/// \param[in] text UTF8 string to render
+	/// \param[in] fg Color to render the text in
+	/// \param[in] dst Surface to render into
+	/// \param[in] position Top left corner of the text in dst
+	///
+	/// \returns Rectangle of dst pixels which may have been modified,
+	///          empty if text is entirely clipped
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Rect RenderUTF8_Blended(const std::string& text, SDL_Color fg, Surface& dst, const Point& position);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Render UNICODE encoded text into existing surface using blended mode
+	///
+	/// \param[in] text UNICODE encoded string to render
+	/// \param[in] fg Color to render the text in
+	/// \param[in] dst Surface to render into
+	/// \param[in] position Top left corner of the text in dst
+	///
+	/// \returns Rectangle of dst pixels which may have been modified,
+	///          empty if text is entirely clipped
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Rect RenderUNICODE_Blended(const Uint16* text, SDL_Color fg, Surface& dst, const Point& position);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Render UNICODE encoded text into existing surface using blended mode
+	///
+	/// \param[in] text UNICODE encoded string to render
+	/// \param[in] fg Color to render the text in
+	/// \param[in] dst Surface to render into
+	/// \param[in] position Top left corner of the text in dst
+	///
+	/// \returns Rectangle of dst pixels which may have been modified,
+	///          empty if text is entirely clipped
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Rect RenderUNICODE_Blended(const std::u16string& text, SDL_Color fg, Surface& dst, const Point& position);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Render the glyph for UNICODE character into existing surface using blended mode
+	///
+	/// \param[in] ch UNICODE character to render
+	/// \param[in] fg Color to render the glyph in
+	/// \param[in] dst Surface to render into
+	/// \param[in] position Top left corner of the glyph cell in dst
+	///
+	/// \returns Rectangle of dst pixels which may have been modified,
+	///          empty if glyph is entirely clipped
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Rect RenderGlyph_Blended(Uint16 ch, SDL_Color fg, Surface& dst, const Point& position);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Render UTF8 text into pooled surface using blended mode
+	///
+	/// Surface is ARGB8888, sized to fit the text, and transparent
+	/// outside of glyphs. Same as RenderUTF8_Blended(), but
+	/// reuses surfaces of the pool instead of allocating new ones.
+	///
+	/// \param[in] text UTF8 string to render
+	/// \param[in] fg Color to render the text in
+	/// \param[in] pool Pool to take the surface from
+	///
+	/// \returns Lease of surface containing rendered text
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	SurfacePool::Lease RenderUTF8_Blended(const std::string& text, SDL_Color fg, SurfacePool& pool);
+
+	///@}
 };
 
 }
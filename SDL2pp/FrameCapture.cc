@@ -0,0 +1,283 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <SDL_pixels.h>
+#include <SDL_surface.h>
+
+#include <SDL2pp/Config.hh>
+#include <SDL2pp/FrameCapture.hh>
+#include <SDL2pp/Renderer.hh>
+#include <SDL2pp/RWops.hh>
+#include <SDL2pp/Exception.hh>
+
+#ifdef SDL2PP_WITH_IMAGE
+#	include <SDL_image.h>
+#endif
+
+namespace SDL2pp {
+
+namespace {
+
+std::string FrameFileName(const std::string& prefix, unsigned long number, const char* extension) {
+	char buffer[32];
+	SDL_snprintf(buffer, sizeof(buffer), "%06lu.%s", number, extension);
+	return prefix + buffer;
+}
+
+void SaveRaw(Surface& frame, const std::string& path) {
+	SDL_Surface* surface = frame.Get();
+	RWops rwops = RWops::FromFile(path, "wb");
+
+	const size_t row_size = static_cast<size_t>(surface->w) * surface->format->BytesPerPixel;
+	for (int y = 0; y < surface->h; y++)
+		if (rwops.Write(static_cast<const Uint8*>(surface->pixels) + y * surface->pitch, row_size, 1) != 1)
+			throw Exception("SDL_RWwrite");
+}
+
+}
+
+FrameCapture::FrameCapture(Uint32 format, int w, int h, const std::string& prefix, Format file_format, int num_buffers) :
+	format_(format),
+	mutex_(nullptr),
+	cond_(nullptr),
+	thread_(nullptr),
+	write_(0),
+	read_(0),
+	queued_(0),
+	used_(0),
+	stop_(false),
+	next_number_(0),
+	dropped_(0),
+	encoded_(0),
+	failed_(0) {
+	switch (file_format) {
+	case Format::BMP:
+		handler_ = [prefix](Surface& frame, unsigned long number) {
+			if (SDL_SaveBMP(frame.Get(), FrameFileName(prefix, number, "bmp").c_str()) != 0)
+				throw Exception("SDL_SaveBMP_RW");
+		};
+		break;
+	case Format::PNG:
+#ifdef SDL2PP_WITH_IMAGE
+		handler_ = [prefix](Surface& frame, unsigned long number) {
+			if (IMG_SavePNG(frame.Get(), FrameFileName(prefix, number, "png").c_str()) != 0)
+				throw Exception("IMG_SavePNG");
+		};
+		break;
+#else
+		throw std::invalid_argument("PNG frame capture requires SDL2_image support");
+#endif
+	case Format::Raw:
+		handler_ = [prefix](Surface& frame, unsigned long number) {
+			SaveRaw(frame, FrameFileName(prefix, number, "raw"));
+		};
+		break;
+	}
+
+	Init(w, h, num_buffers);
+}
+
+FrameCapture::FrameCapture(Uint32 format, int w, int h, FrameHandler&& handler, int num_buffers) :
+	handler_(std::move(handler)),
+	format_(format),
+	mutex_(nullptr),
+	cond_(nullptr),
+	thread_(nullptr),
+	write_(0),
+	read_(0),
+	queued_(0),
+	used_(0),
+	stop_(false),
+	next_number_(0),
+	dropped_(0),
+	encoded_(0),
+	failed_(0) {
+	Init(w, h, num_buffers);
+}
+
+void FrameCapture::Init(int w, int h, int num_buffers) {
+	if (num_buffers < 1)
+		throw std::invalid_argument("FrameCapture needs at least one buffer");
+
+	int bpp;
+	Uint32 rmask, gmask, bmask, amask;
+	if (!SDL_PixelFormatEnumToMasks(format_, &bpp, &rmask, &gmask, &bmask, &amask))
+		throw Exception("SDL_PixelFormatEnumToMasks");
+
+	// all memory is allocated upfront, nothing is allocated per frame
+	buffers_.reserve(static_cast<size_t>(num_buffers));
+	for (int i = 0; i < num_buffers; i++)
+		buffers_.emplace_back(0, w, h, bpp, rmask, gmask, bmask, amask);
+	numbers_.resize(static_cast<size_t>(num_buffers));
+
+	if ((mutex_ = SDL_CreateMutex()) == nullptr)
+		throw Exception("SDL_CreateMutex");
+
+	if ((cond_ = SDL_CreateCond()) == nullptr) {
+		Exception e("SDL_CreateCond");
+		SDL_DestroyMutex(mutex_);
+		throw e;
+	}
+
+	if ((thread_ = SDL_CreateThread(WorkerThread, "SDL2pp frame capture", this)) == nullptr) {
+		Exception e("SDL_CreateThread");
+		SDL_DestroyCond(cond_);
+		SDL_DestroyMutex(mutex_);
+		throw e;
+	}
+}
+
+FrameCapture::~FrameCapture() {
+	SDL_LockMutex(mutex_);
+	stop_ = true;
+	SDL_CondBroadcast(cond_);
+	SDL_UnlockMutex(mutex_);
+
+	SDL_WaitThread(thread_, nullptr);
+
+	SDL_DestroyCond(cond_);
+	SDL_DestroyMutex(mutex_);
+}
+
+int FrameCapture::WorkerThread(void* data) {
+	FrameCapture* self = static_cast<FrameCapture*>(data);
+
+	SDL_LockMutex(self->mutex_);
+	while (true) {
+		while (self->queued_ == 0 && !self->stop_)
+			SDL_CondWait(self->cond_, self->mutex_);
+
+		// pending frames are still processed on stop
+		if (self->queued_ == 0)
+			break;
+
+		size_t index = self->read_;
+		unsigned long number = self->numbers_[index];
+		self->queued_--;
+		SDL_UnlockMutex(self->mutex_);
+
+		try {
+			self->handler_(self->buffers_[index], number);
+			self->encoded_++;
+		} catch (...) {
+			self->failed_++;
+		}
+
+		SDL_LockMutex(self->mutex_);
+		self->read_ = (self->read_ + 1) % self->buffers_.size();
+		self->used_--;
+		SDL_CondBroadcast(self->cond_);
+	}
+	SDL_UnlockMutex(self->mutex_);
+
+	return 0;
+}
+
+Surface* FrameCapture::AcquireBuffer() {
+	SDL_LockMutex(mutex_);
+	bool full = used_ == buffers_.size();
+	SDL_UnlockMutex(mutex_);
+
+	if (full) {
+		next_number_++;
+		dropped_++;
+		return nullptr;
+	}
+
+	// buffer at write position is not touched by worker
+	// until it's submitted, so it's filled without lock
+	return &buffers_[write_];
+}
+
+void FrameCapture::SubmitBuffer() {
+	SDL_LockMutex(mutex_);
+	numbers_[write_] = next_number_++;
+	write_ = (write_ + 1) % buffers_.size();
+	queued_++;
+	used_++;
+	SDL_CondBroadcast(cond_);
+	SDL_UnlockMutex(mutex_);
+}
+
+bool FrameCapture::Capture(Renderer& renderer) {
+	Surface* buffer = AcquireBuffer();
+	if (buffer == nullptr)
+		return false;
+
+	SDL_Surface* surface = buffer->Get();
+	renderer.ReadPixels(Rect(0, 0, surface->w, surface->h), format_, surface->pixels, surface->pitch);
+
+	SubmitBuffer();
+	return true;
+}
+
+bool FrameCapture::Capture(Surface& surface) {
+	SDL_Surface* src = surface.Get();
+	if (src->w < buffers_.front().GetWidth() || src->h < buffers_.front().GetHeight())
+		throw std::invalid_argument("Surface is smaller than captured frame");
+
+	Surface* buffer = AcquireBuffer();
+	if (buffer == nullptr)
+		return false;
+
+	SDL_Surface* dst = buffer->Get();
+	Surface::LockHandle lock = surface.Lock();
+
+	if (src->format->format == format_) {
+		const size_t row_size = static_cast<size_t>(dst->w) * dst->format->BytesPerPixel;
+		for (int y = 0; y < dst->h; y++)
+			std::memcpy(static_cast<Uint8*>(dst->pixels) + y * dst->pitch, static_cast<const Uint8*>(src->pixels) + y * src->pitch, row_size);
+	} else if (SDL_ConvertPixels(dst->w, dst->h, src->format->format, src->pixels, src->pitch, format_, dst->pixels, dst->pitch) != 0) {
+		throw Exception("SDL_ConvertPixels");
+	}
+
+	SubmitBuffer();
+	return true;
+}
+
+void FrameCapture::Flush() {
+	SDL_LockMutex(mutex_);
+	while (used_ != 0)
+		SDL_CondWait(cond_, mutex_);
+	SDL_UnlockMutex(mutex_);
+}
+
+unsigned long FrameCapture::GetNumCaptured() const {
+	return next_number_;
+}
+
+unsigned long FrameCapture::GetNumDropped() const {
+	return dropped_;
+}
+
+unsigned long FrameCapture::GetNumEncoded() const {
+	return encoded_;
+}
+
+unsigned long FrameCapture::GetNumFailed() const {
+	return failed_;
+}
+
+}
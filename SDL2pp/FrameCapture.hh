@@ -0,0 +1,273 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_FRAMECAPTURE_HH
+#define SDL2PP_FRAMECAPTURE_HH
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <SDL_stdinc.h>
+#include <SDL_mutex.h>
+#include <SDL_thread.h>
+
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+class Renderer;
+
+////////////////////////////////////////////////////////////
+/// \brief Asynchronous capture of rendered frames
+///
+/// \ingroup rendering
+///
+/// \headerfile SDL2pp/FrameCapture.hh
+///
+/// Reads frames into a fixed ring of preallocated buffers and
+/// hands them over to a worker thread which encodes and saves
+/// them, so the rendering thread only pays for the readback
+/// itself. Memory usage is bounded by the number of buffers:
+/// when all of them are occupied because the encoder falls
+/// behind, the frame is dropped and counted.
+///
+/// Frames rendered with software renderer may be captured
+/// directly from the target surface, which skips the renderer
+/// readback path and pixel format conversion.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::FrameCapture capture(SDL_PIXELFORMAT_ARGB8888, 640, 480, "frame_", SDL2pp::FrameCapture::Format::BMP);
+///
+///     while (running) {
+///         // render frame
+///         capture.Capture(renderer);  // saves frame_000000.bmp, frame_000001.bmp, ...
+///         renderer.Present();
+///     }
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT FrameCapture {
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Output file format
+	///
+	////////////////////////////////////////////////////////////
+	enum class Format {
+		BMP, ///< Windows BMP
+		PNG, ///< PNG, requires SDL2_image
+		Raw, ///< Tightly packed pixel data without header
+	};
+
+	typedef std::function<void(Surface& frame, unsigned long number)> FrameHandler; ///< Function type for frame handler
+
+private:
+	std::vector<Surface> buffers_;          ///< Ring of frame buffers
+	std::vector<unsigned long> numbers_;    ///< Frame numbers of buffered frames
+	FrameHandler handler_;                  ///< Handler called for each frame in worker thread
+	Uint32 format_;                         ///< Pixel format of buffers
+
+	SDL_mutex* mutex_;                      ///< Mutex protecting ring state
+	SDL_cond* cond_;                        ///< Condition signaled on ring state changes
+	SDL_Thread* thread_;                    ///< Worker thread
+
+	size_t write_;                          ///< Index of next buffer to fill
+	size_t read_;                           ///< Index of next buffer to encode
+	size_t queued_;                         ///< Number of filled buffers not yet taken by worker
+	size_t used_;                           ///< Number of buffers not yet released by worker
+	bool stop_;                             ///< Whether worker should exit after draining the queue
+
+	unsigned long next_number_;             ///< Number of next captured frame
+	std::atomic<unsigned long> dropped_;    ///< Number of dropped frames
+	std::atomic<unsigned long> encoded_;    ///< Number of successfully processed frames
+	std::atomic<unsigned long> failed_;     ///< Number of frames handler failed on
+
+private:
+	////////////////////////////////////////////////////////////
+	/// \brief Worker thread function
+	///
+	////////////////////////////////////////////////////////////
+	static int WorkerThread(void* data);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Reserve buffer for the next frame
+	///
+	/// \returns Pointer to free buffer or nullptr if ring is full
+	///
+	////////////////////////////////////////////////////////////
+	Surface* AcquireBuffer();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Pass filled buffer to the worker thread
+	///
+	////////////////////////////////////////////////////////////
+	void SubmitBuffer();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Allocate buffers and start worker
+	///
+	////////////////////////////////////////////////////////////
+	void Init(int w, int h, int num_buffers);
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Create capture which saves frames into files
+	///
+	/// Files are named by appending zero padded frame number and
+	/// extension to given prefix
+	///
+	/// \param[in] format Pixel format of captured frames, one of the
+	///                   enumerated values in SDL_PixelFormatEnum
+	/// \param[in] w Width of captured frames
+	/// \param[in] h Height of captured frames
+	/// \param[in] prefix Path prefix for output files
+	/// \param[in] file_format Format of output files
+	/// \param[in] num_buffers Number of frame buffers
+	///
+	/// \throws SDL2pp::Exception
+	/// \throws std::invalid_argument if PNG is requested without
+	///         SDL2_image support or number of buffers is invalid
+	///
+	////////////////////////////////////////////////////////////
+	FrameCapture(Uint32 format, int w, int h, const std::string& prefix, Format file_format, int num_buffers = 3);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create capture with custom frame handler
+	///
+	/// \param[in] format Pixel format of captured frames, one of the
+	///                   enumerated values in SDL_PixelFormatEnum
+	/// \param[in] w Width of captured frames
+	/// \param[in] h Height of captured frames
+	/// \param[in] handler Function called in worker thread for each
+	///                    frame. Frame surface is only valid until
+	///                    the function returns. If it throws, frame
+	///                    is counted as failed
+	/// \param[in] num_buffers Number of frame buffers
+	///
+	/// \throws SDL2pp::Exception
+	/// \throws std::invalid_argument if number of buffers is invalid
+	///
+	////////////////////////////////////////////////////////////
+	FrameCapture(Uint32 format, int w, int h, FrameHandler&& handler, int num_buffers = 3);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Destructor
+	///
+	/// Waits until all captured frames are processed
+	///
+	////////////////////////////////////////////////////////////
+	~FrameCapture();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted copy constructor
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	FrameCapture(const FrameCapture& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted assignment operator
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	FrameCapture& operator=(const FrameCapture& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Capture current rendering target
+	///
+	/// Reads top left part of rendering target of capture size
+	///
+	/// \param[in] renderer Renderer to read pixels from
+	///
+	/// \returns True if frame was queued, false if it was dropped
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderReadPixels
+	///
+	////////////////////////////////////////////////////////////
+	bool Capture(Renderer& renderer);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Capture contents of a surface
+	///
+	/// Intended for software rendering, where target surface is
+	/// accessible directly. Pixel rows are copied straight into
+	/// the buffer if surface format matches capture format.
+	///
+	/// \param[in] surface Surface to capture top left part of
+	///
+	/// \returns True if frame was queued, false if it was dropped
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	bool Capture(Surface& surface);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Wait until all captured frames are processed
+	///
+	////////////////////////////////////////////////////////////
+	void Flush();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of frames captured so far
+	///
+	/// \returns Number of frames captured, including dropped ones
+	///
+	////////////////////////////////////////////////////////////
+	unsigned long GetNumCaptured() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of dropped frames
+	///
+	/// \returns Number of frames dropped because all buffers were busy
+	///
+	////////////////////////////////////////////////////////////
+	unsigned long GetNumDropped() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of processed frames
+	///
+	/// \returns Number of frames successfully saved or handled
+	///
+	////////////////////////////////////////////////////////////
+	unsigned long GetNumEncoded() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of failed frames
+	///
+	/// \returns Number of frames which failed to save
+	///
+	////////////////////////////////////////////////////////////
+	unsigned long GetNumFailed() const;
+};
+
+}
+
+#endif
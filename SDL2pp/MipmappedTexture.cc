@@ -0,0 +1,123 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+
+#include <SDL_surface.h>
+
+#include <SDL2pp/MipmappedTexture.hh>
+#include <SDL2pp/Renderer.hh>
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/Exception.hh>
+
+namespace SDL2pp {
+
+MipmappedTexture::MipmappedTexture(Renderer& renderer, const Surface& surface, int max_levels) {
+	levels_.emplace_back(renderer, surface);
+
+	SDL_Surface* copy = SDL_ConvertSurface(surface.Get(), surface.Get()->format, 0);
+	if (copy == nullptr)
+		throw Exception("SDL_ConvertSurface");
+
+	Surface current(copy);
+	while ((max_levels <= 0 || static_cast<int>(levels_.size()) < max_levels) && (current.GetWidth() > 1 || current.GetHeight() > 1)) {
+		// 2x box filter is a plain 2x2 average; odd sizes are
+		// handled by Resample() weights
+		Point size(std::max(current.GetWidth() / 2, 1), std::max(current.GetHeight() / 2, 1));
+		current = current.Resample(NullOpt, size, Surface::ResampleFilter::Box);
+		levels_.emplace_back(renderer, current);
+	}
+}
+
+int MipmappedTexture::GetNumLevels() const {
+	return static_cast<int>(levels_.size());
+}
+
+Texture& MipmappedTexture::GetLevel(int level) {
+	return levels_[static_cast<size_t>(level)];
+}
+
+int MipmappedTexture::SelectLevel(const Point& srcsize, const Point& dstsize) const {
+	if (dstsize.x <= 0 || dstsize.y <= 0)
+		return 0;
+
+	// same as OpenGL, the larger ratio defines level so the
+	// result never aliases
+	float ratio = std::max(static_cast<float>(srcsize.x) / dstsize.x, static_cast<float>(srcsize.y) / dstsize.y);
+
+	int level = 0;
+	while (level + 1 < GetNumLevels() && ratio >= 2.0f) {
+		ratio /= 2.0f;
+		++level;
+	}
+	return level;
+}
+
+Rect MipmappedTexture::GetLevelRect(const Rect& rect, int level) const {
+	if (level == 0)
+		return rect;
+
+	Point base = levels_.front().GetSize();
+	Point size = levels_[static_cast<size_t>(level)].GetSize();
+
+	int x1 = rect.x * size.x / base.x;
+	int y1 = rect.y * size.y / base.y;
+	int x2 = (rect.x + rect.w) * size.x / base.x;
+	int y2 = (rect.y + rect.h) * size.y / base.y;
+
+	return Rect(x1, y1, std::max(x2 - x1, 1), std::max(y2 - y1, 1));
+}
+
+MipmappedTexture& MipmappedTexture::SetBlendMode(SDL_BlendMode blendMode) {
+	for (auto& level : levels_)
+		level.SetBlendMode(blendMode);
+	return *this;
+}
+
+MipmappedTexture& MipmappedTexture::SetAlphaMod(Uint8 alpha) {
+	for (auto& level : levels_)
+		level.SetAlphaMod(alpha);
+	return *this;
+}
+
+MipmappedTexture& MipmappedTexture::SetColorMod(Uint8 r, Uint8 g, Uint8 b) {
+	for (auto& level : levels_)
+		level.SetColorMod(r, g, b);
+	return *this;
+}
+
+MipmappedTexture& MipmappedTexture::SetColorAndAlphaMod(const Color& color) {
+	return SetColorMod(color.r, color.g, color.b).SetAlphaMod(color.a);
+}
+
+int MipmappedTexture::GetWidth() const {
+	return levels_.front().GetWidth();
+}
+
+int MipmappedTexture::GetHeight() const {
+	return levels_.front().GetHeight();
+}
+
+Point MipmappedTexture::GetSize() const {
+	return levels_.front().GetSize();
+}
+
+}
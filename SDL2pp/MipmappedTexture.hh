@@ -0,0 +1,246 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_MIPMAPPEDTEXTURE_HH
+#define SDL2PP_MIPMAPPEDTEXTURE_HH
+
+#include <vector>
+
+#include <SDL_stdinc.h>
+#include <SDL_blendmode.h>
+
+#include <SDL2pp/Texture.hh>
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Color.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+class Renderer;
+class Surface;
+
+////////////////////////////////////////////////////////////
+/// \brief Texture with a chain of downscaled mipmap levels
+///
+/// \ingroup rendering
+///
+/// \headerfile SDL2pp/MipmappedTexture.hh
+///
+/// SDL2 renderers do not support mipmapping, so drawing a
+/// large texture heavily minified aliases and samples much
+/// more data than needed. This class generates a box filtered
+/// mipmap chain on the CPU, uploads each level as a separate
+/// Texture and lets Renderer::Copy() pick the level matching
+/// the source to destination size ratio.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::MipmappedTexture map(renderer, SDL2pp::Surface("map.png"));
+///
+///     // samples one of smaller levels instead of full texture
+///     renderer.Copy(map, SDL2pp::NullOpt, SDL2pp::Rect(0, 0, 64, 64));
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT MipmappedTexture {
+private:
+	std::vector<Texture> levels_; ///< Mipmap levels, from full size to 1x1
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Create mipmapped texture from surface
+	///
+	/// \param[in] renderer Rendering context to create textures for
+	/// \param[in] surface Surface containing pixel data of base level
+	/// \param[in] max_levels Maximal number of levels to generate,
+	///                       or 0 to generate full chain down to 1x1
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see Surface::Resample
+	///
+	////////////////////////////////////////////////////////////
+	MipmappedTexture(Renderer& renderer, const Surface& surface, int max_levels = 0);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Move constructor
+	///
+	/// \param[in] other SDL2pp::MipmappedTexture object to move data from
+	///
+	////////////////////////////////////////////////////////////
+	MipmappedTexture(MipmappedTexture&& other) noexcept = default;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Move assignment operator
+	///
+	/// \param[in] other SDL2pp::MipmappedTexture object to move data from
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	MipmappedTexture& operator=(MipmappedTexture&& other) noexcept = default;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted copy constructor
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	MipmappedTexture(const MipmappedTexture& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted assignment operator
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	MipmappedTexture& operator=(const MipmappedTexture& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of mipmap levels
+	///
+	/// \returns Number of levels, including the base one
+	///
+	////////////////////////////////////////////////////////////
+	int GetNumLevels() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get texture of specific mipmap level
+	///
+	/// \param[in] level Level number, 0 being full size texture
+	///
+	/// \returns Reference to level texture
+	///
+	////////////////////////////////////////////////////////////
+	Texture& GetLevel(int level);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Choose mipmap level for given scaling
+	///
+	/// \param[in] srcsize Size of source region in base level coordinates
+	/// \param[in] dstsize Size of destination region in pixels
+	///
+	/// \returns Smallest level which is still not smaller than
+	///          destination, so it's never magnified
+	///
+	////////////////////////////////////////////////////////////
+	int SelectLevel(const Point& srcsize, const Point& dstsize) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Convert rectangle in base level coordinates to given level
+	///
+	/// \param[in] rect Rectangle in base level coordinates
+	/// \param[in] level Level number
+	///
+	/// \returns Rectangle in level coordinates
+	///
+	////////////////////////////////////////////////////////////
+	Rect GetLevelRect(const Rect& rect, int level) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set the blend mode for all levels
+	///
+	/// \param[in] blendMode SDL_BlendMode to use for texture blending
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see Texture::SetBlendMode
+	///
+	////////////////////////////////////////////////////////////
+	MipmappedTexture& SetBlendMode(SDL_BlendMode blendMode = SDL_BLENDMODE_NONE);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set an additional alpha value for all levels
+	///
+	/// \param[in] alpha Alpha value multiplied into copy operations
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see Texture::SetAlphaMod
+	///
+	////////////////////////////////////////////////////////////
+	MipmappedTexture& SetAlphaMod(Uint8 alpha = 255);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set an additional color value for all levels
+	///
+	/// \param[in] r Red color value multiplied into copy operations
+	/// \param[in] g Green color value multiplied into copy operations
+	/// \param[in] b Blue color value multiplied into copy operations
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see Texture::SetColorMod
+	///
+	////////////////////////////////////////////////////////////
+	MipmappedTexture& SetColorMod(Uint8 r = 255, Uint8 g = 255, Uint8 b = 255);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set an additional color and alpha value for all levels
+	///
+	/// \param[in] color Color to be multiplied into copy operations
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see Texture::SetColorAndAlphaMod
+	///
+	////////////////////////////////////////////////////////////
+	MipmappedTexture& SetColorAndAlphaMod(const Color& color = Color{255, 255, 255, SDL_ALPHA_OPAQUE});
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get width of the base level
+	///
+	/// \returns Texture width in pixels
+	///
+	////////////////////////////////////////////////////////////
+	int GetWidth() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get height of the base level
+	///
+	/// \returns Texture height in pixels
+	///
+	////////////////////////////////////////////////////////////
+	int GetHeight() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get size of the base level
+	///
+	/// \returns Texture size in pixels
+	///
+	////////////////////////////////////////////////////////////
+	Point GetSize() const;
+};
+
+}
+
+#endif
@@ -68,31 +68,47 @@ int Mixer::GetVolume(int channel) const {
 }
 
 int Mixer::PlayChannel(int channel, const Chunk& chunk, int loops) {
-	int chan;
-	if ((chan = Mix_PlayChannel(channel, chunk.Get(), loops)) == -1)
-		throw Exception("Mix_PlayChannel");
-	return chan;
+	return TryPlayChannel(channel, chunk, loops).ThrowIfFailed();
+}
+
+Result Mixer::TryPlayChannel(int channel, const Chunk& chunk, int loops) {
+	int chan = Mix_PlayChannel(channel, chunk.Get(), loops);
+	if (chan == -1)
+		return Result("Mix_PlayChannel", -1);
+	return Result(chan);
 }
 
 int Mixer::PlayChannel(int channel, const Chunk& chunk, int loops, int ticks) {
-	int chan;
-	if ((chan = Mix_PlayChannelTimed(channel, chunk.Get(), loops, ticks)) == -1)
-		throw Exception("Mix_PlayChannelTimed");
-	return chan;
+	return TryPlayChannel(channel, chunk, loops, ticks).ThrowIfFailed();
+}
+
+Result Mixer::TryPlayChannel(int channel, const Chunk& chunk, int loops, int ticks) {
+	int chan = Mix_PlayChannelTimed(channel, chunk.Get(), loops, ticks);
+	if (chan == -1)
+		return Result("Mix_PlayChannelTimed", -1);
+	return Result(chan);
 }
 
 int Mixer::FadeInChannel(int channel, const Chunk& chunk, int loops, int ms) {
-	int chan;
-	if ((chan = Mix_FadeInChannel(channel, chunk.Get(), loops, ms)) == -1)
-		throw Exception("Mix_FadeInChannel");
-	return chan;
+	return TryFadeInChannel(channel, chunk, loops, ms).ThrowIfFailed();
+}
+
+Result Mixer::TryFadeInChannel(int channel, const Chunk& chunk, int loops, int ms) {
+	int chan = Mix_FadeInChannel(channel, chunk.Get(), loops, ms);
+	if (chan == -1)
+		return Result("Mix_FadeInChannel", -1);
+	return Result(chan);
 }
 
 int Mixer::FadeInChannel(int channel, const Chunk& chunk, int loops, int ms, int ticks) {
-	int chan;
-	if ((chan = Mix_FadeInChannelTimed(channel, chunk.Get(), loops, ms, ticks)) == -1)
-		throw Exception("Mix_FadeInChannelTimed");
-	return chan;
+	return TryFadeInChannel(channel, chunk, loops, ms, ticks).ThrowIfFailed();
+}
+
+Result Mixer::TryFadeInChannel(int channel, const Chunk& chunk, int loops, int ms, int ticks) {
+	int chan = Mix_FadeInChannelTimed(channel, chunk.Get(), loops, ms, ticks);
+	if (chan == -1)
+		return Result("Mix_FadeInChannelTimed", -1);
+	return Result(chan);
 }
 
 void Mixer::PauseChannel(int channel) {
@@ -29,6 +29,7 @@
 #include <SDL_mixer.h>
 
 #include <SDL2pp/Export.hh>
+#include <SDL2pp/Result.hh>
 
 namespace SDL2pp {
 
@@ -210,6 +211,22 @@ public:
 	////////////////////////////////////////////////////////////
 	int PlayChannel(int channel, const Chunk& chunk, int loops = 0);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of PlayChannel()
+	///
+	/// \param[in] channel Channel to play on, or -1 for the first
+	///                    free unreserved channel
+	/// \param[in] chunk Sample to play
+	/// \param[in] loops Number of loops, -1 is infinite loops.
+	///                  Passing one here plays the sample twice (1 loop).
+	///
+	/// \returns SDL2pp::Result holding the channel being played on
+	///
+	/// \see PlayChannel
+	///
+	////////////////////////////////////////////////////////////
+	Result TryPlayChannel(int channel, const Chunk& chunk, int loops = 0);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Play loop and limit by time
 	///
@@ -232,6 +249,26 @@ public:
 	////////////////////////////////////////////////////////////
 	int PlayChannel(int channel, const Chunk& chunk, int loops, int ticks);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of PlayChannel()
+	///
+	/// \param[in] channel Channel to play on, or -1 for the first
+	///                    free unreserved channel
+	/// \param[in] chunk Sample to play
+	/// \param[in] loops Number of loops, -1 is infinite loops.
+	///                  Passing one here plays the sample twice (1 loop).
+	/// \param[in] ticks Millisecond limit to play sample, at most.
+	///                  If not enough loops or the sample chunk is not
+	///                  long enough, then the sample may stop before
+	///                  this timeout occurs. -1 means play forever
+	///
+	/// \returns SDL2pp::Result holding the channel being played on
+	///
+	/// \see PlayChannel
+	///
+	////////////////////////////////////////////////////////////
+	Result TryPlayChannel(int channel, const Chunk& chunk, int loops, int ticks);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Play loop with fade in
 	///
@@ -252,6 +289,24 @@ public:
 	////////////////////////////////////////////////////////////
 	int FadeInChannel(int channel, const Chunk& chunk, int loops, int ms);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of FadeInChannel()
+	///
+	/// \param[in] channel Channel to play on, or -1 for the first
+	///                    free unreserved channel
+	/// \param[in] chunk Sample to play
+	/// \param[in] loops Number of loops, -1 is infinite loops.
+	///                  Passing one here plays the sample twice (1 loop).
+	/// \param[in] ms Milliseconds of time that the fade-in effect
+	///               should take to go from silence to full volume
+	///
+	/// \returns SDL2pp::Result holding the channel being played on
+	///
+	/// \see FadeInChannel
+	///
+	////////////////////////////////////////////////////////////
+	Result TryFadeInChannel(int channel, const Chunk& chunk, int loops, int ms);
+
 	////////////////////////////////////////////////////////////
 	/// \brief  loop with fade in and limit by time
 	///
@@ -276,6 +331,28 @@ public:
 	////////////////////////////////////////////////////////////
 	int FadeInChannel(int channel, const Chunk& chunk, int loops, int ms, int ticks);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of FadeInChannel()
+	///
+	/// \param[in] channel Channel to play on, or -1 for the first
+	///                    free unreserved channel
+	/// \param[in] chunk Sample to play
+	/// \param[in] loops Number of loops, -1 is infinite loops.
+	///                  Passing one here plays the sample twice (1 loop).
+	/// \param[in] ms Milliseconds of time that the fade-in effect
+	///               should take to go from silence to full volume
+	/// \param[in] ticks Millisecond limit to play sample, at most.
+	///                  If not enough loops or the sample chunk is not
+	///                  long enough, then the sample may stop before
+	///                  this timeout occurs. -1 means play forever
+	///
+	/// \returns SDL2pp::Result holding the channel being played on
+	///
+	/// \see FadeInChannel
+	///
+	////////////////////////////////////////////////////////////
+	Result TryFadeInChannel(int channel, const Chunk& chunk, int loops, int ms, int ticks);
+
 	///@}
 
 	///@{
@@ -0,0 +1,205 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+
+#include <SDL2pp/ParticleSystem.hh>
+#include <SDL2pp/Renderer.hh>
+#include <SDL2pp/Texture.hh>
+
+namespace SDL2pp {
+
+ParticleSystem::ParticleSystem(size_t max_particles)
+	: max_particles_(max_particles),
+	  num_particles_(0),
+	  x_(max_particles),
+	  y_(max_particles),
+	  vx_(max_particles),
+	  vy_(max_particles),
+	  life_(max_particles),
+	  inv_lifetime_(max_particles),
+	  r_(max_particles),
+	  g_(max_particles),
+	  b_(max_particles),
+	  a_(max_particles),
+	  gravity_x_(0.0f),
+	  gravity_y_(0.0f),
+	  drag_(0.0f),
+	  size_(1.0f) {
+}
+
+void ParticleSystem::SetGravity(float x, float y) {
+	gravity_x_ = x;
+	gravity_y_ = y;
+}
+
+void ParticleSystem::SetDrag(float drag) {
+	drag_ = drag;
+}
+
+void ParticleSystem::SetParticleSize(float size) {
+	size_ = size;
+}
+
+bool ParticleSystem::Emit(float x, float y, float vx, float vy, float lifetime, const Color& color) {
+	if (num_particles_ >= max_particles_ || !(lifetime > 0.0f))
+		return false;
+
+	const size_t i = num_particles_++;
+	x_[i] = x;
+	y_[i] = y;
+	vx_[i] = vx;
+	vy_[i] = vy;
+	life_[i] = lifetime;
+	inv_lifetime_[i] = 1.0f / lifetime;
+	r_[i] = color.r;
+	g_[i] = color.g;
+	b_[i] = color.b;
+	a_[i] = color.a;
+
+	return true;
+}
+
+void ParticleSystem::Update(float dt) {
+	const size_t n = num_particles_;
+
+	float* x = x_.data();
+	float* y = y_.data();
+	float* vx = vx_.data();
+	float* vy = vy_.data();
+	float* life = life_.data();
+
+	const float damping = std::max(1.0f - drag_ * dt, 0.0f);
+	const float dvx = gravity_x_ * dt;
+	const float dvy = gravity_y_ * dt;
+
+	// separate loops over few arrays each vectorize best
+	for (size_t i = 0; i < n; i++) {
+		vx[i] = vx[i] * damping + dvx;
+		vy[i] = vy[i] * damping + dvy;
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		x[i] += vx[i] * dt;
+		y[i] += vy[i] * dt;
+	}
+
+	size_t num_alive = 0;
+	for (size_t i = 0; i < n; i++) {
+		life[i] -= dt;
+		num_alive += life[i] > 0.0f;
+	}
+
+	if (num_alive == n)
+		return;
+
+	// branchless compaction of live particles
+	float* inv_lifetime = inv_lifetime_.data();
+	Uint8* r = r_.data();
+	Uint8* g = g_.data();
+	Uint8* b = b_.data();
+	Uint8* a = a_.data();
+
+	size_t out = 0;
+	for (size_t i = 0; i < n; i++) {
+		const bool alive = life[i] > 0.0f;
+		x[out] = x[i];
+		y[out] = y[i];
+		vx[out] = vx[i];
+		vy[out] = vy[i];
+		life[out] = life[i];
+		inv_lifetime[out] = inv_lifetime[i];
+		r[out] = r[i];
+		g[out] = g[i];
+		b[out] = b[i];
+		a[out] = a[i];
+		out += alive;
+	}
+
+	num_particles_ = out;
+}
+
+void ParticleSystem::Clear() {
+	num_particles_ = 0;
+}
+
+size_t ParticleSystem::GetNumParticles() const {
+	return num_particles_;
+}
+
+size_t ParticleSystem::GetMaxParticles() const {
+	return max_particles_;
+}
+
+const float* ParticleSystem::GetX() const {
+	return x_.data();
+}
+
+const float* ParticleSystem::GetY() const {
+	return y_.data();
+}
+
+const float* ParticleSystem::GetLife() const {
+	return life_.data();
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+void ParticleSystem::Draw(Renderer& renderer, Texture* texture, const Optional<Rect>& srcrect) {
+	const size_t n = num_particles_;
+	if (n == 0)
+		return;
+
+	float u1 = 0.0f, v1 = 0.0f, u2 = 1.0f, v2 = 1.0f;
+	if (texture != nullptr && srcrect) {
+		const Point size = texture->GetSize();
+		u1 = static_cast<float>(srcrect->x) / size.x;
+		v1 = static_cast<float>(srcrect->y) / size.y;
+		u2 = static_cast<float>(srcrect->x + srcrect->w) / size.x;
+		v2 = static_cast<float>(srcrect->y + srcrect->h) / size.y;
+	}
+
+	// indices are the same for every frame, so only grow them
+	for (size_t quad = indices_.size() / 6; quad < n; quad++) {
+		const int first = static_cast<int>(quad * 4);
+		indices_.insert(indices_.end(), { first, first + 1, first + 2, first + 2, first + 3, first });
+	}
+
+	vertices_.resize(n * 4);
+
+	const float half = size_ * 0.5f;
+	SDL_Vertex* vertex = vertices_.data();
+	for (size_t i = 0; i < n; i++, vertex += 4) {
+		const float left = x_[i] - half, right = x_[i] + half;
+		const float top = y_[i] - half, bottom = y_[i] + half;
+		const float fade = std::min(life_[i] * inv_lifetime_[i], 1.0f);
+		const SDL_Color color = { r_[i], g_[i], b_[i], static_cast<Uint8>(a_[i] * fade) };
+
+		vertex[0] = SDL_Vertex{ { left, top }, color, { u1, v1 } };
+		vertex[1] = SDL_Vertex{ { right, top }, color, { u2, v1 } };
+		vertex[2] = SDL_Vertex{ { right, bottom }, color, { u2, v2 } };
+		vertex[3] = SDL_Vertex{ { left, bottom }, color, { u1, v2 } };
+	}
+
+	renderer.Geometry(texture, vertices_.data(), static_cast<int>(n * 4), indices_.data(), static_cast<int>(n * 6));
+}
+#endif
+
+}
@@ -0,0 +1,229 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_PARTICLESYSTEM_HH
+#define SDL2PP_PARTICLESYSTEM_HH
+
+#include <cstddef>
+#include <vector>
+
+#include <SDL_version.h>
+#include <SDL_stdinc.h>
+#include <SDL_render.h>
+
+#include <SDL2pp/Color.hh>
+#include <SDL2pp/Optional.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+class Renderer;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Particle emitter with batched rendering
+///
+/// \ingroup rendering
+///
+/// \headerfile SDL2pp/ParticleSystem.hh
+///
+/// Particle state (position, velocity, remaining life and
+/// color) is stored as separate contiguous arrays, so Update()
+/// consists of simple branchless loops the compiler vectorizes.
+/// Dead particles are removed by compacting the arrays.
+///
+/// All particles are drawn as textured (or plain colored)
+/// square quads with a single SDL_RenderGeometry() call. Color
+/// of each particle is passed in vertex colors instead of
+/// texture color modulation, and its alpha fades out linearly
+/// over particle lifetime.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::ParticleSystem sparks(10000);
+///     sparks.SetGravity(0.0f, 98.0f);
+///     sparks.SetParticleSize(8.0f);
+///
+///     for (int i = 0; i < 100; i++)
+///         sparks.Emit(x, y, RandomVelocity(), RandomVelocity(), 2.0f, SDL2pp::Color(255, 200, 50));
+///
+///     while (running) {
+///         sparks.Update(frame_time);
+///         sparks.Draw(renderer, &spark_texture);
+///     }
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT ParticleSystem {
+private:
+	size_t max_particles_;               ///< Max number of live particles
+	size_t num_particles_;               ///< Number of live particles
+
+	std::vector<float> x_;               ///< X positions
+	std::vector<float> y_;               ///< Y positions
+	std::vector<float> vx_;              ///< X velocities
+	std::vector<float> vy_;              ///< Y velocities
+	std::vector<float> life_;            ///< Remaining lifetimes
+	std::vector<float> inv_lifetime_;    ///< Inverses of initial lifetimes
+	std::vector<Uint8> r_;               ///< Red color components
+	std::vector<Uint8> g_;               ///< Green color components
+	std::vector<Uint8> b_;               ///< Blue color components
+	std::vector<Uint8> a_;               ///< Initial alpha components
+
+	float gravity_x_;                    ///< X acceleration
+	float gravity_y_;                    ///< Y acceleration
+	float drag_;                         ///< Velocity damping per second
+	float size_;                         ///< Side of particle quad
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+	std::vector<SDL_Vertex> vertices_;   ///< Scratch vertex buffer for Draw()
+	std::vector<int> indices_;           ///< Quad indices for Draw()
+#endif
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Construct empty particle system
+	///
+	/// \param[in] max_particles Max number of live particles
+	///
+	////////////////////////////////////////////////////////////
+	explicit ParticleSystem(size_t max_particles);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set acceleration applied to all particles
+	///
+	/// \param[in] x X acceleration in pixels per second squared
+	/// \param[in] y Y acceleration in pixels per second squared
+	///
+	////////////////////////////////////////////////////////////
+	void SetGravity(float x, float y);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set velocity damping
+	///
+	/// \param[in] drag Fraction of velocity lost per second
+	///
+	////////////////////////////////////////////////////////////
+	void SetDrag(float drag);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set size of particle quads
+	///
+	/// \param[in] size Side of particle quad in pixels
+	///
+	////////////////////////////////////////////////////////////
+	void SetParticleSize(float size);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Spawn a particle
+	///
+	/// \param[in] x X coordinate of particle center
+	/// \param[in] y Y coordinate of particle center
+	/// \param[in] vx X velocity in pixels per second
+	/// \param[in] vy Y velocity in pixels per second
+	/// \param[in] lifetime Particle lifetime in seconds
+	/// \param[in] color Particle color
+	///
+	/// \returns False if there's no room for another particle
+	///          or lifetime is not positive, true otherwise
+	///
+	////////////////////////////////////////////////////////////
+	bool Emit(float x, float y, float vx, float vy, float lifetime, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Advance simulation
+	///
+	/// \param[in] dt Time step in seconds
+	///
+	////////////////////////////////////////////////////////////
+	void Update(float dt);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Remove all particles
+	///
+	////////////////////////////////////////////////////////////
+	void Clear();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of live particles
+	///
+	/// \returns Number of live particles
+	///
+	////////////////////////////////////////////////////////////
+	size_t GetNumParticles() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get max number of live particles
+	///
+	/// \returns Max number of live particles
+	///
+	////////////////////////////////////////////////////////////
+	size_t GetMaxParticles() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get X coordinates of live particles
+	///
+	/// \returns Pointer to GetNumParticles() X coordinates
+	///
+	////////////////////////////////////////////////////////////
+	const float* GetX() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get Y coordinates of live particles
+	///
+	/// \returns Pointer to GetNumParticles() Y coordinates
+	///
+	////////////////////////////////////////////////////////////
+	const float* GetY() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get remaining lifetimes of live particles
+	///
+	/// \returns Pointer to GetNumParticles() lifetimes
+	///
+	////////////////////////////////////////////////////////////
+	const float* GetLife() const;
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+	////////////////////////////////////////////////////////////
+	/// \brief Draw all particles with a single geometry call
+	///
+	/// \param[in] renderer Renderer to draw with
+	/// \param[in] texture Texture for particle quads, or nullptr
+	///                    for plain colored quads
+	/// \param[in] srcrect Part of texture to use, or NullOpt for
+	///                    the whole texture
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderGeometry
+	///
+	////////////////////////////////////////////////////////////
+	void Draw(Renderer& renderer, Texture* texture = nullptr, const Optional<Rect>& srcrect = NullOpt);
+#endif
+};
+
+}
+
+#endif
@@ -0,0 +1,481 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_PIXELVIEW_HH
+#define SDL2PP_PIXELVIEW_HH
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <SDL_stdinc.h>
+#include <SDL_pixels.h>
+
+#include <SDL2pp/Color.hh>
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/Texture.hh>
+
+namespace SDL2pp {
+
+////////////////////////////////////////////////////////////
+/// \brief Compile time description of packed pixel layout
+///
+/// \ingroup rendering
+///
+/// \headerfile SDL2pp/PixelView.hh
+///
+/// Channels narrower than 8 bits are expanded by bit
+/// replication, same as SDL_GetRGBA() does.
+///
+////////////////////////////////////////////////////////////
+template <class T, int RBits, int RShift, int GBits, int GShift, int BBits, int BShift, int ABits, int AShift>
+struct PackedPixelTraits {
+	typedef T PixelType; ///< Integer type holding one pixel
+
+	static constexpr bool HasAlpha = ABits > 0; ///< Whether format has alpha channel
+
+	////////////////////////////////////////////////////////////
+	/// \brief Expand channel value to 8 bits
+	///
+	/// \param[in] value Channel value
+	/// \param[in] bits Channel width in bits
+	///
+	/// \returns Channel value in [0, 255] range
+	///
+	////////////////////////////////////////////////////////////
+	static constexpr Uint8 Expand(Uint32 value, int bits) {
+		Uint32 result = 0;
+		for (int shift = 8 - bits; shift > -bits; shift -= bits)
+			result |= shift >= 0 ? value << shift : value >> -shift;
+		return static_cast<Uint8>(result);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Pack color channels into pixel value
+	///
+	/// \param[in] r Red component
+	/// \param[in] g Green component
+	/// \param[in] b Blue component
+	/// \param[in] a Alpha component, ignored if format has no alpha
+	///
+	/// \returns Pixel value
+	///
+	////////////////////////////////////////////////////////////
+	static constexpr T Pack(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+		return static_cast<T>(
+				(static_cast<Uint32>(r) >> (8 - RBits)) << RShift |
+				(static_cast<Uint32>(g) >> (8 - GBits)) << GShift |
+				(static_cast<Uint32>(b) >> (8 - BBits)) << BShift |
+				(HasAlpha ? (static_cast<Uint32>(a) >> (8 - ABits)) << AShift : 0)
+			);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Unpack pixel value into color
+	///
+	/// \param[in] pixel Pixel value
+	///
+	/// \returns Color of the pixel, opaque if format has no alpha
+	///
+	////////////////////////////////////////////////////////////
+	static constexpr Color Unpack(T pixel) {
+		return Color(
+				Expand((static_cast<Uint32>(pixel) >> RShift) & ((1u << RBits) - 1), RBits),
+				Expand((static_cast<Uint32>(pixel) >> GShift) & ((1u << GBits) - 1), GBits),
+				Expand((static_cast<Uint32>(pixel) >> BShift) & ((1u << BBits) - 1), BBits),
+				HasAlpha ? Expand((static_cast<Uint32>(pixel) >> AShift) & ((1u << ABits) - 1), ABits) : SDL_ALPHA_OPAQUE
+			);
+	}
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Pixel layout of SDL pixel format
+///
+/// \ingroup rendering
+///
+/// \headerfile SDL2pp/PixelView.hh
+///
+/// Only defined for packed formats with 8, 16 and 32 bit
+/// pixels; using other formats with PixelView is a compile
+/// error. Byte order aliases such as SDL_PIXELFORMAT_RGBA32
+/// map to one of these.
+///
+////////////////////////////////////////////////////////////
+template <Uint32 Format>
+struct PixelTraits;
+
+/// \cond
+template <> struct PixelTraits<SDL_PIXELFORMAT_RGB332> : PackedPixelTraits<Uint8, 3, 5, 3, 2, 2, 0, 0, 0> {};
+
+template <> struct PixelTraits<SDL_PIXELFORMAT_RGB444> : PackedPixelTraits<Uint16, 4, 8, 4, 4, 4, 0, 0, 0> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_RGB555> : PackedPixelTraits<Uint16, 5, 10, 5, 5, 5, 0, 0, 0> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_BGR555> : PackedPixelTraits<Uint16, 5, 0, 5, 5, 5, 10, 0, 0> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_ARGB4444> : PackedPixelTraits<Uint16, 4, 8, 4, 4, 4, 0, 4, 12> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_RGBA4444> : PackedPixelTraits<Uint16, 4, 12, 4, 8, 4, 4, 4, 0> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_ABGR4444> : PackedPixelTraits<Uint16, 4, 0, 4, 4, 4, 8, 4, 12> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_BGRA4444> : PackedPixelTraits<Uint16, 4, 4, 4, 8, 4, 12, 4, 0> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_ARGB1555> : PackedPixelTraits<Uint16, 5, 10, 5, 5, 5, 0, 1, 15> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_RGBA5551> : PackedPixelTraits<Uint16, 5, 11, 5, 6, 5, 1, 1, 0> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_ABGR1555> : PackedPixelTraits<Uint16, 5, 0, 5, 5, 5, 10, 1, 15> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_BGRA5551> : PackedPixelTraits<Uint16, 5, 1, 5, 6, 5, 11, 1, 0> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_RGB565> : PackedPixelTraits<Uint16, 5, 11, 6, 5, 5, 0, 0, 0> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_BGR565> : PackedPixelTraits<Uint16, 5, 0, 6, 5, 5, 11, 0, 0> {};
+
+template <> struct PixelTraits<SDL_PIXELFORMAT_RGB888> : PackedPixelTraits<Uint32, 8, 16, 8, 8, 8, 0, 0, 0> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_RGBX8888> : PackedPixelTraits<Uint32, 8, 24, 8, 16, 8, 8, 0, 0> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_BGR888> : PackedPixelTraits<Uint32, 8, 0, 8, 8, 8, 16, 0, 0> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_BGRX8888> : PackedPixelTraits<Uint32, 8, 8, 8, 16, 8, 24, 0, 0> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_ARGB8888> : PackedPixelTraits<Uint32, 8, 16, 8, 8, 8, 0, 8, 24> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_RGBA8888> : PackedPixelTraits<Uint32, 8, 24, 8, 16, 8, 8, 8, 0> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_ABGR8888> : PackedPixelTraits<Uint32, 8, 0, 8, 8, 8, 16, 8, 24> {};
+template <> struct PixelTraits<SDL_PIXELFORMAT_BGRA8888> : PackedPixelTraits<Uint32, 8, 8, 8, 16, 8, 24, 8, 0> {};
+/// \endcond
+
+////////////////////////////////////////////////////////////
+/// \brief Typed view of locked pixel data
+///
+/// \ingroup rendering
+///
+/// \headerfile SDL2pp/PixelView.hh
+///
+/// Gives access to pixels of locked Surface or Texture as
+/// arrays of integers of proper size, with pixel format
+/// known at compile time. Packing and unpacking of colors
+/// are thus reduced to constant shifts and masks, and the
+/// bulk algorithms (Fill(), Transform(), TransformColors())
+/// run plain loops over rows, which the compiler inlines
+/// and vectorizes.
+///
+/// Pixel access is not bounds checked. The view does not
+/// own the lock, which must outlive it.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::Surface surface(0, 256, 256, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+///     SDL2pp::Surface::LockHandle lock = surface.Lock();
+///     SDL2pp::PixelView<SDL_PIXELFORMAT_ARGB8888> pixels(lock);
+///
+///     // horizontal gradient
+///     for (int y = 0; y < pixels.GetHeight(); y++) {
+///         auto row = pixels.GetRow(y);
+///         for (int x = 0; x < row.size(); x++)
+///             row[x] = pixels.MapRGBA(x, 0, 0);
+///     }
+///
+///     // invert colors
+///     pixels.TransformColors([](const SDL2pp::Color& c) {
+///         return SDL2pp::Color(255 - c.r, 255 - c.g, 255 - c.b, c.a);
+///     });
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+template <Uint32 Format>
+class PixelView {
+public:
+	typedef PixelTraits<Format> Traits;              ///< Pixel layout
+	typedef typename Traits::PixelType PixelType;    ///< Integer type holding one pixel
+
+	////////////////////////////////////////////////////////////
+	/// \brief Single row of pixels
+	///
+	////////////////////////////////////////////////////////////
+	class Row {
+	private:
+		PixelType* pixels_; ///< Pointer to first pixel of the row
+		int width_;         ///< Number of pixels in the row
+
+	public:
+		////////////////////////////////////////////////////////////
+		/// \brief Construct row
+		///
+		/// \param[in] pixels Pointer to first pixel of the row
+		/// \param[in] width Number of pixels in the row
+		///
+		////////////////////////////////////////////////////////////
+		Row(PixelType* pixels, int width) : pixels_(pixels), width_(width) {
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get pointer to first pixel
+		///
+		/// \returns Pointer to first pixel
+		///
+		////////////////////////////////////////////////////////////
+		PixelType* begin() const {
+			return pixels_;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get pointer past the last pixel
+		///
+		/// \returns Pointer past the last pixel
+		///
+		////////////////////////////////////////////////////////////
+		PixelType* end() const {
+			return pixels_ + width_;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get number of pixels in the row
+		///
+		/// \returns Number of pixels in the row
+		///
+		////////////////////////////////////////////////////////////
+		int size() const {
+			return width_;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Access pixel
+		///
+		/// \param[in] x Pixel index
+		///
+		/// \returns Reference to pixel value
+		///
+		////////////////////////////////////////////////////////////
+		PixelType& operator[](int x) const {
+			return pixels_[x];
+		}
+	};
+
+private:
+	Uint8* pixels_;  ///< Pointer to first row
+	int pitch_;      ///< Number of bytes between rows
+	int width_;      ///< Width in pixels
+	int height_;     ///< Height in pixels
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Construct view of raw pixel data
+	///
+	/// \param[in] pixels Pointer to first pixel
+	/// \param[in] pitch Number of bytes in a row of pixel data,
+	///                  including padding between lines
+	/// \param[in] width Width in pixels
+	/// \param[in] height Height in pixels
+	///
+	////////////////////////////////////////////////////////////
+	PixelView(void* pixels, int pitch, int width, int height) : pixels_(static_cast<Uint8*>(pixels)), pitch_(pitch), width_(width), height_(height) {
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct view of locked surface
+	///
+	/// \param[in] lock Surface lock
+	///
+	/// \throws std::invalid_argument if surface format does not match
+	///
+	////////////////////////////////////////////////////////////
+	explicit PixelView(const Surface::LockHandle& lock) : PixelView(lock.GetPixels(), lock.GetPitch(), lock.GetSize().x, lock.GetSize().y) {
+		if (lock.GetFormat().format != Format)
+			throw std::invalid_argument("Surface pixel format does not match PixelView format");
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct view of locked texture region
+	///
+	/// \param[in] lock Texture lock
+	///
+	/// \throws std::invalid_argument if texture format does not match
+	///
+	////////////////////////////////////////////////////////////
+	explicit PixelView(const Texture::LockHandle& lock) : PixelView(lock.GetPixels(), lock.GetPitch(), lock.GetSize().x, lock.GetSize().y) {
+		if (lock.GetFormat() != Format)
+			throw std::invalid_argument("Texture pixel format does not match PixelView format");
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Map color components to pixel value
+	///
+	/// \param[in] r Red component
+	/// \param[in] g Green component
+	/// \param[in] b Blue component
+	/// \param[in] a Alpha component
+	///
+	/// \returns Pixel value
+	///
+	////////////////////////////////////////////////////////////
+	static constexpr PixelType MapRGBA(Uint8 r, Uint8 g, Uint8 b, Uint8 a = SDL_ALPHA_OPAQUE) {
+		return Traits::Pack(r, g, b, a);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Map color to pixel value
+	///
+	/// \param[in] color Color to map
+	///
+	/// \returns Pixel value
+	///
+	////////////////////////////////////////////////////////////
+	static constexpr PixelType MapColor(const Color& color) {
+		return Traits::Pack(color.r, color.g, color.b, color.a);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get color of pixel value
+	///
+	/// \param[in] pixel Pixel value
+	///
+	/// \returns Color of the pixel
+	///
+	////////////////////////////////////////////////////////////
+	static constexpr Color GetColor(PixelType pixel) {
+		return Traits::Unpack(pixel);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get width of the view
+	///
+	/// \returns Width in pixels
+	///
+	////////////////////////////////////////////////////////////
+	int GetWidth() const {
+		return width_;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get height of the view
+	///
+	/// \returns Height in pixels
+	///
+	////////////////////////////////////////////////////////////
+	int GetHeight() const {
+		return height_;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get size of the view
+	///
+	/// \returns SDL2pp::Point representing width and height in pixels
+	///
+	////////////////////////////////////////////////////////////
+	Point GetSize() const {
+		return Point(width_, height_);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get pitch of pixel data
+	///
+	/// \returns Number of bytes between rows
+	///
+	////////////////////////////////////////////////////////////
+	int GetPitch() const {
+		return pitch_;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get row of pixels
+	///
+	/// \param[in] y Row index
+	///
+	/// \returns Row of pixels
+	///
+	////////////////////////////////////////////////////////////
+	Row GetRow(int y) const {
+		return Row(reinterpret_cast<PixelType*>(pixels_ + y * pitch_), width_);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Access single pixel
+	///
+	/// \param[in] x X coordinate of the pixel
+	/// \param[in] y Y coordinate of the pixel
+	///
+	/// \returns Reference to pixel value
+	///
+	////////////////////////////////////////////////////////////
+	PixelType& operator()(int x, int y) const {
+		return reinterpret_cast<PixelType*>(pixels_ + y * pitch_)[x];
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Fill the whole view with pixel value
+	///
+	/// \param[in] pixel Pixel value
+	///
+	////////////////////////////////////////////////////////////
+	void Fill(PixelType pixel) const {
+		for (int y = 0; y < height_; y++) {
+			Row row = GetRow(y);
+			std::fill(row.begin(), row.end(), pixel);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Fill rectangle with pixel value
+	///
+	/// \param[in] rect Rectangle to fill, clipped to the view
+	/// \param[in] pixel Pixel value
+	///
+	////////////////////////////////////////////////////////////
+	void Fill(const Rect& rect, PixelType pixel) const {
+		const int x1 = std::max(rect.x, 0);
+		const int y1 = std::max(rect.y, 0);
+		const int x2 = std::min(rect.x + rect.w, width_);
+		const int y2 = std::min(rect.y + rect.h, height_);
+
+		if (x1 >= x2 || y1 >= y2)
+			return;
+
+		for (int y = y1; y < y2; y++) {
+			Row row = GetRow(y);
+			std::fill(row.begin() + x1, row.begin() + x2, pixel);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Replace each pixel value with result of a function
+	///
+	/// \param[in] func Function taking and returning PixelType
+	///
+	////////////////////////////////////////////////////////////
+	template <class F>
+	void Transform(F&& func) const {
+		for (int y = 0; y < height_; y++) {
+			PixelType* pixel = GetRow(y).begin();
+			for (int x = 0; x < width_; x++)
+				pixel[x] = func(pixel[x]);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Replace each pixel color with result of a function
+	///
+	/// Pixels are unpacked into Color and packed back, which
+	/// is inlined into the loop as constant shifts and masks
+	///
+	/// \param[in] func Function taking const Color& and returning Color
+	///
+	////////////////////////////////////////////////////////////
+	template <class F>
+	void TransformColors(F&& func) const {
+		Transform([&func](PixelType pixel) {
+				return MapColor(func(GetColor(pixel)));
+			});
+	}
+};
+
+}
+
+#endif
@@ -424,6 +424,9 @@ public:
 	Point& Wrap(const Rect& rect);
 };
 
+// arrays of Point are passed to SDL functions as arrays of SDL_Point
+static_assert(sizeof(Point) == sizeof(SDL_Point), "Point must be layout compatible with SDL_Point");
+
 }
 
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,184 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+
+#include <SDL2pp/PointArray.hh>
+
+namespace SDL2pp {
+
+PointArray::PointArray() {
+}
+
+PointArray::PointArray(const Point* points, size_t count) : x_(count), y_(count) {
+	for (size_t i = 0; i < count; i++) {
+		x_[i] = points[i].x;
+		y_[i] = points[i].y;
+	}
+}
+
+size_t PointArray::GetSize() const {
+	return x_.size();
+}
+
+bool PointArray::IsEmpty() const {
+	return x_.empty();
+}
+
+void PointArray::Reserve(size_t count) {
+	x_.reserve(count);
+	y_.reserve(count);
+}
+
+void PointArray::Resize(size_t count) {
+	x_.resize(count);
+	y_.resize(count);
+}
+
+void PointArray::Clear() {
+	x_.clear();
+	y_.clear();
+}
+
+void PointArray::Add(const Point& point) {
+	x_.push_back(point.x);
+	y_.push_back(point.y);
+}
+
+Point PointArray::Get(size_t index) const {
+	return Point(x_[index], y_[index]);
+}
+
+void PointArray::Set(size_t index, const Point& point) {
+	x_[index] = point.x;
+	y_[index] = point.y;
+}
+
+int* PointArray::GetX() {
+	return x_.data();
+}
+
+const int* PointArray::GetX() const {
+	return x_.data();
+}
+
+int* PointArray::GetY() {
+	return y_.data();
+}
+
+const int* PointArray::GetY() const {
+	return y_.data();
+}
+
+// Bulk operations below are kept as plain loops over
+// separate coordinate arrays, which compilers vectorize
+
+PointArray& PointArray::Translate(const Point& offset) {
+	int* x = x_.data();
+	int* y = y_.data();
+	const size_t size = x_.size();
+
+	for (size_t i = 0; i < size; i++)
+		x[i] += offset.x;
+	for (size_t i = 0; i < size; i++)
+		y[i] += offset.y;
+
+	return *this;
+}
+
+PointArray& PointArray::Scale(int factor) {
+	return Scale(Point(factor, factor));
+}
+
+PointArray& PointArray::Scale(const Point& factor) {
+	int* x = x_.data();
+	int* y = y_.data();
+	const size_t size = x_.size();
+
+	for (size_t i = 0; i < size; i++)
+		x[i] *= factor.x;
+	for (size_t i = 0; i < size; i++)
+		y[i] *= factor.y;
+
+	return *this;
+}
+
+PointArray& PointArray::Clip(const Rect& rect) {
+	int* x = x_.data();
+	int* y = y_.data();
+	const size_t size = x_.size();
+
+	const int x1 = rect.x, x2 = rect.GetX2();
+	const int y1 = rect.y, y2 = rect.GetY2();
+
+	// same order of checks as in Point::Clamp
+	for (size_t i = 0; i < size; i++)
+		x[i] = std::min(std::max(x[i], x1), x2);
+	for (size_t i = 0; i < size; i++)
+		y[i] = std::min(std::max(y[i], y1), y2);
+
+	return *this;
+}
+
+size_t PointArray::Cull(const Rect& rect) {
+	int* x = x_.data();
+	int* y = y_.data();
+	const size_t size = x_.size();
+
+	const int x1 = rect.x, x2 = rect.GetX2();
+	const int y1 = rect.y, y2 = rect.GetY2();
+
+	// branchless compaction: every point is written, but the
+	// output position only advances for points which are kept
+	size_t kept = 0;
+	for (size_t i = 0; i < size; i++) {
+		const int px = x[i], py = y[i];
+		x[kept] = px;
+		y[kept] = py;
+		kept += (px >= x1) & (px <= x2) & (py >= y1) & (py <= y2);
+	}
+
+	Resize(kept);
+	return kept;
+}
+
+void PointArray::ToAoS(Point* points) const {
+	const int* x = x_.data();
+	const int* y = y_.data();
+	const size_t size = x_.size();
+
+	for (size_t i = 0; i < size; i++) {
+		points[i].x = x[i];
+		points[i].y = y[i];
+	}
+}
+
+const Point* PointArray::GetAoS() const {
+	// only grows, so no allocation happens once buffer
+	// reaches the size of the array
+	if (aos_.size() < x_.size())
+		aos_.resize(x_.size());
+
+	ToAoS(aos_.data());
+	return aos_.data();
+}
+
+}
@@ -0,0 +1,269 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_POINTARRAY_HH
+#define SDL2PP_POINTARRAY_HH
+
+#include <cstddef>
+#include <vector>
+
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+////////////////////////////////////////////////////////////
+/// \brief Array of points stored as separate coordinate arrays
+///
+/// \ingroup geometry
+///
+/// \headerfile SDL2pp/PointArray.hh
+///
+/// Structure-of-arrays container for large sets of points,
+/// such as particle positions. X and Y coordinates are kept
+/// in separate contiguous arrays, so bulk operations are
+/// simple loops the compiler vectorizes.
+///
+/// Renderer::DrawPoints() accepts this array directly. Points
+/// are converted to the array-of-structures layout SDL needs
+/// in an internal scratch buffer, which is reused between
+/// calls, so drawing does not allocate once the buffer has
+/// grown to the array size.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::PointArray points;
+///     for (auto& particle : particles)
+///         points.Add(particle.GetPosition());
+///
+///     points.Translate(-camera.GetTopLeft());
+///     points.Cull(renderer.GetViewport());
+///
+///     renderer.DrawPoints(points);
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT PointArray {
+private:
+	std::vector<int> x_;              ///< X coordinates
+	std::vector<int> y_;              ///< Y coordinates
+	mutable std::vector<Point> aos_;  ///< Scratch buffer for GetAoS()
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Construct empty array
+	///
+	////////////////////////////////////////////////////////////
+	PointArray();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct array from array of points
+	///
+	/// \param[in] points Pointer to array of points
+	/// \param[in] count Number of points
+	///
+	////////////////////////////////////////////////////////////
+	PointArray(const Point* points, size_t count);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of points
+	///
+	/// \returns Number of points in the array
+	///
+	////////////////////////////////////////////////////////////
+	size_t GetSize() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check whether the array is empty
+	///
+	/// \returns True if there are no points in the array
+	///
+	////////////////////////////////////////////////////////////
+	bool IsEmpty() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Preallocate storage
+	///
+	/// \param[in] count Number of points to reserve space for
+	///
+	////////////////////////////////////////////////////////////
+	void Reserve(size_t count);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Change number of points
+	///
+	/// New points are initialized to (0, 0)
+	///
+	/// \param[in] count New number of points
+	///
+	////////////////////////////////////////////////////////////
+	void Resize(size_t count);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Remove all points
+	///
+	/// Allocated storage is kept for reuse
+	///
+	////////////////////////////////////////////////////////////
+	void Clear();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append point to the array
+	///
+	/// \param[in] point Point to append
+	///
+	////////////////////////////////////////////////////////////
+	void Add(const Point& point);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get point by index
+	///
+	/// \param[in] index Index of point
+	///
+	/// \returns Point at given index
+	///
+	////////////////////////////////////////////////////////////
+	Point Get(size_t index) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set point by index
+	///
+	/// \param[in] index Index of point
+	/// \param[in] point New point value
+	///
+	////////////////////////////////////////////////////////////
+	void Set(size_t index, const Point& point);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get pointer to X coordinates
+	///
+	/// \returns Pointer to GetSize() X coordinates
+	///
+	////////////////////////////////////////////////////////////
+	int* GetX();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get pointer to X coordinates
+	///
+	/// \returns Pointer to GetSize() X coordinates
+	///
+	////////////////////////////////////////////////////////////
+	const int* GetX() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get pointer to Y coordinates
+	///
+	/// \returns Pointer to GetSize() Y coordinates
+	///
+	////////////////////////////////////////////////////////////
+	int* GetY();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get pointer to Y coordinates
+	///
+	/// \returns Pointer to GetSize() Y coordinates
+	///
+	////////////////////////////////////////////////////////////
+	const int* GetY() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Move all points by given offset
+	///
+	/// \param[in] offset Offset to add to each point
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	PointArray& Translate(const Point& offset);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Multiply coordinates of all points
+	///
+	/// \param[in] factor Multiplier for both coordinates
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	PointArray& Scale(int factor);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Multiply coordinates of all points
+	///
+	/// \param[in] factor Multipliers for X and Y coordinates
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	PointArray& Scale(const Point& factor);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Clamp all points into given rectangle
+	///
+	/// \param[in] rect Rectangle to clamp points into
+	///
+	/// \returns Reference to self
+	///
+	/// \see Point::Clamp
+	///
+	////////////////////////////////////////////////////////////
+	PointArray& Clip(const Rect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Remove points outside of given rectangle
+	///
+	/// Order of remaining points is preserved
+	///
+	/// \param[in] rect Rectangle to test points against
+	///
+	/// \returns Number of remaining points
+	///
+	/// \see Rect::Contains
+	///
+	////////////////////////////////////////////////////////////
+	size_t Cull(const Rect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Convert to array of points
+	///
+	/// \param[out] points Array of at least GetSize() points
+	///
+	////////////////////////////////////////////////////////////
+	void ToAoS(Point* points) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Convert to array of points in internal buffer
+	///
+	/// \returns Pointer to GetSize() points, valid until next
+	///          call or modification of the array
+	///
+	/// \note As internal buffer is shared, this must not be
+	///       called concurrently on the same array
+	///
+	////////////////////////////////////////////////////////////
+	const Point* GetAoS() const;
+};
+
+}
+
+#endif
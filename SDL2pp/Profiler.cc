@@ -0,0 +1,157 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <SDL2pp/Profiler.hh>
+
+#ifdef SDL2PP_WITH_PROFILER
+#	include <atomic>
+#	include <deque>
+#	include <iomanip>
+#	include <ostream>
+#endif
+
+namespace SDL2pp {
+
+namespace {
+
+const char* const counter_names[] = {
+	"Renderer::Copy",
+	"Renderer::FillRect",
+	"Renderer::FillRects",
+	"Renderer::Present",
+	"Texture::Update",
+	"Texture::Lock",
+	"Surface::Blit",
+	"Surface::Convert",
+	"Font::Render",
+};
+
+static_assert(sizeof(counter_names) / sizeof(counter_names[0]) == static_cast<size_t>(Profiler::Counter::NumCounters), "counter names do not match counters");
+
+#ifdef SDL2PP_WITH_PROFILER
+constexpr size_t num_counters = static_cast<size_t>(Profiler::Counter::NumCounters);
+
+struct FrameRecord {
+	Uint64 start;                  ///< Performance counter value at frame start
+	Uint64 end;                    ///< Performance counter value at frame end
+	Uint64 calls[num_counters];    ///< Number of calls per counter
+	Uint64 ticks[num_counters];    ///< Time spent per counter
+};
+
+std::atomic<Uint64> current_calls[num_counters];
+std::atomic<Uint64> current_ticks[num_counters];
+
+std::deque<FrameRecord> frames;
+size_t max_frames = 1000;
+Uint64 frame_start = SDL_GetPerformanceCounter();
+
+Uint64 TicksToNanoseconds(Uint64 ticks) {
+	static const Uint64 frequency = SDL_GetPerformanceFrequency();
+	return static_cast<Uint64>(static_cast<double>(ticks) * 1000000000.0 / static_cast<double>(frequency));
+}
+
+double TicksToMicroseconds(Uint64 ticks) {
+	return static_cast<double>(TicksToNanoseconds(ticks)) / 1000.0;
+}
+#endif
+
+}
+
+const char* Profiler::GetCounterName(Counter counter) {
+	return counter_names[static_cast<size_t>(counter)];
+}
+
+#ifdef SDL2PP_WITH_PROFILER
+void Profiler::Record(Counter counter, Uint64 ticks) {
+	// only totals matter, so no ordering is needed
+	current_calls[static_cast<size_t>(counter)].fetch_add(1, std::memory_order_relaxed);
+	current_ticks[static_cast<size_t>(counter)].fetch_add(ticks, std::memory_order_relaxed);
+}
+
+void Profiler::EndFrame() {
+	FrameRecord record;
+	record.start = frame_start;
+	record.end = frame_start = SDL_GetPerformanceCounter();
+
+	for (size_t i = 0; i < num_counters; i++) {
+		record.calls[i] = current_calls[i].exchange(0, std::memory_order_relaxed);
+		record.ticks[i] = current_ticks[i].exchange(0, std::memory_order_relaxed);
+	}
+
+	frames.push_back(record);
+	while (frames.size() > max_frames)
+		frames.pop_front();
+}
+
+void Profiler::Reset() {
+	for (size_t i = 0; i < num_counters; i++) {
+		current_calls[i].store(0, std::memory_order_relaxed);
+		current_ticks[i].store(0, std::memory_order_relaxed);
+	}
+
+	frames.clear();
+	frame_start = SDL_GetPerformanceCounter();
+}
+
+void Profiler::SetMaxFrames(size_t new_max_frames) {
+	max_frames = new_max_frames;
+	while (frames.size() > max_frames)
+		frames.pop_front();
+}
+
+Profiler::CounterStats Profiler::GetLastFrame(Counter counter) {
+	if (frames.empty())
+		return CounterStats{0, 0};
+
+	const FrameRecord& last = frames.back();
+	return CounterStats{last.calls[static_cast<size_t>(counter)], TicksToNanoseconds(last.ticks[static_cast<size_t>(counter)])};
+}
+
+void Profiler::WriteChromeTrace(std::ostream& stream) {
+	const Uint64 origin = frames.empty() ? 0 : frames.front().start;
+
+	// default stream formatting switches to exponent notation
+	// for timestamps over a second
+	std::ios_base::fmtflags flags = stream.flags();
+	std::streamsize precision = stream.precision();
+	stream << std::fixed << std::setprecision(3);
+
+	stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	bool first = true;
+	for (const FrameRecord& frame : frames) {
+		const double ts = TicksToMicroseconds(frame.start - origin);
+
+		stream << (first ? "" : ",") << "\n{\"name\":\"Frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << ts << ",\"dur\":" << TicksToMicroseconds(frame.end - frame.start) << "}";
+		first = false;
+
+		for (size_t i = 0; i < num_counters; i++)
+			stream << ",\n{\"name\":\"" << counter_names[i] << "\",\"ph\":\"C\",\"pid\":1,\"ts\":" << ts << ",\"args\":{\"calls\":" << frame.calls[i] << ",\"us\":" << TicksToMicroseconds(frame.ticks[i]) << "}}";
+	}
+
+	stream << "\n]}\n";
+
+	stream.flags(flags);
+	stream.precision(precision);
+}
+#endif
+
+}
@@ -0,0 +1,233 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_PROFILER_HH
+#define SDL2PP_PROFILER_HH
+
+#include <iosfwd>
+
+#include <SDL_stdinc.h>
+#include <SDL_timer.h>
+
+#include <SDL2pp/Config.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+////////////////////////////////////////////////////////////
+/// \brief Instrumentation of costly library calls
+///
+/// \ingroup general
+///
+/// \headerfile SDL2pp/Profiler.hh
+///
+/// When the library is built with SDL2PP_WITH_PROFILER
+/// option, calls to Renderer::Copy(), Renderer::FillRect(),
+/// Renderer::FillRects(), Renderer::Present(),
+/// Texture::Update(), Texture::Lock(), Surface::Blit(),
+/// Surface::Convert() and Font::Render*() are counted and
+/// timed. Counters are lock-free atomics, so calls from
+/// any thread are accounted.
+///
+/// Counters are accumulated until EndFrame() is called, which
+/// stores them into the frame history. History may be dumped
+/// in Chrome trace event format and viewed in chrome://tracing
+/// or Perfetto.
+///
+/// Without SDL2PP_WITH_PROFILER, all methods are inline no-ops
+/// and library functions contain no instrumentation at all.
+///
+/// EndFrame(), Reset(), SetMaxFrames(), GetLastFrame() and
+/// WriteChromeTrace() must be called from a single thread.
+///
+/// Usage example:
+/// \code
+/// {
+///     while (running) {
+///         // render frame
+///         renderer.Present();
+///         SDL2pp::Profiler::EndFrame();
+///     }
+///
+///     std::ofstream trace("trace.json");
+///     SDL2pp::Profiler::WriteChromeTrace(trace);
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT Profiler {
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Instrumented operations
+	///
+	////////////////////////////////////////////////////////////
+	enum class Counter {
+		RendererCopy,      ///< Renderer::Copy()
+		RendererFillRect,  ///< Renderer::FillRect()
+		RendererFillRects, ///< Renderer::FillRects()
+		RendererPresent,   ///< Renderer::Present()
+		TextureUpdate,     ///< Texture::Update() and Texture::UpdateYUV()
+		TextureLock,       ///< Texture::Lock()
+		SurfaceBlit,       ///< Surface::Blit() and Surface::BlitScaled()
+		SurfaceConvert,    ///< Surface::Convert()
+		FontRender,        ///< Font::Render*()
+
+		NumCounters,       ///< Number of counters
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Accumulated statistics for a counter
+	///
+	////////////////////////////////////////////////////////////
+	struct CounterStats {
+		Uint64 calls;       ///< Number of calls
+		Uint64 nanoseconds; ///< Total time spent in calls
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Times a scope and records it into a counter
+	///
+	////////////////////////////////////////////////////////////
+	class ScopedTimer {
+#ifdef SDL2PP_WITH_PROFILER
+	private:
+		Counter counter_; ///< Counter to record into
+		Uint64 start_;    ///< Performance counter value at scope entry
+
+	public:
+		////////////////////////////////////////////////////////////
+		/// \brief Start timing
+		///
+		/// \param[in] counter Counter to record into
+		///
+		////////////////////////////////////////////////////////////
+		explicit ScopedTimer(Counter counter) : counter_(counter), start_(SDL_GetPerformanceCounter()) {
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Stop timing and record
+		///
+		////////////////////////////////////////////////////////////
+		~ScopedTimer() {
+			Profiler::Record(counter_, SDL_GetPerformanceCounter() - start_);
+		}
+#else
+	public:
+		explicit ScopedTimer(Counter) {
+		}
+#endif
+
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+	};
+
+public:
+	Profiler() = delete;
+
+#ifdef SDL2PP_WITH_PROFILER
+	////////////////////////////////////////////////////////////
+	/// \brief Record a call
+	///
+	/// \param[in] counter Counter to record into
+	/// \param[in] ticks Duration of the call in performance
+	///                  counter ticks
+	///
+	/// \see http://wiki.libsdl.org/SDL_GetPerformanceCounter
+	///
+	////////////////////////////////////////////////////////////
+	static void Record(Counter counter, Uint64 ticks);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Finish current frame
+	///
+	/// Stores counters accumulated since previous call into
+	/// frame history and resets them
+	///
+	////////////////////////////////////////////////////////////
+	static void EndFrame();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Clear counters and frame history
+	///
+	////////////////////////////////////////////////////////////
+	static void Reset();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set maximal number of frames kept in history
+	///
+	/// \param[in] max_frames Number of frames, oldest frames are
+	///                       discarded when exceeded
+	///
+	////////////////////////////////////////////////////////////
+	static void SetMaxFrames(size_t max_frames);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get statistics of last finished frame
+	///
+	/// \param[in] counter Counter to get statistics for
+	///
+	/// \returns Number of calls and time spent in them
+	///
+	////////////////////////////////////////////////////////////
+	static CounterStats GetLastFrame(Counter counter);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Write frame history in Chrome trace event format
+	///
+	/// Each frame is written as a complete event, and each
+	/// counter as a counter event with number of calls and
+	/// time in microseconds
+	///
+	/// \param[in] stream Stream to write JSON into
+	///
+	/// \see https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+	///
+	////////////////////////////////////////////////////////////
+	static void WriteChromeTrace(std::ostream& stream);
+#else
+	static void Record(Counter, Uint64) {}
+	static void EndFrame() {}
+	static void Reset() {}
+	static void SetMaxFrames(size_t) {}
+	static CounterStats GetLastFrame(Counter) { return CounterStats{0, 0}; }
+	static void WriteChromeTrace(std::ostream&) {}
+#endif
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get human readable name of a counter
+	///
+	/// \param[in] counter Counter to get name of
+	///
+	/// \returns Name of instrumented function
+	///
+	////////////////////////////////////////////////////////////
+	static const char* GetCounterName(Counter counter);
+};
+
+}
+
+#ifdef SDL2PP_WITH_PROFILER
+#	define SDL2PP_PROFILE_SCOPE(counter) ::SDL2pp::Profiler::ScopedTimer sdl2pp_profile_scope_(::SDL2pp::Profiler::Counter::counter)
+#else
+#	define SDL2PP_PROFILE_SCOPE(counter) ((void)0)
+#endif
+
+#endif
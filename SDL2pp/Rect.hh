@@ -22,6 +22,7 @@
 #ifndef SDL2PP_RECT_HH
 #define SDL2PP_RECT_HH
 
+#include <cstddef>
 #include <functional>
 
 #include <SDL_rect.h>
@@ -531,6 +532,104 @@ public:
 	////////////////////////////////////////////////////////////
 	bool IntersectLine(Point& p1, Point& p2) const;
 
+	////////////////////////////////////////////////////////////
+	/// \brief Find rectangles which intersect this rect
+	///
+	/// Batch version of Intersects(), suitable for culling
+	/// large sets of sprites against the viewport. Tests are
+	/// branchless, so the loop is vectorized by the compiler.
+	///
+	/// \param[in] rects Array of rectangles to test
+	/// \param[in] count Number of rectangles
+	/// \param[out] indices Array of at least count elements which
+	///                     receives indices of intersecting rectangles
+	///                     in ascending order
+	///
+	/// \returns Number of intersecting rectangles
+	///
+	/// \see Intersects
+	///
+	////////////////////////////////////////////////////////////
+	size_t FindIntersecting(const Rect* rects, size_t count, size_t* indices) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Find rectangles which are contained in this rect
+	///
+	/// Batch version of Contains()
+	///
+	/// \param[in] rects Array of rectangles to test
+	/// \param[in] count Number of rectangles
+	/// \param[out] indices Array of at least count elements which
+	///                     receives indices of contained rectangles
+	///                     in ascending order
+	///
+	/// \returns Number of contained rectangles
+	///
+	/// \see Contains
+	///
+	////////////////////////////////////////////////////////////
+	size_t FindContained(const Rect* rects, size_t count, size_t* indices) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Build bitmask of rectangles which intersect this rect
+	///
+	/// Batch version of Intersects()
+	///
+	/// \param[in] rects Array of rectangles to test
+	/// \param[in] count Number of rectangles
+	/// \param[out] mask Array of at least (count + 63) / 64 words;
+	///                  bit (i % 64) of word (i / 64) is set if
+	///                  i-th rectangle intersects this rect
+	///
+	/// \returns Number of intersecting rectangles
+	///
+	/// \see Intersects
+	///
+	////////////////////////////////////////////////////////////
+	size_t GetIntersectsMask(const Rect* rects, size_t count, Uint64* mask) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Build bitmask of rectangles which are contained in this rect
+	///
+	/// Batch version of Contains()
+	///
+	/// \param[in] rects Array of rectangles to test
+	/// \param[in] count Number of rectangles
+	/// \param[out] mask Array of at least (count + 63) / 64 words;
+	///                  bit (i % 64) of word (i / 64) is set if
+	///                  i-th rectangle is contained in this rect
+	///
+	/// \returns Number of contained rectangles
+	///
+	/// \see Contains
+	///
+	////////////////////////////////////////////////////////////
+	size_t GetContainsMask(const Rect* rects, size_t count, Uint64* mask) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Calculate the intersection of a rectangle and multiple line segments
+	///
+	/// Batch version of IntersectLine(). Segments entirely
+	/// inside or entirely on one side of the rectangle are
+	/// classified in a vectorized pass, and only the rest
+	/// are clipped individually.
+	///
+	/// \param[in,out] lines Array of 2 * count points, pairs of
+	///                      starting and ending coordinates of
+	///                      line segments, which are clipped in place
+	/// \param[in] count Number of line segments
+	/// \param[out] mask Array of at least (count + 63) / 64 words
+	///                  which receives bitmask of visible segments
+	///                  (same layout as in GetIntersectsMask()),
+	///                  or nullptr if not needed
+	///
+	/// \returns Number of segments intersecting the rectangle
+	///
+	/// \see IntersectLine
+	///
+	////////////////////////////////////////////////////////////
+	size_t IntersectLines(Point* lines, size_t count, Uint64* mask = nullptr) const;
+
 	////////////////////////////////////////////////////////////
 	/// \brief Get rectangle moved by a given offset
 	///
@@ -584,6 +683,9 @@ public:
 	}
 };
 
+// arrays of Rect are passed to SDL functions as arrays of SDL_Rect
+static_assert(sizeof(Rect) == sizeof(SDL_Rect), "Rect must be layout compatible with SDL_Rect");
+
 }
 
 ////////////////////////////////////////////////////////////
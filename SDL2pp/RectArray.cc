@@ -0,0 +1,238 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+
+#include <SDL2pp/RectArray.hh>
+
+namespace SDL2pp {
+
+RectArray::RectArray() {
+}
+
+RectArray::RectArray(const Rect* rects, size_t count) : x_(count), y_(count), w_(count), h_(count) {
+	for (size_t i = 0; i < count; i++) {
+		x_[i] = rects[i].x;
+		y_[i] = rects[i].y;
+		w_[i] = rects[i].w;
+		h_[i] = rects[i].h;
+	}
+}
+
+size_t RectArray::GetSize() const {
+	return x_.size();
+}
+
+bool RectArray::IsEmpty() const {
+	return x_.empty();
+}
+
+void RectArray::Reserve(size_t count) {
+	x_.reserve(count);
+	y_.reserve(count);
+	w_.reserve(count);
+	h_.reserve(count);
+}
+
+void RectArray::Resize(size_t count) {
+	x_.resize(count);
+	y_.resize(count);
+	w_.resize(count);
+	h_.resize(count);
+}
+
+void RectArray::Clear() {
+	x_.clear();
+	y_.clear();
+	w_.clear();
+	h_.clear();
+}
+
+void RectArray::Add(const Rect& rect) {
+	x_.push_back(rect.x);
+	y_.push_back(rect.y);
+	w_.push_back(rect.w);
+	h_.push_back(rect.h);
+}
+
+Rect RectArray::Get(size_t index) const {
+	return Rect(x_[index], y_[index], w_[index], h_[index]);
+}
+
+void RectArray::Set(size_t index, const Rect& rect) {
+	x_[index] = rect.x;
+	y_[index] = rect.y;
+	w_[index] = rect.w;
+	h_[index] = rect.h;
+}
+
+int* RectArray::GetX() {
+	return x_.data();
+}
+
+const int* RectArray::GetX() const {
+	return x_.data();
+}
+
+int* RectArray::GetY() {
+	return y_.data();
+}
+
+const int* RectArray::GetY() const {
+	return y_.data();
+}
+
+int* RectArray::GetW() {
+	return w_.data();
+}
+
+const int* RectArray::GetW() const {
+	return w_.data();
+}
+
+int* RectArray::GetH() {
+	return h_.data();
+}
+
+const int* RectArray::GetH() const {
+	return h_.data();
+}
+
+// Bulk operations below are kept as plain loops over
+// separate component arrays, which compilers vectorize
+
+RectArray& RectArray::Translate(const Point& offset) {
+	int* x = x_.data();
+	int* y = y_.data();
+	const size_t size = x_.size();
+
+	for (size_t i = 0; i < size; i++)
+		x[i] += offset.x;
+	for (size_t i = 0; i < size; i++)
+		y[i] += offset.y;
+
+	return *this;
+}
+
+RectArray& RectArray::Scale(int factor) {
+	return Scale(Point(factor, factor));
+}
+
+RectArray& RectArray::Scale(const Point& factor) {
+	int* x = x_.data();
+	int* y = y_.data();
+	int* w = w_.data();
+	int* h = h_.data();
+	const size_t size = x_.size();
+
+	for (size_t i = 0; i < size; i++)
+		x[i] *= factor.x;
+	for (size_t i = 0; i < size; i++)
+		w[i] *= factor.x;
+	for (size_t i = 0; i < size; i++)
+		y[i] *= factor.y;
+	for (size_t i = 0; i < size; i++)
+		h[i] *= factor.y;
+
+	return *this;
+}
+
+RectArray& RectArray::Clip(const Rect& rect) {
+	int* x = x_.data();
+	int* y = y_.data();
+	int* w = w_.data();
+	int* h = h_.data();
+	const size_t size = x_.size();
+
+	const int cx1 = rect.x, cx2 = rect.GetX2();
+	const int cy1 = rect.y, cy2 = rect.GetY2();
+
+	// same as Rect::GetIntersection, but empty intersection
+	// yields zero size instead of no rectangle
+	for (size_t i = 0; i < size; i++) {
+		const int x1 = std::max(x[i], cx1);
+		const int x2 = std::min(x[i] + w[i] - 1, cx2);
+		x[i] = x1;
+		w[i] = std::max(x2 - x1 + 1, 0);
+	}
+	for (size_t i = 0; i < size; i++) {
+		const int y1 = std::max(y[i], cy1);
+		const int y2 = std::min(y[i] + h[i] - 1, cy2);
+		y[i] = y1;
+		h[i] = std::max(y2 - y1 + 1, 0);
+	}
+
+	return *this;
+}
+
+size_t RectArray::Cull(const Rect& rect) {
+	int* x = x_.data();
+	int* y = y_.data();
+	int* w = w_.data();
+	int* h = h_.data();
+	const size_t size = x_.size();
+
+	const int cx1 = rect.x, cx2 = rect.GetX2();
+	const int cy1 = rect.y, cy2 = rect.GetY2();
+
+	// branchless compaction with Rect::Intersects condition: every
+	// rectangle is written, but the output position only advances
+	// for rectangles which are kept
+	size_t kept = 0;
+	for (size_t i = 0; i < size; i++) {
+		const int rx = x[i], ry = y[i], rw = w[i], rh = h[i];
+		x[kept] = rx;
+		y[kept] = ry;
+		w[kept] = rw;
+		h[kept] = rh;
+		kept += (rx + rw - 1 >= cx1) & (ry + rh - 1 >= cy1) & (rx <= cx2) & (ry <= cy2);
+	}
+
+	Resize(kept);
+	return kept;
+}
+
+void RectArray::ToAoS(Rect* rects) const {
+	const int* x = x_.data();
+	const int* y = y_.data();
+	const int* w = w_.data();
+	const int* h = h_.data();
+	const size_t size = x_.size();
+
+	for (size_t i = 0; i < size; i++) {
+		rects[i].x = x[i];
+		rects[i].y = y[i];
+		rects[i].w = w[i];
+		rects[i].h = h[i];
+	}
+}
+
+const Rect* RectArray::GetAoS() const {
+	// only grows, so no allocation happens once buffer
+	// reaches the size of the array
+	if (aos_.size() < x_.size())
+		aos_.resize(x_.size());
+
+	ToAoS(aos_.data());
+	return aos_.data();
+}
+
+}
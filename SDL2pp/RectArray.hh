@@ -0,0 +1,307 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_RECTARRAY_HH
+#define SDL2PP_RECTARRAY_HH
+
+#include <cstddef>
+#include <vector>
+
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+////////////////////////////////////////////////////////////
+/// \brief Array of rectangles stored as separate component arrays
+///
+/// \ingroup geometry
+///
+/// \headerfile SDL2pp/RectArray.hh
+///
+/// Structure-of-arrays container for large sets of rectangles,
+/// such as debug overlays or sprite bounds. Positions and sizes
+/// are kept in separate contiguous arrays, so bulk operations
+/// are simple loops the compiler vectorizes.
+///
+/// Renderer::FillRects() and Renderer::DrawRects() accept this
+/// array directly. Rectangles are converted to the
+/// array-of-structures layout SDL needs in an internal scratch
+/// buffer, which is reused between calls, so drawing does not
+/// allocate once the buffer has grown to the array size.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::RectArray rects;
+///     for (auto& object : objects)
+///         rects.Add(object.GetBounds());
+///
+///     rects.Translate(-camera.GetTopLeft());
+///     rects.Cull(renderer.GetViewport());
+///
+///     renderer.DrawRects(rects);
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT RectArray {
+private:
+	std::vector<int> x_;             ///< X coordinates of top left corners
+	std::vector<int> y_;             ///< Y coordinates of top left corners
+	std::vector<int> w_;             ///< Widths
+	std::vector<int> h_;             ///< Heights
+	mutable std::vector<Rect> aos_;  ///< Scratch buffer for GetAoS()
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Construct empty array
+	///
+	////////////////////////////////////////////////////////////
+	RectArray();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct array from array of rectangles
+	///
+	/// \param[in] rects Pointer to array of rectangles
+	/// \param[in] count Number of rectangles
+	///
+	////////////////////////////////////////////////////////////
+	RectArray(const Rect* rects, size_t count);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of rectangles
+	///
+	/// \returns Number of rectangles in the array
+	///
+	////////////////////////////////////////////////////////////
+	size_t GetSize() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check whether the array is empty
+	///
+	/// \returns True if there are no rectangles in the array
+	///
+	////////////////////////////////////////////////////////////
+	bool IsEmpty() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Preallocate storage
+	///
+	/// \param[in] count Number of rectangles to reserve space for
+	///
+	////////////////////////////////////////////////////////////
+	void Reserve(size_t count);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Change number of rectangles
+	///
+	/// New rectangles are initialized to (0, 0, 0, 0)
+	///
+	/// \param[in] count New number of rectangles
+	///
+	////////////////////////////////////////////////////////////
+	void Resize(size_t count);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Remove all rectangles
+	///
+	/// Allocated storage is kept for reuse
+	///
+	////////////////////////////////////////////////////////////
+	void Clear();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append rectangle to the array
+	///
+	/// \param[in] rect Rectangle to append
+	///
+	////////////////////////////////////////////////////////////
+	void Add(const Rect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get rectangle by index
+	///
+	/// \param[in] index Index of rectangle
+	///
+	/// \returns Rectangle at given index
+	///
+	////////////////////////////////////////////////////////////
+	Rect Get(size_t index) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set rectangle by index
+	///
+	/// \param[in] index Index of rectangle
+	/// \param[in] rect New rectangle value
+	///
+	////////////////////////////////////////////////////////////
+	void Set(size_t index, const Rect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get pointer to X coordinates
+	///
+	/// \returns Pointer to GetSize() X coordinates
+	///
+	////////////////////////////////////////////////////////////
+	int* GetX();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get pointer to X coordinates
+	///
+	/// \returns Pointer to GetSize() X coordinates
+	///
+	////////////////////////////////////////////////////////////
+	const int* GetX() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get pointer to Y coordinates
+	///
+	/// \returns Pointer to GetSize() Y coordinates
+	///
+	////////////////////////////////////////////////////////////
+	int* GetY();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get pointer to Y coordinates
+	///
+	/// \returns Pointer to GetSize() Y coordinates
+	///
+	////////////////////////////////////////////////////////////
+	const int* GetY() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get pointer to widths
+	///
+	/// \returns Pointer to GetSize() widths
+	///
+	////////////////////////////////////////////////////////////
+	int* GetW();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get pointer to widths
+	///
+	/// \returns Pointer to GetSize() widths
+	///
+	////////////////////////////////////////////////////////////
+	const int* GetW() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get pointer to heights
+	///
+	/// \returns Pointer to GetSize() heights
+	///
+	////////////////////////////////////////////////////////////
+	int* GetH();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get pointer to heights
+	///
+	/// \returns Pointer to GetSize() heights
+	///
+	////////////////////////////////////////////////////////////
+	const int* GetH() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Move all rectangles by given offset
+	///
+	/// \param[in] offset Offset to add to each rectangle
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	RectArray& Translate(const Point& offset);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Multiply coordinates and sizes of all rectangles
+	///
+	/// \param[in] factor Multiplier for both dimensions
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	RectArray& Scale(int factor);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Multiply coordinates and sizes of all rectangles
+	///
+	/// \param[in] factor Multipliers for horizontal and vertical
+	///                   dimensions
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	RectArray& Scale(const Point& factor);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Intersect all rectangles with given rectangle
+	///
+	/// Rectangles which do not intersect given one get zero
+	/// size; use Cull() to remove them instead.
+	///
+	/// \param[in] rect Rectangle to clip rectangles to
+	///
+	/// \returns Reference to self
+	///
+	/// \see Rect::GetIntersection
+	///
+	////////////////////////////////////////////////////////////
+	RectArray& Clip(const Rect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Remove rectangles which do not intersect given rectangle
+	///
+	/// Order of remaining rectangles is preserved
+	///
+	/// \param[in] rect Rectangle to test rectangles against
+	///
+	/// \returns Number of remaining rectangles
+	///
+	/// \see Rect::Intersects
+	///
+	////////////////////////////////////////////////////////////
+	size_t Cull(const Rect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Convert to array of rectangles
+	///
+	/// \param[out] rects Array of at least GetSize() rectangles
+	///
+	////////////////////////////////////////////////////////////
+	void ToAoS(Rect* rects) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Convert to array of rectangles in internal buffer
+	///
+	/// \returns Pointer to GetSize() rectangles, valid until next
+	///          call or modification of the array
+	///
+	/// \note As internal buffer is shared, this must not be
+	///       called concurrently on the same array
+	///
+	////////////////////////////////////////////////////////////
+	const Rect* GetAoS() const;
+};
+
+}
+
+#endif
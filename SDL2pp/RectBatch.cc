@@ -0,0 +1,166 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+
+#include <SDL_rect.h>
+
+#include <SDL2pp/Rect.hh>
+
+namespace SDL2pp {
+
+namespace {
+
+// Rects are processed in blocks of 64: first, all rects of a
+// block are tested into a byte array, which is a branchless loop
+// the compiler vectorizes, then results are packed into a mask
+// word or compacted into an index list
+const size_t block_size = 64;
+
+template <class Test>
+unsigned int TestBlock(const Rect* rects, size_t count, unsigned char* matches, Test test) {
+	unsigned int found = 0;
+	for (size_t i = 0; i < count; i++) {
+		matches[i] = static_cast<unsigned char>(test(rects[i]));
+		found += matches[i];
+	}
+	return found;
+}
+
+// Packs 64 bytes of 0 or 1 into bits of a word, 8 at a time:
+// multiplication moves byte k into bit 56 + k without carries
+Uint64 PackBlock(const unsigned char* matches) {
+	Uint64 word = 0;
+	for (size_t i = 0; i < block_size; i += 8) {
+		Uint64 bytes = 0;
+		for (size_t k = 0; k < 8; k++)
+			bytes |= static_cast<Uint64>(matches[i + k]) << (k * 8);
+		word |= ((bytes * 0x0102040810204080ULL) >> 56) << i;
+	}
+	return word;
+}
+
+template <class Test>
+size_t FindMatching(const Rect* rects, size_t count, size_t* indices, Test test) {
+	unsigned char matches[block_size];
+
+	size_t found = 0;
+	for (size_t base = 0; base < count; base += block_size) {
+		const size_t block = std::min(count - base, block_size);
+		TestBlock(rects + base, block, matches, test);
+
+		// every index is written, but output position only
+		// advances for matching rects
+		for (size_t i = 0; i < block; i++) {
+			indices[found] = base + i;
+			found += matches[i];
+		}
+	}
+	return found;
+}
+
+template <class Test>
+size_t BuildMask(const Rect* rects, size_t count, Uint64* mask, Test test) {
+	unsigned char matches[block_size];
+
+	size_t found = 0;
+	for (size_t base = 0; base < count; base += block_size) {
+		const size_t block = std::min(count - base, block_size);
+		std::fill(matches + block, matches + block_size, 0);
+		found += TestBlock(rects + base, block, matches, test);
+		mask[base / block_size] = PackBlock(matches);
+	}
+	return found;
+}
+
+}
+
+size_t Rect::FindIntersecting(const Rect* rects, size_t count, size_t* indices) const {
+	const int x1 = x, y1 = y, x2 = GetX2(), y2 = GetY2();
+	return FindMatching(rects, count, indices, [=](const Rect& r) -> unsigned int {
+			return (r.x + r.w - 1 >= x1) & (r.y + r.h - 1 >= y1) & (r.x <= x2) & (r.y <= y2);
+		});
+}
+
+size_t Rect::FindContained(const Rect* rects, size_t count, size_t* indices) const {
+	const int x1 = x, y1 = y, x2 = GetX2(), y2 = GetY2();
+	return FindMatching(rects, count, indices, [=](const Rect& r) -> unsigned int {
+			return (r.x >= x1) & (r.y >= y1) & (r.x + r.w - 1 <= x2) & (r.y + r.h - 1 <= y2);
+		});
+}
+
+size_t Rect::GetIntersectsMask(const Rect* rects, size_t count, Uint64* mask) const {
+	const int x1 = x, y1 = y, x2 = GetX2(), y2 = GetY2();
+	return BuildMask(rects, count, mask, [=](const Rect& r) -> unsigned int {
+			return (r.x + r.w - 1 >= x1) & (r.y + r.h - 1 >= y1) & (r.x <= x2) & (r.y <= y2);
+		});
+}
+
+size_t Rect::GetContainsMask(const Rect* rects, size_t count, Uint64* mask) const {
+	const int x1 = x, y1 = y, x2 = GetX2(), y2 = GetY2();
+	return BuildMask(rects, count, mask, [=](const Rect& r) -> unsigned int {
+			return (r.x >= x1) & (r.y >= y1) & (r.x + r.w - 1 <= x2) & (r.y + r.h - 1 <= y2);
+		});
+}
+
+size_t Rect::IntersectLines(Point* lines, size_t count, Uint64* mask) const {
+	const int x1 = x, y1 = y, x2 = GetX2(), y2 = GetY2();
+	const bool empty = w <= 0 || h <= 0;
+
+	size_t found = 0;
+	for (size_t base = 0; base < count; base += block_size) {
+		const size_t block = std::min(count - base, block_size);
+		Point* points = lines + base * 2;
+
+		// Cohen-Sutherland outcodes of all endpoints in the block
+		unsigned char codes[block_size * 2];
+		for (size_t i = 0; i < block * 2; i++) {
+			const int px = points[i].x, py = points[i].y;
+			codes[i] = static_cast<unsigned char>((px < x1) | ((px > x2) << 1) | ((py < y1) << 2) | ((py > y2) << 3));
+		}
+
+		// segments entirely inside or entirely on one side are
+		// classified by outcodes, the rest are clipped by SDL with
+		// the same results SDL_IntersectRectAndLine would give
+		Uint64 word = 0;
+		for (size_t i = 0; i < block; i++) {
+			const unsigned char code1 = codes[i * 2], code2 = codes[i * 2 + 1];
+
+			bool visible;
+			if (empty || (code1 & code2) != 0)
+				visible = false;
+			else if ((code1 | code2) == 0)
+				visible = true;
+			else
+				visible = SDL_IntersectRectAndLine(this, &points[i * 2].x, &points[i * 2].y, &points[i * 2 + 1].x, &points[i * 2 + 1].y) == SDL_TRUE;
+
+			word |= static_cast<Uint64>(visible) << i;
+			found += visible;
+		}
+
+		if (mask != nullptr)
+			mask[base / block_size] = word;
+	}
+
+	return found;
+}
+
+}
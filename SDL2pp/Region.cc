@@ -0,0 +1,289 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+#include <climits>
+#include <utility>
+
+#include <SDL2pp/Region.hh>
+
+namespace SDL2pp {
+
+namespace {
+
+// Combines two sorted lists of span boundaries; boundaries are
+// swept left to right, tracking whether each operand is inside
+// a span, and result boundaries are emitted where operation
+// result changes. This also merges adjacent spans.
+template <class Operation>
+void CombineSpans(const std::vector<int>& a, const std::vector<int>& b, Operation operation, std::vector<int>& result) {
+	size_t i = 0, j = 0;
+	bool in_a = false, in_b = false, in_result = false;
+
+	while (i < a.size() || j < b.size()) {
+		const int x = std::min(i < a.size() ? a[i] : INT_MAX, j < b.size() ? b[j] : INT_MAX);
+
+		if (i < a.size() && a[i] == x) {
+			in_a = !in_a;
+			i++;
+		}
+		if (j < b.size() && b[j] == x) {
+			in_b = !in_b;
+			j++;
+		}
+
+		const bool in = operation(in_a, in_b);
+		if (in != in_result) {
+			result.push_back(x);
+			in_result = in;
+		}
+	}
+}
+
+}
+
+Region::Region() {
+}
+
+Region::Region(const Rect& rect) {
+	if (rect.w > 0 && rect.h > 0)
+		bands_.push_back(Band{rect.y, rect.y + rect.h, {rect.x, rect.x + rect.w}});
+}
+
+Region::Region(const Rect* rects, size_t count) {
+	// union is done pairwise in a balanced tree, so each band
+	// takes part in O(log n) operations
+	std::vector<Region> regions;
+	regions.reserve(count);
+	for (size_t i = 0; i < count; i++)
+		regions.emplace_back(rects[i]);
+
+	while (regions.size() > 1) {
+		size_t merged = 0;
+		for (size_t i = 0; i < regions.size(); i += 2) {
+			if (i + 1 < regions.size())
+				regions[merged++] = Combine(regions[i], regions[i + 1], Operation::Union);
+			else
+				regions[merged++] = std::move(regions[i]);
+		}
+		regions.resize(merged);
+	}
+
+	if (!regions.empty())
+		bands_ = std::move(regions.front().bands_);
+}
+
+Region Region::Combine(const Region& a, const Region& b, Operation operation) {
+	auto apply = [operation](bool in_a, bool in_b) {
+		switch (operation) {
+		case Operation::Union: return in_a || in_b;
+		case Operation::Intersection: return in_a && in_b;
+		case Operation::Subtraction: return in_a && !in_b;
+		}
+		return false;
+	};
+
+	Region result;
+	if (a.bands_.empty() && b.bands_.empty())
+		return result;
+
+	const std::vector<int> no_spans;
+	std::vector<int> spans;
+
+	size_t i = 0, j = 0;
+	int y = std::min(
+			a.bands_.empty() ? INT_MAX : a.bands_.front().y1,
+			b.bands_.empty() ? INT_MAX : b.bands_.front().y1
+		);
+
+	// sweep over elementary vertical intervals in which neither
+	// operand changes, combining spans of operands in each
+	while (i < a.bands_.size() || j < b.bands_.size()) {
+		const Band* band_a = i < a.bands_.size() ? &a.bands_[i] : nullptr;
+		const Band* band_b = j < b.bands_.size() ? &b.bands_[j] : nullptr;
+
+		const bool in_a = band_a && band_a->y1 <= y;
+		const bool in_b = band_b && band_b->y1 <= y;
+
+		int next_y = INT_MAX;
+		if (band_a)
+			next_y = std::min(next_y, in_a ? band_a->y2 : band_a->y1);
+		if (band_b)
+			next_y = std::min(next_y, in_b ? band_b->y2 : band_b->y1);
+
+		spans.clear();
+		CombineSpans(in_a ? band_a->xs : no_spans, in_b ? band_b->xs : no_spans, apply, spans);
+
+		if (!spans.empty()) {
+			// coalesce with previous band if it's adjacent and identical
+			if (!result.bands_.empty() && result.bands_.back().y2 == y && result.bands_.back().xs == spans)
+				result.bands_.back().y2 = next_y;
+			else
+				result.bands_.push_back(Band{y, next_y, spans});
+		}
+
+		y = next_y;
+		if (band_a && band_a->y2 == y)
+			i++;
+		if (band_b && band_b->y2 == y)
+			j++;
+	}
+
+	return result;
+}
+
+bool Region::IsEmpty() const {
+	return bands_.empty();
+}
+
+void Region::Clear() {
+	bands_.clear();
+}
+
+Rect Region::GetBoundingBox() const {
+	if (bands_.empty())
+		return Rect(0, 0, 0, 0);
+
+	int x1 = INT_MAX, x2 = INT_MIN;
+	for (const Band& band : bands_) {
+		x1 = std::min(x1, band.xs.front());
+		x2 = std::max(x2, band.xs.back());
+	}
+
+	return Rect(x1, bands_.front().y1, x2 - x1, bands_.back().y2 - bands_.front().y1);
+}
+
+size_t Region::GetNumRects() const {
+	size_t count = 0;
+	for (const Band& band : bands_)
+		count += band.xs.size() / 2;
+	return count;
+}
+
+std::vector<Rect> Region::GetRects() const {
+	std::vector<Rect> rects;
+	rects.reserve(GetNumRects());
+	for (const Band& band : bands_)
+		for (size_t i = 0; i < band.xs.size(); i += 2)
+			rects.emplace_back(band.xs[i], band.y1, band.xs[i + 1] - band.xs[i], band.y2 - band.y1);
+	return rects;
+}
+
+long long Region::GetArea() const {
+	long long area = 0;
+	for (const Band& band : bands_)
+		for (size_t i = 0; i < band.xs.size(); i += 2)
+			area += static_cast<long long>(band.xs[i + 1] - band.xs[i]) * (band.y2 - band.y1);
+	return area;
+}
+
+bool Region::Contains(const Point& point) const {
+	auto band = std::upper_bound(bands_.begin(), bands_.end(), point.y, [](int y, const Band& band) {
+			return y < band.y2;
+		});
+	if (band == bands_.end() || band->y1 > point.y)
+		return false;
+
+	// number of boundaries not greater than x is odd inside spans
+	auto boundary = std::upper_bound(band->xs.begin(), band->xs.end(), point.x);
+	return (boundary - band->xs.begin()) % 2 == 1;
+}
+
+bool Region::Intersects(const Rect& rect) const {
+	if (rect.w <= 0 || rect.h <= 0)
+		return false;
+
+	const int x1 = rect.x, x2 = rect.x + rect.w;
+	const int y1 = rect.y, y2 = rect.y + rect.h;
+
+	auto band = std::upper_bound(bands_.begin(), bands_.end(), y1, [](int y, const Band& band) {
+			return y < band.y2;
+		});
+	for (; band != bands_.end() && band->y1 < y2; ++band)
+		for (size_t i = 0; i < band->xs.size() && band->xs[i] < x2; i += 2)
+			if (band->xs[i + 1] > x1)
+				return true;
+
+	return false;
+}
+
+Region Region::GetUnion(const Region& other) const {
+	return Combine(*this, other, Operation::Union);
+}
+
+Region Region::GetIntersection(const Region& other) const {
+	return Combine(*this, other, Operation::Intersection);
+}
+
+Region Region::GetSubtraction(const Region& other) const {
+	return Combine(*this, other, Operation::Subtraction);
+}
+
+Region& Region::Union(const Region& other) {
+	return *this = Combine(*this, other, Operation::Union);
+}
+
+Region& Region::Union(const Rect& rect) {
+	return Union(Region(rect));
+}
+
+Region& Region::Intersect(const Region& other) {
+	return *this = Combine(*this, other, Operation::Intersection);
+}
+
+Region& Region::Intersect(const Rect& rect) {
+	return Intersect(Region(rect));
+}
+
+Region& Region::Subtract(const Region& other) {
+	return *this = Combine(*this, other, Operation::Subtraction);
+}
+
+Region& Region::Subtract(const Rect& rect) {
+	return Subtract(Region(rect));
+}
+
+Region& Region::Translate(const Point& offset) {
+	for (Band& band : bands_) {
+		band.y1 += offset.y;
+		band.y2 += offset.y;
+		for (int& x : band.xs)
+			x += offset.x;
+	}
+	return *this;
+}
+
+bool Region::operator==(const Region& other) const {
+	if (bands_.size() != other.bands_.size())
+		return false;
+
+	for (size_t i = 0; i < bands_.size(); i++)
+		if (bands_[i].y1 != other.bands_[i].y1 || bands_[i].y2 != other.bands_[i].y2 || bands_[i].xs != other.bands_[i].xs)
+			return false;
+
+	return true;
+}
+
+bool Region::operator!=(const Region& other) const {
+	return !(*this == other);
+}
+
+}
@@ -0,0 +1,325 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_REGION_HH
+#define SDL2PP_REGION_HH
+
+#include <cstddef>
+#include <vector>
+
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+////////////////////////////////////////////////////////////
+/// \brief Arbitrary set of pixels represented as rectangles
+///
+/// \ingroup geometry
+///
+/// \headerfile SDL2pp/Region.hh
+///
+/// Region is useful for tracking damaged (dirty) areas of the
+/// screen: unlike Rect::Union(), which produces a single
+/// bounding box, union of scattered rectangles stays small.
+///
+/// Region is stored in banded form (same as in X11 and pixman):
+/// a list of horizontal bands sorted top to bottom, each
+/// holding sorted non-overlapping spans. Adjacent spans are
+/// merged and vertically adjacent bands with identical spans
+/// are coalesced, so representation is canonical: equal pixel
+/// sets always have equal rectangle lists. All operations are
+/// done in a single sweep over bands of both operands.
+///
+/// Rects with non-positive width or height are empty and
+/// contribute no pixels.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::Region damage;
+///     damage.Union(Rect(10, 10, 100, 20));
+///     damage.Union(Rect(500, 400, 50, 50));
+///     damage.Subtract(Rect(0, 0, 20, 20));
+///
+///     for (const SDL2pp::Rect& rect : damage.GetRects())
+///         redraw(rect);
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT Region {
+private:
+	////////////////////////////////////////////////////////////
+	/// \brief Horizontal band of region
+	///
+	////////////////////////////////////////////////////////////
+	struct Band {
+		int y1;               ///< Top coordinate, inclusive
+		int y2;               ///< Bottom coordinate, exclusive
+		std::vector<int> xs;  ///< Span boundaries: pairs of inclusive left and exclusive right coordinates
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set operation
+	///
+	////////////////////////////////////////////////////////////
+	enum class Operation {
+		Union,
+		Intersection,
+		Subtraction,
+	};
+
+private:
+	std::vector<Band> bands_; ///< Bands sorted top to bottom
+
+private:
+	////////////////////////////////////////////////////////////
+	/// \brief Apply set operation to two regions
+	///
+	/// \param[in] a First operand
+	/// \param[in] b Second operand
+	/// \param[in] operation Operation to apply
+	///
+	/// \returns Resulting region
+	///
+	////////////////////////////////////////////////////////////
+	static Region Combine(const Region& a, const Region& b, Operation operation);
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Construct empty region
+	///
+	////////////////////////////////////////////////////////////
+	Region();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct region from rectangle
+	///
+	/// \param[in] rect Rectangle
+	///
+	////////////////////////////////////////////////////////////
+	explicit Region(const Rect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct region from rectangles
+	///
+	/// \param[in] rects Pointer to array of rectangles, which
+	///                  may overlap
+	/// \param[in] count Number of rectangles
+	///
+	////////////////////////////////////////////////////////////
+	Region(const Rect* rects, size_t count);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check whether region is empty
+	///
+	/// \returns True if region contains no pixels
+	///
+	////////////////////////////////////////////////////////////
+	bool IsEmpty() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Remove all pixels from region
+	///
+	////////////////////////////////////////////////////////////
+	void Clear();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get bounding box of region
+	///
+	/// \returns Smallest rectangle containing the region,
+	///          or Rect(0, 0, 0, 0) for empty region
+	///
+	////////////////////////////////////////////////////////////
+	Rect GetBoundingBox() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of rectangles region consists of
+	///
+	/// \returns Number of rectangles returned by GetRects()
+	///
+	////////////////////////////////////////////////////////////
+	size_t GetNumRects() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get rectangles region consists of
+	///
+	/// \returns Non-overlapping rectangles in top to bottom,
+	///          left to right order
+	///
+	////////////////////////////////////////////////////////////
+	std::vector<Rect> GetRects() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get area of region
+	///
+	/// \returns Number of pixels in region
+	///
+	////////////////////////////////////////////////////////////
+	long long GetArea() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check whether region contains a point
+	///
+	/// \param[in] point Point to check
+	///
+	/// \returns True if the point is inside the region
+	///
+	////////////////////////////////////////////////////////////
+	bool Contains(const Point& point) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check whether region intersects a rectangle
+	///
+	/// \param[in] rect Rectangle to check
+	///
+	/// \returns True if region and rectangle have common pixels
+	///
+	////////////////////////////////////////////////////////////
+	bool Intersects(const Rect& rect) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Calculate union with another region
+	///
+	/// \param[in] other Region to union with
+	///
+	/// \returns Region representing union
+	///
+	////////////////////////////////////////////////////////////
+	Region GetUnion(const Region& other) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Calculate intersection with another region
+	///
+	/// \param[in] other Region to intersect with
+	///
+	/// \returns Region representing intersection
+	///
+	////////////////////////////////////////////////////////////
+	Region GetIntersection(const Region& other) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Calculate difference with another region
+	///
+	/// \param[in] other Region to subtract
+	///
+	/// \returns Region containing pixels of this region which
+	///          are not in other region
+	///
+	////////////////////////////////////////////////////////////
+	Region GetSubtraction(const Region& other) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Union region with another region
+	///
+	/// \param[in] other Region to union with
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	Region& Union(const Region& other);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Union region with a rectangle
+	///
+	/// \param[in] rect Rectangle to union with
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	Region& Union(const Rect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Intersect region with another region
+	///
+	/// \param[in] other Region to intersect with
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	Region& Intersect(const Region& other);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Intersect region with a rectangle
+	///
+	/// \param[in] rect Rectangle to intersect with
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	Region& Intersect(const Rect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Subtract another region from region
+	///
+	/// \param[in] other Region to subtract
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	Region& Subtract(const Region& other);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Subtract a rectangle from region
+	///
+	/// \param[in] rect Rectangle to subtract
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	Region& Subtract(const Rect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Move region by given offset
+	///
+	/// \param[in] offset Point specifying an offset
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	Region& Translate(const Point& offset);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Equality operator
+	///
+	/// \param[in] other Region to compare to
+	///
+	/// \returns True if regions contain the same pixels
+	///
+	////////////////////////////////////////////////////////////
+	bool operator==(const Region& other) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Inequality operator
+	///
+	/// \param[in] other Region to compare to
+	///
+	/// \returns True if regions differ
+	///
+	////////////////////////////////////////////////////////////
+	bool operator!=(const Region& other) const;
+};
+
+}
+
+#endif
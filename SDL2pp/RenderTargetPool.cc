@@ -0,0 +1,174 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <utility>
+
+#include <SDL_render.h>
+
+#include <SDL2pp/RenderTargetPool.hh>
+#include <SDL2pp/Renderer.hh>
+
+namespace SDL2pp {
+
+RenderTargetPool::Lease::Lease() : pool_(nullptr), format_(0), size_(0, 0) {
+}
+
+RenderTargetPool::Lease::Lease(RenderTargetPool* pool, Texture&& texture, Uint32 format, const Point& size) : pool_(pool), texture_(std::move(texture)), format_(format), size_(size) {
+}
+
+RenderTargetPool::Lease::~Lease() {
+	Release();
+}
+
+RenderTargetPool::Lease::Lease(Lease&& other) noexcept : pool_(other.pool_), texture_(std::move(other.texture_)), format_(other.format_), size_(other.size_) {
+	other.pool_ = nullptr;
+	other.texture_.reset();
+}
+
+RenderTargetPool::Lease& RenderTargetPool::Lease::operator=(Lease&& other) noexcept {
+	if (&other == this)
+		return *this;
+
+	Release();
+
+	pool_ = other.pool_;
+	texture_ = std::move(other.texture_);
+	format_ = other.format_;
+	size_ = other.size_;
+
+	other.pool_ = nullptr;
+	other.texture_.reset();
+
+	return *this;
+}
+
+void RenderTargetPool::Lease::Release() {
+	if (pool_ != nullptr && texture_)
+		pool_->Return(std::move(*texture_), format_, size_);
+
+	pool_ = nullptr;
+	texture_.reset();
+}
+
+Texture& RenderTargetPool::Lease::GetTexture() {
+	return *texture_;
+}
+
+RenderTargetPool::Lease::operator bool() const {
+	return static_cast<bool>(texture_);
+}
+
+RenderTargetPool::RenderTargetPool(Renderer& renderer, int max_unused_frames) :
+	renderer_(renderer),
+	max_unused_frames_(max_unused_frames),
+	frame_(0),
+	num_leased_(0),
+	num_idle_(0),
+	hits_(0),
+	misses_(0) {
+}
+
+RenderTargetPool::Lease RenderTargetPool::Acquire(Uint32 format, int w, int h) {
+	auto found = idle_.find(Key(format, w, h));
+	if (found != idle_.end() && !found->second.empty()) {
+		// most recently returned texture is taken, so rarely used
+		// surplus ones age out
+		Texture texture(std::move(found->second.back().texture));
+		found->second.pop_back();
+
+		num_idle_--;
+		num_leased_++;
+		hits_++;
+
+		return Lease(this, std::move(texture), format, Point(w, h));
+	}
+
+	Texture texture(renderer_, format, SDL_TEXTUREACCESS_TARGET, w, h);
+
+	num_leased_++;
+	misses_++;
+
+	return Lease(this, std::move(texture), format, Point(w, h));
+}
+
+RenderTargetPool::Lease RenderTargetPool::Acquire(Uint32 format, const Point& size) {
+	return Acquire(format, size.x, size.y);
+}
+
+void RenderTargetPool::Return(Texture&& texture, Uint32 format, const Point& size) {
+	idle_[Key(format, size.x, size.y)].push_back(IdleTarget{std::move(texture), frame_});
+
+	num_leased_--;
+	num_idle_++;
+}
+
+void RenderTargetPool::NextFrame() {
+	frame_++;
+
+	for (auto bucket = idle_.begin(); bucket != idle_.end(); ) {
+		auto& targets = bucket->second;
+
+		// targets are ordered by last use, oldest first
+		auto keep = targets.begin();
+		while (keep != targets.end() && frame_ - keep->last_used > static_cast<unsigned long>(max_unused_frames_))
+			++keep;
+
+		num_idle_ -= static_cast<std::size_t>(keep - targets.begin());
+		targets.erase(targets.begin(), keep);
+
+		if (targets.empty())
+			bucket = idle_.erase(bucket);
+		else
+			++bucket;
+	}
+}
+
+void RenderTargetPool::Clear() {
+	idle_.clear();
+	num_idle_ = 0;
+}
+
+std::size_t RenderTargetPool::GetNumLeased() const {
+	return num_leased_;
+}
+
+std::size_t RenderTargetPool::GetNumIdle() const {
+	return num_idle_;
+}
+
+unsigned long RenderTargetPool::GetHits() const {
+	return hits_;
+}
+
+unsigned long RenderTargetPool::GetMisses() const {
+	return misses_;
+}
+
+float RenderTargetPool::GetHitRate() const {
+	unsigned long total = hits_ + misses_;
+	return total == 0 ? 0.0f : static_cast<float>(hits_) / static_cast<float>(total);
+}
+
+void RenderTargetPool::ResetStats() {
+	hits_ = misses_ = 0;
+}
+
+}
@@ -0,0 +1,339 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_RENDERTARGETPOOL_HH
+#define SDL2PP_RENDERTARGETPOOL_HH
+
+#include <cstddef>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include <SDL_stdinc.h>
+
+#include <SDL2pp/Optional.hh>
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Texture.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+class Renderer;
+
+////////////////////////////////////////////////////////////
+/// \brief Pool of reusable render target textures
+///
+/// \ingroup rendering
+///
+/// \headerfile SDL2pp/RenderTargetPool.hh
+///
+/// Creating SDL_TEXTUREACCESS_TARGET textures is a driver
+/// allocation, which is costly to do for every frame in
+/// post-processing or UI layering code. This class keeps
+/// released targets grouped by format and size and hands them
+/// out again on later requests. Targets unused for a number
+/// of frames are destroyed.
+///
+/// Contents and state (blend mode, color and alpha modulation)
+/// of acquired texture are those left by its previous user, so
+/// clear the target before use if needed.
+///
+/// Pool must outlive all of its leases, and thus is neither
+/// copyable nor movable.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::RenderTargetPool pool(renderer);
+///
+///     while (running) {
+///         {
+///             SDL2pp::RenderTargetPool::Lease blur = pool.Acquire(SDL_PIXELFORMAT_RGBA8888, 320, 240);
+///             renderer.SetTarget(blur.GetTexture());
+///             // ...
+///         }
+///         // At this point texture is back in the pool
+///
+///         pool.NextFrame();
+///     }
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT RenderTargetPool {
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Scoped ownership of a pooled render target
+	///
+	/// The texture is returned to the pool as soon as Lease is
+	/// destroyed or Release() is called.
+	///
+	////////////////////////////////////////////////////////////
+	class SDL2PP_EXPORT Lease {
+		friend class RenderTargetPool;
+	private:
+		RenderTargetPool* pool_;    ///< Pool the texture is returned to
+		Optional<Texture> texture_; ///< Leased texture
+		Uint32 format_;             ///< Pixel format of the texture
+		Point size_;                ///< Size of the texture
+
+	private:
+		////////////////////////////////////////////////////////////
+		/// \brief Create lease of given texture
+		///
+		/// \param[in] pool Pool the texture belongs to
+		/// \param[in] texture Texture to lease
+		/// \param[in] format Pixel format of the texture
+		/// \param[in] size Size of the texture
+		///
+		////////////////////////////////////////////////////////////
+		Lease(RenderTargetPool* pool, Texture&& texture, Uint32 format, const Point& size);
+
+	public:
+		////////////////////////////////////////////////////////////
+		/// \brief Create empty lease
+		///
+		/// This may be initialized with real lease later via move
+		/// assignment
+		///
+		////////////////////////////////////////////////////////////
+		Lease();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destructor
+		///
+		/// Returns the texture to the pool
+		///
+		////////////////////////////////////////////////////////////
+		~Lease();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Move constructor
+		///
+		/// \param[in] other SDL2pp::RenderTargetPool::Lease to move data from
+		///
+		////////////////////////////////////////////////////////////
+		Lease(Lease&& other) noexcept;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Move assignment operator
+		///
+		/// \param[in] other SDL2pp::RenderTargetPool::Lease to move data from
+		///
+		/// \returns Reference to self
+		///
+		////////////////////////////////////////////////////////////
+		Lease& operator=(Lease&& other) noexcept;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Deleted copy constructor
+		///
+		/// This class is not copyable
+		///
+		////////////////////////////////////////////////////////////
+		Lease(const Lease& other) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Deleted assignment operator
+		///
+		/// This class is not copyable
+		///
+		////////////////////////////////////////////////////////////
+		Lease& operator=(const Lease& other) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Return texture to the pool before lease is destroyed
+		///
+		////////////////////////////////////////////////////////////
+		void Release();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get leased texture
+		///
+		/// \returns Reference to leased texture
+		///
+		////////////////////////////////////////////////////////////
+		Texture& GetTexture();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether lease holds a texture
+		///
+		/// \returns True if lease holds a texture
+		///
+		////////////////////////////////////////////////////////////
+		explicit operator bool() const;
+	};
+
+private:
+	typedef std::tuple<Uint32, int, int> Key;
+
+	struct IdleTarget {
+		Texture texture;         ///< Texture returned to the pool
+		unsigned long last_used; ///< Frame number it was returned at
+	};
+
+private:
+	Renderer& renderer_;                          ///< Renderer textures are created for
+	std::map<Key, std::vector<IdleTarget>> idle_; ///< Released textures by format and size
+	int max_unused_frames_;                       ///< Number of frames idle texture is kept for
+	unsigned long frame_;                         ///< Current frame number
+	std::size_t num_leased_;                      ///< Number of textures currently leased
+	std::size_t num_idle_;                        ///< Number of textures currently idle
+	unsigned long hits_;                          ///< Number of requests satisfied from the pool
+	unsigned long misses_;                        ///< Number of requests which created a texture
+
+private:
+	////////////////////////////////////////////////////////////
+	/// \brief Return texture into the pool
+	///
+	/// \param[in] texture Texture to return
+	/// \param[in] format Pixel format of the texture
+	/// \param[in] size Size of the texture
+	///
+	////////////////////////////////////////////////////////////
+	void Return(Texture&& texture, Uint32 format, const Point& size);
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Create pool
+	///
+	/// \param[in] renderer Renderer to create textures for
+	/// \param[in] max_unused_frames Number of NextFrame() calls after
+	///                              which unused texture is destroyed
+	///
+	////////////////////////////////////////////////////////////
+	explicit RenderTargetPool(Renderer& renderer, int max_unused_frames = 60);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted copy constructor
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	RenderTargetPool(const RenderTargetPool& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted assignment operator
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	RenderTargetPool& operator=(const RenderTargetPool& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Acquire render target texture
+	///
+	/// \param[in] format One of the enumerated values in SDL_PixelFormatEnum
+	/// \param[in] w Width of the texture in pixels
+	/// \param[in] h Height of the texture in pixels
+	///
+	/// \returns Lease of pooled or newly created texture
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_CreateTexture
+	///
+	////////////////////////////////////////////////////////////
+	Lease Acquire(Uint32 format, int w, int h);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Acquire render target texture
+	///
+	/// \param[in] format One of the enumerated values in SDL_PixelFormatEnum
+	/// \param[in] size Size of the texture
+	///
+	/// \returns Lease of pooled or newly created texture
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_CreateTexture
+	///
+	////////////////////////////////////////////////////////////
+	Lease Acquire(Uint32 format, const Point& size);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Advance frame counter and destroy stale textures
+	///
+	/// Should be called once per frame, usually after
+	/// Renderer::Present()
+	///
+	////////////////////////////////////////////////////////////
+	void NextFrame();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Destroy all idle textures
+	///
+	/// Leased textures are not affected
+	///
+	////////////////////////////////////////////////////////////
+	void Clear();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of textures currently leased
+	///
+	/// \returns Number of leased textures
+	///
+	////////////////////////////////////////////////////////////
+	std::size_t GetNumLeased() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of textures kept idle in the pool
+	///
+	/// \returns Number of idle textures
+	///
+	////////////////////////////////////////////////////////////
+	std::size_t GetNumIdle() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of requests satisfied from the pool
+	///
+	/// \returns Number of hits since creation or last ResetStats()
+	///
+	////////////////////////////////////////////////////////////
+	unsigned long GetHits() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of requests which created a new texture
+	///
+	/// \returns Number of misses since creation or last ResetStats()
+	///
+	////////////////////////////////////////////////////////////
+	unsigned long GetMisses() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get ratio of requests satisfied from the pool
+	///
+	/// \returns Hit rate in [0.0, 1.0] range, 0.0 if there were
+	///          no requests
+	///
+	////////////////////////////////////////////////////////////
+	float GetHitRate() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Reset hit and miss counters
+	///
+	////////////////////////////////////////////////////////////
+	void ResetStats();
+};
+
+}
+
+#endif
@@ -26,8 +26,14 @@
 
 #include <SDL2pp/Renderer.hh>
 #include <SDL2pp/Window.hh>
+#include <SDL2pp/Surface.hh>
 #include <SDL2pp/Exception.hh>
+#include <SDL2pp/Profiler.hh>
 #include <SDL2pp/Texture.hh>
+#include <SDL2pp/MipmappedTexture.hh>
+#include <SDL2pp/PointArray.hh>
+#include <SDL2pp/RectArray.hh>
+#include <SDL2pp/VertexBuffer.hh>
 
 namespace SDL2pp {
 
@@ -40,6 +46,11 @@ Renderer::Renderer(Window& window, int index, Uint32 flags) {
 		throw Exception("SDL_CreateRenderer");
 }
 
+Renderer::Renderer(Surface& surface) {
+	if ((renderer_ = SDL_CreateSoftwareRenderer(surface.Get())) == nullptr)
+		throw Exception("SDL_CreateSoftwareRenderer");
+}
+
 Renderer::~Renderer() {
 	if (renderer_ != nullptr)
 		SDL_DestroyRenderer(renderer_);
@@ -64,51 +75,157 @@ SDL_Renderer* Renderer::Get() const {
 }
 
 Renderer& Renderer::Present() {
+	SDL2PP_PROFILE_SCOPE(RendererPresent);
+
 	SDL_RenderPresent(renderer_);
 	return *this;
 }
 
 Renderer& Renderer::Clear() {
-	if (SDL_RenderClear(renderer_) != 0)
-		throw Exception("SDL_RenderClear");
+	TryClear().ThrowIfFailed();
 	return *this;
 }
 
+Result Renderer::TryClear() {
+	if (SDL_RenderClear(renderer_) != 0)
+		return Result("SDL_RenderClear", -1);
+	return Result();
+}
+
 void Renderer::GetInfo(SDL_RendererInfo& info) {
 	if (SDL_GetRendererInfo(renderer_, &info) != 0)
 		throw Exception("SDL_GetRendererInfo");
 }
 
 Renderer& Renderer::Copy(Texture& texture, const Optional<Rect>& srcrect, const Optional<Rect>& dstrect) {
-	if (SDL_RenderCopy(renderer_, texture.Get(), srcrect ? &*srcrect : nullptr, dstrect ? &*dstrect : nullptr) != 0)
-		throw Exception("SDL_RenderCopy");
+	TryCopy(texture, srcrect, dstrect).ThrowIfFailed();
 	return *this;
 }
 
 Renderer& Renderer::Copy(Texture& texture, const Optional<Rect>& srcrect, const Point& dstpoint) {
+	TryCopy(texture, srcrect, dstpoint).ThrowIfFailed();
+	return *this;
+}
+
+Renderer& Renderer::Copy(Texture& texture, const Optional<Rect>& srcrect, const Optional<Rect>& dstrect, double angle, const Optional<Point>& center, int flip) {
+	TryCopy(texture, srcrect, dstrect, angle, center, flip).ThrowIfFailed();
+	return *this;
+}
+
+Renderer& Renderer::Copy(Texture& texture, const Optional<Rect>& srcrect, const Point& dstpoint, double angle, const Optional<Point>& center, int flip) {
+	TryCopy(texture, srcrect, dstpoint, angle, center, flip).ThrowIfFailed();
+	return *this;
+}
+
+Result Renderer::TryCopy(Texture& texture, const Optional<Rect>& srcrect, const Optional<Rect>& dstrect) {
+	SDL2PP_PROFILE_SCOPE(RendererCopy);
+
+	if (SDL_RenderCopy(renderer_, texture.Get(), srcrect ? &*srcrect : nullptr, dstrect ? &*dstrect : nullptr) != 0)
+		return Result("SDL_RenderCopy", -1);
+	return Result();
+}
+
+Result Renderer::TryCopy(Texture& texture, const Optional<Rect>& srcrect, const Point& dstpoint) {
 	Rect dstrect(
 			dstpoint.x,
 			dstpoint.y,
 			srcrect ? srcrect->w : texture.GetWidth(),
 			srcrect ? srcrect->h : texture.GetHeight()
 		);
-	return Copy(texture, srcrect, dstrect);
+	return TryCopy(texture, srcrect, dstrect);
 }
 
-Renderer& Renderer::Copy(Texture& texture, const Optional<Rect>& srcrect, const Optional<Rect>& dstrect, double angle, const Optional<Point>& center, int flip) {
+Result Renderer::TryCopy(Texture& texture, const Optional<Rect>& srcrect, const Optional<Rect>& dstrect, double angle, const Optional<Point>& center, int flip) {
+	SDL2PP_PROFILE_SCOPE(RendererCopy);
+
 	if (SDL_RenderCopyEx(renderer_, texture.Get(), srcrect ? &*srcrect : nullptr, dstrect ? &*dstrect : nullptr, angle, center ? &*center : nullptr, static_cast<SDL_RendererFlip>(flip)) != 0)
-		throw Exception("SDL_RenderCopyEx");
-	return *this;
+		return Result("SDL_RenderCopyEx", -1);
+	return Result();
 }
 
-Renderer& Renderer::Copy(Texture& texture, const Optional<Rect>& srcrect, const Point& dstpoint, double angle, const Optional<Point>& center, int flip) {
+Result Renderer::TryCopy(Texture& texture, const Optional<Rect>& srcrect, const Point& dstpoint, double angle, const Optional<Point>& center, int flip) {
 	Rect dstrect(
 			dstpoint.x,
 			dstpoint.y,
 			srcrect ? srcrect->w : texture.GetWidth(),
 			srcrect ? srcrect->h : texture.GetHeight()
 		);
-	return Copy(texture, srcrect, dstrect, angle, center, flip);
+	return TryCopy(texture, srcrect, dstrect, angle, center, flip);
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+Renderer& Renderer::CopyF(Texture& texture, const Optional<Rect>& srcrect, const FRect& dstrect) {
+	TryCopyF(texture, srcrect, dstrect).ThrowIfFailed();
+	return *this;
+}
+
+Renderer& Renderer::CopyF(Texture& texture, const Optional<Rect>& srcrect, const FPoint& dstpoint) {
+	TryCopyF(texture, srcrect, dstpoint).ThrowIfFailed();
+	return *this;
+}
+
+Renderer& Renderer::CopyF(Texture& texture, const Optional<Rect>& srcrect, const FRect& dstrect, double angle, const Optional<FPoint>& center, int flip) {
+	TryCopyF(texture, srcrect, dstrect, angle, center, flip).ThrowIfFailed();
+	return *this;
+}
+
+Renderer& Renderer::CopyF(Texture& texture, const Optional<Rect>& srcrect, const FPoint& dstpoint, double angle, const Optional<FPoint>& center, int flip) {
+	TryCopyF(texture, srcrect, dstpoint, angle, center, flip).ThrowIfFailed();
+	return *this;
+}
+
+Result Renderer::TryCopyF(Texture& texture, const Optional<Rect>& srcrect, const FRect& dstrect) {
+	SDL2PP_PROFILE_SCOPE(RendererCopy);
+
+	if (SDL_RenderCopyF(renderer_, texture.Get(), srcrect ? &*srcrect : nullptr, &dstrect) != 0)
+		return Result("SDL_RenderCopyF", -1);
+	return Result();
+}
+
+Result Renderer::TryCopyF(Texture& texture, const Optional<Rect>& srcrect, const FPoint& dstpoint) {
+	FRect dstrect(
+			dstpoint.x,
+			dstpoint.y,
+			static_cast<float>(srcrect ? srcrect->w : texture.GetWidth()),
+			static_cast<float>(srcrect ? srcrect->h : texture.GetHeight())
+		);
+	return TryCopyF(texture, srcrect, dstrect);
+}
+
+Result Renderer::TryCopyF(Texture& texture, const Optional<Rect>& srcrect, const FRect& dstrect, double angle, const Optional<FPoint>& center, int flip) {
+	SDL2PP_PROFILE_SCOPE(RendererCopy);
+
+	if (SDL_RenderCopyExF(renderer_, texture.Get(), srcrect ? &*srcrect : nullptr, &dstrect, angle, center ? &*center : nullptr, static_cast<SDL_RendererFlip>(flip)) != 0)
+		return Result("SDL_RenderCopyExF", -1);
+	return Result();
+}
+
+Result Renderer::TryCopyF(Texture& texture, const Optional<Rect>& srcrect, const FPoint& dstpoint, double angle, const Optional<FPoint>& center, int flip) {
+	FRect dstrect(
+			dstpoint.x,
+			dstpoint.y,
+			static_cast<float>(srcrect ? srcrect->w : texture.GetWidth()),
+			static_cast<float>(srcrect ? srcrect->h : texture.GetHeight())
+		);
+	return TryCopyF(texture, srcrect, dstrect, angle, center, flip);
+}
+#endif
+
+Renderer& Renderer::Copy(MipmappedTexture& texture, const Optional<Rect>& srcrect, const Optional<Rect>& dstrect) {
+	Rect src = srcrect ? *srcrect : Rect(Point(0, 0), texture.GetSize());
+	Point dstsize = dstrect ? dstrect->GetSize() : GetViewport().GetSize();
+
+	// level is chosen by size in output pixels, not logical units
+	float scalex, scaley;
+	GetScale(scalex, scaley);
+	dstsize.x = static_cast<int>(dstsize.x * scalex);
+	dstsize.y = static_cast<int>(dstsize.y * scaley);
+
+	int level = texture.SelectLevel(src.GetSize(), dstsize);
+	if (level == 0)
+		return Copy(texture.GetLevel(0), srcrect, dstrect);
+
+	return Copy(texture.GetLevel(level), texture.GetLevelRect(src, level), dstrect);
 }
 
 Renderer& Renderer::FillCopy(Texture& texture, const Optional<Rect>& srcrect, const Optional<Rect>& dstrect, const Point& offset, int flip) {
@@ -202,17 +319,27 @@ Renderer& Renderer::SetDrawColor(const Color& color) {
 }
 
 Renderer& Renderer::SetTarget() {
-	if (SDL_SetRenderTarget(renderer_, nullptr) != 0)
-		throw Exception("SDL_SetRenderTarget");
+	TrySetTarget().ThrowIfFailed();
 	return *this;
 }
 
 Renderer& Renderer::SetTarget(Texture& texture) {
-	if (SDL_SetRenderTarget(renderer_, texture.Get()) != 0)
-		throw Exception("SDL_SetRenderTarget");
+	TrySetTarget(texture).ThrowIfFailed();
 	return *this;
 }
 
+Result Renderer::TrySetTarget() {
+	if (SDL_SetRenderTarget(renderer_, nullptr) != 0)
+		return Result("SDL_SetRenderTarget", -1);
+	return Result();
+}
+
+Result Renderer::TrySetTarget(Texture& texture) {
+	if (SDL_SetRenderTarget(renderer_, texture.Get()) != 0)
+		return Result("SDL_SetRenderTarget", -1);
+	return Result();
+}
+
 Renderer& Renderer::SetDrawBlendMode(SDL_BlendMode blendMode) {
 	if (SDL_SetRenderDrawBlendMode(renderer_, blendMode) != 0)
 		throw Exception("SDL_SetRenderDrawBlendMode");
@@ -242,6 +369,20 @@ Renderer& Renderer::DrawPoints(const Point* points, int count) {
 	return *this;
 }
 
+Renderer& Renderer::DrawPoints(const PointArray& points) {
+	if (SDL_RenderDrawPoints(renderer_, points.GetAoS(), static_cast<int>(points.GetSize())) != 0)
+		throw Exception("SDL_RenderDrawPoints");
+	return *this;
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+Renderer& Renderer::DrawPoints(const FPoint* points, int count) {
+	if (SDL_RenderDrawPointsF(renderer_, points, count) != 0)
+		throw Exception("SDL_RenderDrawPointsF");
+	return *this;
+}
+#endif
+
 Renderer& Renderer::DrawLine(int x1, int y1, int x2, int y2) {
 	if (SDL_RenderDrawLine(renderer_, x1, y1, x2, y2) != 0)
 		throw Exception("SDL_RenderDrawLine");
@@ -265,6 +406,14 @@ Renderer& Renderer::DrawLines(const Point* points, int count) {
 	return *this;
 }
 
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+Renderer& Renderer::DrawLines(const FPoint* points, int count) {
+	if (SDL_RenderDrawLinesF(renderer_, points, count) != 0)
+		throw Exception("SDL_RenderDrawLinesF");
+	return *this;
+}
+#endif
+
 Renderer& Renderer::DrawRect(int x1, int y1, int x2, int y2) {
 	SDL_Rect rect = {x1, y1, x2 - x1 + 1, y2 - y1 + 1};
 	if (SDL_RenderDrawRect(renderer_, &rect) != 0)
@@ -295,7 +444,23 @@ Renderer& Renderer::DrawRects(const Rect* rects, int count) {
 	return *this;
 }
 
+Renderer& Renderer::DrawRects(const RectArray& rects) {
+	if (SDL_RenderDrawRects(renderer_, rects.GetAoS(), static_cast<int>(rects.GetSize())) != 0)
+		throw Exception("SDL_RenderDrawRects");
+	return *this;
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+Renderer& Renderer::DrawRects(const FRect* rects, int count) {
+	if (SDL_RenderDrawRectsF(renderer_, rects, count) != 0)
+		throw Exception("SDL_RenderDrawRectsF");
+	return *this;
+}
+#endif
+
 Renderer& Renderer::FillRect(int x1, int y1, int x2, int y2) {
+	SDL2PP_PROFILE_SCOPE(RendererFillRect);
+
 	SDL_Rect rect = {x1, y1, x2 - x1 + 1, y2 - y1 + 1};
 	if (SDL_RenderFillRect(renderer_, &rect) != 0)
 		throw Exception("SDL_RenderFillRect");
@@ -308,22 +473,71 @@ Renderer& Renderer::FillRect(const Point& p1, const Point& p2) {
 }
 
 Renderer& Renderer::FillRect(const Rect& r) {
-	if (SDL_RenderFillRect(renderer_, &r) != 0)
-		throw Exception("SDL_RenderFillRect");
+	TryFillRect(r).ThrowIfFailed();
 	return *this;
 }
 
 Renderer& Renderer::FillRects(const Rect* rects, int count) {
+	TryFillRects(rects, count).ThrowIfFailed();
+	return *this;
+}
+
+Renderer& Renderer::FillRects(const RectArray& rects) {
+	SDL2PP_PROFILE_SCOPE(RendererFillRects);
+
+	if (SDL_RenderFillRects(renderer_, rects.GetAoS(), static_cast<int>(rects.GetSize())) != 0)
+		throw Exception("SDL_RenderFillRects");
+	return *this;
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+Renderer& Renderer::FillRects(const FRect* rects, int count) {
+	SDL2PP_PROFILE_SCOPE(RendererFillRects);
+
+	if (SDL_RenderFillRectsF(renderer_, rects, count) != 0)
+		throw Exception("SDL_RenderFillRectsF");
+	return *this;
+}
+#endif
+
+Result Renderer::TryFillRect(const Rect& r) {
+	SDL2PP_PROFILE_SCOPE(RendererFillRect);
+
+	if (SDL_RenderFillRect(renderer_, &r) != 0)
+		return Result("SDL_RenderFillRect", -1);
+	return Result();
+}
+
+Result Renderer::TryFillRects(const Rect* rects, int count) {
+	SDL2PP_PROFILE_SCOPE(RendererFillRects);
+
 	std::vector<SDL_Rect> sdl_rects;
 	sdl_rects.reserve(static_cast<size_t>(count));
 	for (const Rect* r = rects; r != rects + count; ++r)
 		sdl_rects.emplace_back(*r);
 
 	if (SDL_RenderFillRects(renderer_, sdl_rects.data(), count) != 0)
-		throw Exception("SDL_RenderFillRects");
+		return Result("SDL_RenderFillRects", -1);
+	return Result();
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+Renderer& Renderer::Geometry(Texture* texture, const VertexBuffer& buffer) {
+	return Geometry(texture, buffer.GetVertices(), static_cast<int>(buffer.GetNumVertices()), buffer.GetIndices(), static_cast<int>(buffer.GetNumIndices()));
+}
+
+Renderer& Renderer::Geometry(Texture* texture, const SDL_Vertex* vertices, int num_vertices, const int* indices, int num_indices) {
+	if (SDL_RenderGeometry(renderer_, texture ? texture->Get() : nullptr, vertices, num_vertices, num_indices > 0 ? indices : nullptr, num_indices) != 0)
+		throw Exception("SDL_RenderGeometry");
+	return *this;
+}
 
+Renderer& Renderer::GeometryRaw(Texture* texture, const float* xy, int xy_stride, const SDL_Color* color, int color_stride, const float* uv, int uv_stride, int num_vertices, const void* indices, int num_indices, int size_indices) {
+	if (SDL_RenderGeometryRaw(renderer_, texture ? texture->Get() : nullptr, xy, xy_stride, color, color_stride, uv, uv_stride, num_vertices, num_indices > 0 ? indices : nullptr, num_indices, size_indices) != 0)
+		throw Exception("SDL_RenderGeometryRaw");
 	return *this;
 }
+#endif
 
 void Renderer::ReadPixels(const Optional<Rect>& rect, Uint32 format, void* pixels, int pitch) {
 	if (SDL_RenderReadPixels(renderer_, rect ? &*rect : nullptr, format, pixels, pitch) != 0)
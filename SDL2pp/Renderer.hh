@@ -24,11 +24,16 @@
 
 #include <SDL_stdinc.h>
 #include <SDL_blendmode.h>
+#include <SDL_render.h>
+#include <SDL_version.h>
 
 #include <SDL2pp/Config.hh>
 #include <SDL2pp/Optional.hh>
 #include <SDL2pp/Point.hh>
 #include <SDL2pp/Rect.hh>
+#include <SDL2pp/FPoint.hh>
+#include <SDL2pp/FRect.hh>
+#include <SDL2pp/Result.hh>
 #include <SDL2pp/Export.hh>
 #include <SDL2pp/Color.hh>
 
@@ -38,7 +43,12 @@ struct SDL_Renderer;
 namespace SDL2pp {
 
 class Window;
+class Surface;
 class Texture;
+class MipmappedTexture;
+class PointArray;
+class RectArray;
+class VertexBuffer;
 class Point;
 
 ////////////////////////////////////////////////////////////
@@ -78,6 +88,21 @@ public:
 	////////////////////////////////////////////////////////////
 	Renderer(Window& window, int index, Uint32 flags);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Create software renderer drawing into a surface
+	///
+	/// Needs no window nor video subsystem, so it's suitable for
+	/// headless rendering. The surface must outlive the renderer.
+	///
+	/// \param[in] surface Surface to render into
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_CreateSoftwareRenderer
+	///
+	////////////////////////////////////////////////////////////
+	explicit Renderer(Surface& surface);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Destructor
 	///
@@ -162,6 +187,16 @@ public:
 	////////////////////////////////////////////////////////////
 	Renderer& Clear();
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of Clear()
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see Clear
+	///
+	////////////////////////////////////////////////////////////
+	Result TryClear();
+
 	////////////////////////////////////////////////////////////
 	/// \brief Get information about a rendering context
 	///
@@ -193,6 +228,21 @@ public:
 	////////////////////////////////////////////////////////////
 	Renderer& Copy(Texture& texture, const Optional<Rect>& srcrect = NullOpt, const Optional<Rect>& dstrect = NullOpt);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of Copy()
+	///
+	/// \param[in] texture Source texture
+	/// \param[in] srcrect Source rectangle, NullOpt for the entire texture
+	/// \param[in] dstrect Destination rectangle, NullOpt for the entire
+	///                    rendering target
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see Copy
+	///
+	////////////////////////////////////////////////////////////
+	Result TryCopy(Texture& texture, const Optional<Rect>& srcrect = NullOpt, const Optional<Rect>& dstrect = NullOpt);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Copy a portion of the texture to the current rendering
 	///        target (preserve texture dimensions)
@@ -210,6 +260,20 @@ public:
 	////////////////////////////////////////////////////////////
 	Renderer& Copy(Texture& texture, const Optional<Rect>& srcrect, const Point& dstpoint);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of Copy()
+	///
+	/// \param[in] texture Source texture
+	/// \param[in] srcrect Source rectangle, NullOpt for the entire texture
+	/// \param[in] dstpoint Target point for source top left corner
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see Copy
+	///
+	////////////////////////////////////////////////////////////
+	Result TryCopy(Texture& texture, const Optional<Rect>& srcrect, const Point& dstpoint);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Copy a portion of the texture to the current rendering
 	///        target with optional rotating or flipping
@@ -236,6 +300,28 @@ public:
 	////////////////////////////////////////////////////////////
 	Renderer& Copy(Texture& texture, const Optional<Rect>& srcrect, const Optional<Rect>& dstrect, double angle, const Optional<Point>& center = NullOpt, int flip = 0);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of Copy()
+	///
+	/// \param[in] texture Source texture
+	/// \param[in] srcrect Source rectangle, NullOpt for the entire texture
+	/// \param[in] dstrect Destination rectangle, NullOpt for the entire
+	///                    rendering target
+	/// \param[in] angle Angle in degrees that indicates the rotation that
+	///                  will be applied to dstrect
+	/// \param[in] center Point indicating the point around which dstrect
+	///                   will be rotated (NullOpt to rotate around dstrect
+	///                   center)
+	/// \param[in] flip SDL_RendererFlip value stating which flipping
+	///                 actions should be performed on the texture
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see Copy
+	///
+	////////////////////////////////////////////////////////////
+	Result TryCopy(Texture& texture, const Optional<Rect>& srcrect, const Optional<Rect>& dstrect, double angle, const Optional<Point>& center = NullOpt, int flip = 0);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Copy a portion of the texture to the current rendering
 	///        target with optional rotating or flipping (preserve texture
@@ -262,6 +348,209 @@ public:
 	////////////////////////////////////////////////////////////
 	Renderer& Copy(Texture& texture, const Optional<Rect>& srcrect, const SDL2pp::Point& dstpoint, double angle, const Optional<Point>& center = NullOpt, int flip = 0);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of Copy()
+	///
+	/// \param[in] texture Source texture
+	/// \param[in] srcrect Source rectangle, NullOpt for the entire texture
+	/// \param[in] dstpoint Target point for source top left corner
+	/// \param[in] angle Angle in degrees that indicates the rotation that
+	///                  will be applied to dstrect
+	/// \param[in] center Point indicating the point around which dstrect
+	///                   will be rotated (NullOpt to rotate around dstrect
+	///                   center)
+	/// \param[in] flip SDL_RendererFlip value stating which flipping
+	///                 actions should be performed on the texture
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see Copy
+	///
+	////////////////////////////////////////////////////////////
+	Result TryCopy(Texture& texture, const Optional<Rect>& srcrect, const SDL2pp::Point& dstpoint, double angle, const Optional<Point>& center = NullOpt, int flip = 0);
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+	////////////////////////////////////////////////////////////
+	/// \brief Copy a portion of the texture to the current rendering
+	///        target with subpixel precision
+	///
+	/// \param[in] texture Source texture
+	/// \param[in] srcrect Source rectangle, NullOpt for the entire texture
+	/// \param[in] dstrect Destination rectangle
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderCopyF
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& CopyF(Texture& texture, const Optional<Rect>& srcrect, const FRect& dstrect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of CopyF()
+	///
+	/// \param[in] texture Source texture
+	/// \param[in] srcrect Source rectangle, NullOpt for the entire texture
+	/// \param[in] dstrect Destination rectangle
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see CopyF
+	///
+	////////////////////////////////////////////////////////////
+	Result TryCopyF(Texture& texture, const Optional<Rect>& srcrect, const FRect& dstrect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Copy a portion of the texture to the current rendering
+	///        target with subpixel precision (preserve texture
+	///        dimensions)
+	///
+	/// \param[in] texture Source texture
+	/// \param[in] srcrect Source rectangle, NullOpt for the entire texture
+	/// \param[in] dstpoint Target point for source top left corner
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderCopyF
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& CopyF(Texture& texture, const Optional<Rect>& srcrect, const FPoint& dstpoint);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of CopyF()
+	///
+	/// \param[in] texture Source texture
+	/// \param[in] srcrect Source rectangle, NullOpt for the entire texture
+	/// \param[in] dstpoint Target point for source top left corner
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see CopyF
+	///
+	////////////////////////////////////////////////////////////
+	Result TryCopyF(Texture& texture, const Optional<Rect>& srcrect, const FPoint& dstpoint);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Copy a portion of the texture to the current rendering
+	///        target with subpixel precision and optional rotating
+	///        or flipping
+	///
+	/// \param[in] texture Source texture
+	/// \param[in] srcrect Source rectangle, NullOpt for the entire texture
+	/// \param[in] dstrect Destination rectangle
+	/// \param[in] angle Angle in degrees that indicates the rotation that
+	///                  will be applied to dstrect
+	/// \param[in] center Point indicating the point around which dstrect
+	///                   will be rotated (NullOpt to rotate around dstrect
+	///                   center)
+	/// \param[in] flip SDL_RendererFlip value stating which flipping
+	///                 actions should be performed on the texture
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RendererFlip
+	/// \see http://wiki.libsdl.org/SDL_RenderCopyExF
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& CopyF(Texture& texture, const Optional<Rect>& srcrect, const FRect& dstrect, double angle, const Optional<FPoint>& center = NullOpt, int flip = 0);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of CopyF()
+	///
+	/// \param[in] texture Source texture
+	/// \param[in] srcrect Source rectangle, NullOpt for the entire texture
+	/// \param[in] dstrect Destination rectangle
+	/// \param[in] angle Angle in degrees that indicates the rotation that
+	///                  will be applied to dstrect
+	/// \param[in] center Point indicating the point around which dstrect
+	///                   will be rotated (NullOpt to rotate around dstrect
+	///                   center)
+	/// \param[in] flip SDL_RendererFlip value stating which flipping
+	///                 actions should be performed on the texture
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see CopyF
+	///
+	////////////////////////////////////////////////////////////
+	Result TryCopyF(Texture& texture, const Optional<Rect>& srcrect, const FRect& dstrect, double angle, const Optional<FPoint>& center = NullOpt, int flip = 0);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Copy a portion of the texture to the current rendering
+	///        target with subpixel precision and optional rotating
+	///        or flipping (preserve texture dimensions)
+	///
+	/// \param[in] texture Source texture
+	/// \param[in] srcrect Source rectangle, NullOpt for the entire texture
+	/// \param[in] dstpoint Target point for source top left corner
+	/// \param[in] angle Angle in degrees that indicates the rotation that
+	///                  will be applied to dstrect
+	/// \param[in] center Point indicating the point around which dstrect
+	///                   will be rotated (NullOpt to rotate around dstrect
+	///                   center)
+	/// \param[in] flip SDL_RendererFlip value stating which flipping
+	///                 actions should be performed on the texture
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RendererFlip
+	/// \see http://wiki.libsdl.org/SDL_RenderCopyExF
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& CopyF(Texture& texture, const Optional<Rect>& srcrect, const FPoint& dstpoint, double angle, const Optional<FPoint>& center = NullOpt, int flip = 0);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of CopyF()
+	///
+	/// \param[in] texture Source texture
+	/// \param[in] srcrect Source rectangle, NullOpt for the entire texture
+	/// \param[in] dstpoint Target point for source top left corner
+	/// \param[in] angle Angle in degrees that indicates the rotation that
+	///                  will be applied to dstrect
+	/// \param[in] center Point indicating the point around which dstrect
+	///                   will be rotated (NullOpt to rotate around dstrect
+	///                   center)
+	/// \param[in] flip SDL_RendererFlip value stating which flipping
+	///                 actions should be performed on the texture
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see CopyF
+	///
+	////////////////////////////////////////////////////////////
+	Result TryCopyF(Texture& texture, const Optional<Rect>& srcrect, const FPoint& dstpoint, double angle, const Optional<FPoint>& center = NullOpt, int flip = 0);
+#endif
+
+	////////////////////////////////////////////////////////////
+	/// \brief Copy a portion of the mipmapped texture to the current rendering target
+	///
+	/// Mipmap level is chosen based on the ratio of source rectangle
+	/// size to destination size in output pixels (that is, with
+	/// renderer scale taken into account), so minified textures
+	/// are drawn from a smaller, prefiltered level
+	///
+	/// \param[in] texture Source texture
+	/// \param[in] srcrect Source rectangle in base level coordinates,
+	///                    NullOpt for the entire texture
+	/// \param[in] dstrect Destination rectangle, NullOpt for the entire
+	///                    rendering target
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderCopy
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& Copy(MipmappedTexture& texture, const Optional<Rect>& srcrect = NullOpt, const Optional<Rect>& dstrect = NullOpt);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Fill the target with repeated source texture
 	///
@@ -328,6 +617,16 @@ public:
 	////////////////////////////////////////////////////////////
 	Renderer& SetTarget();
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of SetTarget()
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see SetTarget
+	///
+	////////////////////////////////////////////////////////////
+	Result TrySetTarget();
+
 	////////////////////////////////////////////////////////////
 	/// \brief Set current render target to specified texture
 	///
@@ -343,6 +642,19 @@ public:
 	////////////////////////////////////////////////////////////
 	Renderer& SetTarget(Texture& texture);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of SetTarget()
+	///
+	/// \param[in] texture Target texture, SDL2pp::Texture created with
+	///                    SDL_TEXTUREACCESS_TARGET
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see SetTarget
+	///
+	////////////////////////////////////////////////////////////
+	Result TrySetTarget(Texture& texture);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Set the blend mode used for drawing operations
 	///
@@ -402,6 +714,41 @@ public:
 	////////////////////////////////////////////////////////////
 	Renderer& DrawPoints(const Point* points, int count);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Draw multiple points on the current rendering target
+	///
+	/// Points are converted to SDL layout in scratch buffer
+	/// of the array, so no allocation happens once it has grown
+	///
+	/// \param[in] points Array of points to draw
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderDrawPoints
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& DrawPoints(const PointArray& points);
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+	////////////////////////////////////////////////////////////
+	/// \brief Draw multiple points on the current rendering target
+	///        with subpixel precision
+	///
+	/// \param[in] points Array of coordinates of points to draw
+	/// \param[in] count Number of points to draw
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderDrawPointsF
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& DrawPoints(const FPoint* points, int count);
+#endif
+
 	////////////////////////////////////////////////////////////
 	/// \brief Draw a line on the current rendering target
 	///
@@ -449,6 +796,24 @@ public:
 	////////////////////////////////////////////////////////////
 	Renderer& DrawLines(const Point* points, int count);
 
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+	////////////////////////////////////////////////////////////
+	/// \brief Draw a polyline on the current rendering target
+	///        with subpixel precision
+	///
+	/// \param[in] points Array of coordinates of points along the polyline
+	/// \param[in] count Number of points to draw count-1 polyline segments
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderDrawLinesF
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& DrawLines(const FPoint* points, int count);
+#endif
+
 	////////////////////////////////////////////////////////////
 	/// \brief Draw a rectangle on the current rendering target
 	///
@@ -510,6 +875,41 @@ public:
 	////////////////////////////////////////////////////////////
 	Renderer& DrawRects(const Rect* rects, int count);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Draw multiple rectangles on the current rendering target
+	///
+	/// Rectangles are converted to SDL layout in scratch buffer
+	/// of the array, so no allocation happens once it has grown
+	///
+	/// \param[in] rects Array of rectangles to draw
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderDrawRects
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& DrawRects(const RectArray& rects);
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+	////////////////////////////////////////////////////////////
+	/// \brief Draw multiple rectangles on the current rendering target
+	///        with subpixel precision
+	///
+	/// \param[in] rects Array of rectangles to draw
+	/// \param[in] count Number of rectangles
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderDrawRectsF
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& DrawRects(const FRect* rects, int count);
+#endif
+
 	////////////////////////////////////////////////////////////
 	/// \brief Fill a rectangle on the current rendering target
 	///
@@ -556,6 +956,18 @@ public:
 	////////////////////////////////////////////////////////////
 	Renderer& FillRect(const Rect& r);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of FillRect()
+	///
+	/// \param[in] r Rectangle to draw
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see FillRect
+	///
+	////////////////////////////////////////////////////////////
+	Result TryFillRect(const Rect& r);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Fill multiple rectangles on the current rendering target
 	///
@@ -571,6 +983,127 @@ public:
 	////////////////////////////////////////////////////////////
 	Renderer& FillRects(const Rect* rects, int count);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Fill multiple rectangles on the current rendering target
+	///
+	/// Rectangles are converted to SDL layout in scratch buffer
+	/// of the array, so no allocation happens once it has grown
+	///
+	/// \param[in] rects Array of rectangles to draw
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderFillRects
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& FillRects(const RectArray& rects);
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+	////////////////////////////////////////////////////////////
+	/// \brief Fill multiple rectangles on the current rendering target
+	///        with subpixel precision
+	///
+	/// \param[in] rects Array of rectangles to draw
+	/// \param[in] count Number of rectangles
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderFillRectsF
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& FillRects(const FRect* rects, int count);
+#endif
+
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of FillRects()
+	///
+	/// \param[in] rects Array of rectangles to draw
+	/// \param[in] count Number of rectangles
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see FillRects
+	///
+	////////////////////////////////////////////////////////////
+	Result TryFillRects(const Rect* rects, int count);
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+	////////////////////////////////////////////////////////////
+	/// \brief Render triangles from a vertex buffer
+	///
+	/// Vertex data is passed to SDL as is, without copying
+	///
+	/// \param[in] texture Texture to map on triangles, or nullptr
+	///                    for plain colored geometry
+	/// \param[in] buffer Vertices and indices to render
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderGeometry
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& Geometry(Texture* texture, const VertexBuffer& buffer);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Render triangles from an array of vertices
+	///
+	/// \param[in] texture Texture to map on triangles, or nullptr
+	///                    for plain colored geometry
+	/// \param[in] vertices Array of vertices
+	/// \param[in] num_vertices Number of vertices
+	/// \param[in] indices Array of vertex indices, three per triangle,
+	///                    or nullptr to use vertices sequentially
+	/// \param[in] num_indices Number of indices
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderGeometry
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& Geometry(Texture* texture, const SDL_Vertex* vertices, int num_vertices, const int* indices = nullptr, int num_indices = 0);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Render triangles from separate, possibly strided, arrays
+	///        of vertex attributes
+	///
+	/// Allows rendering geometry stored in structure-of-arrays or
+	/// in custom interleaved layouts without converting it to
+	/// SDL_Vertex first
+	///
+	/// \param[in] texture Texture to map on triangles, or nullptr
+	///                    for plain colored geometry
+	/// \param[in] xy Vertex positions, two floats per vertex
+	/// \param[in] xy_stride Byte distance between consecutive positions
+	/// \param[in] color Vertex colors
+	/// \param[in] color_stride Byte distance between consecutive colors
+	/// \param[in] uv Normalized texture coordinates, two floats per
+	///               vertex, or nullptr if texture is nullptr
+	/// \param[in] uv_stride Byte distance between consecutive texture
+	///                      coordinates
+	/// \param[in] num_vertices Number of vertices
+	/// \param[in] indices Array of vertex indices, or nullptr to use
+	///                    vertices sequentially
+	/// \param[in] num_indices Number of indices
+	/// \param[in] size_indices Size of one index in bytes (1, 2 or 4)
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_RenderGeometryRaw
+	///
+	////////////////////////////////////////////////////////////
+	Renderer& GeometryRaw(Texture* texture, const float* xy, int xy_stride, const SDL_Color* color, int color_stride, const float* uv, int uv_stride, int num_vertices, const void* indices = nullptr, int num_indices = 0, int size_indices = 4);
+#endif
+
 	////////////////////////////////////////////////////////////
 	/// \brief Read pixels from the current rendering target
 	///
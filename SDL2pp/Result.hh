@@ -0,0 +1,152 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_RESULT_HH
+#define SDL2PP_RESULT_HH
+
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+////////////////////////////////////////////////////////////
+/// \brief Outcome of SDL2 function call
+///
+/// \ingroup general
+///
+/// \headerfile SDL2pp/Result.hh
+///
+/// Returned by non-throwing Try* counterparts of wrapper
+/// methods, such as Renderer::TryCopy() or Mixer::TryPlayChannel().
+/// This is useful on paths where failures are expected and
+/// throwing SDL2pp::Exception, which copies the error text,
+/// is too costly.
+///
+/// Result is just a pair of failed function name and return
+/// value, so constructing and returning it never allocates.
+/// Error text is not stored and is fetched with SDL_GetError()
+/// on request, so it must be retrieved before any other SDL
+/// call is made on the same thread.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::Result result = renderer.TryCopy(texture);
+///     if (!result) {
+///         std::cerr << result.GetSDLFunction() << " failed: "
+///                   << result.GetSDLError() << std::endl;
+///         // recreate lost texture
+///     }
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT Result {
+private:
+	const char* sdl_function_; ///< SDL function which failed, nullptr on success
+	int value_;                ///< Value returned by SDL function
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Construct successful result
+	///
+	/// \param[in] value Value returned by SDL function
+	///
+	////////////////////////////////////////////////////////////
+	constexpr explicit Result(int value = 0) noexcept : sdl_function_(nullptr), value_(value) {
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct failed result
+	///
+	/// \param[in] function Name of SDL function which failed,
+	///                     must be a string literal
+	/// \param[in] value Value returned by SDL function
+	///
+	////////////////////////////////////////////////////////////
+	constexpr Result(const char* function, int value) noexcept : sdl_function_(function), value_(value) {
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check whether the call succeeded
+	///
+	/// \returns True on success
+	///
+	////////////////////////////////////////////////////////////
+	constexpr explicit operator bool() const noexcept {
+		return sdl_function_ == nullptr;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check whether the call failed
+	///
+	/// \returns True on failure
+	///
+	////////////////////////////////////////////////////////////
+	constexpr bool IsError() const noexcept {
+		return sdl_function_ != nullptr;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get value returned by SDL function
+	///
+	/// \returns Error code on failure, or function specific
+	///          value (such as channel number) on success
+	///
+	////////////////////////////////////////////////////////////
+	constexpr int GetValue() const noexcept {
+		return value_;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get name of SDL function which failed
+	///
+	/// \returns Function name or nullptr on success
+	///
+	////////////////////////////////////////////////////////////
+	constexpr const char* GetSDLFunction() const noexcept {
+		return sdl_function_;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get SDL2 error text
+	///
+	/// \returns Current result of SDL_GetError(), or empty string
+	///          on success
+	///
+	/// \see http://wiki.libsdl.org/SDL_GetError
+	///
+	////////////////////////////////////////////////////////////
+	const char* GetSDLError() const noexcept;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Throw on failure
+	///
+	/// \returns Value returned by SDL function
+	///
+	/// \throws SDL2pp::Exception if the call failed
+	///
+	////////////////////////////////////////////////////////////
+	int ThrowIfFailed() const;
+};
+
+}
+
+#endif
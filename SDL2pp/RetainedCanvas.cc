@@ -0,0 +1,132 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <vector>
+
+#include <SDL_render.h>
+
+#include <SDL2pp/RetainedCanvas.hh>
+#include <SDL2pp/Renderer.hh>
+#include <SDL2pp/private/TargetGuard.hh>
+
+namespace SDL2pp {
+
+namespace {
+
+// Output size of the renderer itself; with a target bound, SDL
+// reports size of the target texture instead
+Point GetWindowOutputSize(Renderer& renderer) {
+	if (SDL_GetRenderTarget(renderer.Get()) == nullptr)
+		return renderer.GetOutputSize();
+
+	Private::TargetGuard guard(renderer);
+	renderer.SetTarget();
+	return renderer.GetOutputSize();
+}
+
+Texture CreateTarget(Renderer& renderer, Uint32 format, const Point& size) {
+	Texture target(renderer, format, SDL_TEXTUREACCESS_TARGET, size.x, size.y);
+	target.SetBlendMode(SDL_BLENDMODE_NONE);
+	return target;
+}
+
+}
+
+RetainedCanvas::RetainedCanvas(Renderer& renderer, Uint32 format)
+	: renderer_(renderer),
+	  format_(format),
+	  target_(CreateTarget(renderer, format, GetWindowOutputSize(renderer))),
+	  max_rects_(32) {
+	InvalidateAll();
+}
+
+void RetainedCanvas::UpdateSize() {
+	Point size = GetWindowOutputSize(renderer_);
+	if (size == target_.GetSize())
+		return;
+
+	target_ = CreateTarget(renderer_, format_, size);
+	InvalidateAll();
+}
+
+void RetainedCanvas::Invalidate(const Rect& rect) {
+	damage_.Union(rect);
+}
+
+void RetainedCanvas::Invalidate(const Region& region) {
+	damage_.Union(region);
+}
+
+void RetainedCanvas::InvalidateAll() {
+	damage_ = Region(Rect(Point(0, 0), target_.GetSize()));
+}
+
+const Region& RetainedCanvas::GetDamage() const {
+	return damage_;
+}
+
+void RetainedCanvas::SetMaxRects(size_t max_rects) {
+	max_rects_ = max_rects;
+}
+
+bool RetainedCanvas::Redraw(const DrawFunction& draw) {
+	UpdateSize();
+
+	// damage outside of canvas is irrelevant
+	damage_.Intersect(Rect(Point(0, 0), target_.GetSize()));
+	if (damage_.IsEmpty())
+		return false;
+
+	Private::TargetGuard guard(renderer_);
+	renderer_.SetTarget(target_);
+
+	// damage is removed as areas are redrawn, so if drawing
+	// function throws, areas not yet redrawn stay damaged
+	if (damage_.GetNumRects() > max_rects_) {
+		Rect area = damage_.GetBoundingBox();
+		renderer_.SetClipRect(area);
+		draw(renderer_, area);
+		damage_.Clear();
+	} else {
+		const std::vector<Rect> areas = damage_.GetRects();
+		for (const Rect& area : areas) {
+			renderer_.SetClipRect(area);
+			draw(renderer_, area);
+			damage_.Subtract(area);
+		}
+	}
+
+	return true;
+}
+
+void RetainedCanvas::Draw() {
+	renderer_.Copy(target_);
+}
+
+Texture& RetainedCanvas::GetTexture() {
+	return target_;
+}
+
+Point RetainedCanvas::GetSize() const {
+	return target_.GetSize();
+}
+
+}
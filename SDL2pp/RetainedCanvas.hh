@@ -0,0 +1,224 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_RETAINEDCANVAS_HH
+#define SDL2PP_RETAINEDCANVAS_HH
+
+#include <cstddef>
+#include <functional>
+
+#include <SDL_stdinc.h>
+#include <SDL_pixels.h>
+
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Region.hh>
+#include <SDL2pp/Texture.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+class Renderer;
+
+////////////////////////////////////////////////////////////
+/// \brief Persistent render target redrawn only where damaged
+///
+/// \ingroup rendering
+///
+/// \headerfile SDL2pp/RetainedCanvas.hh
+///
+/// Mostly static scenes, such as UIs, do not need to be
+/// repainted completely each frame. This class keeps rendered
+/// scene in a target texture of the output size, accumulates
+/// damaged areas in a Region, and on Redraw() calls drawing
+/// function only for damaged rectangles, with clip rect set to
+/// each of them. The texture is then copied to the output with
+/// a single Renderer::Copy() call.
+///
+/// Canvas is sized to the output of the renderer itself, also
+/// when another rendering target is bound while it's created or
+/// redrawn. Whole canvas is damaged initially and when output size
+/// changes. Contents of target textures may be lost by some
+/// renderers (see SDL_RENDER_TARGETS_RESET event), in which
+/// case InvalidateAll() must be called.
+///
+/// Canvas must not outlive the renderer.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::RetainedCanvas canvas(renderer);
+///
+///     while (running) {
+///         for (auto& widget : changed_widgets)
+///             canvas.Invalidate(widget.GetRect());
+///
+///         canvas.Redraw([&](SDL2pp::Renderer& renderer, const SDL2pp::Rect& area) {
+///             ui.Draw(renderer, area);
+///         });
+///
+///         canvas.Draw();
+///         renderer.Present();
+///     }
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT RetainedCanvas {
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Function which redraws part of the canvas
+	///
+	/// Called with renderer targeting canvas texture and clip
+	/// rect set to the area which needs redrawing; everything
+	/// intersecting the area should be drawn.
+	///
+	////////////////////////////////////////////////////////////
+	typedef std::function<void(Renderer& renderer, const Rect& area)> DrawFunction;
+
+private:
+	Renderer& renderer_;   ///< Renderer the canvas is drawn with
+	Uint32 format_;        ///< Pixel format of target texture
+	Texture target_;       ///< Persistent target texture
+	Region damage_;        ///< Areas which need redrawing
+	size_t max_rects_;     ///< Max number of rects redrawn separately
+
+private:
+	////////////////////////////////////////////////////////////
+	/// \brief Recreate target texture if window output size has changed
+	///
+	////////////////////////////////////////////////////////////
+	void UpdateSize();
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Create canvas of renderer output size
+	///
+	/// \param[in] renderer Renderer to use
+	/// \param[in] format Pixel format of target texture
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	explicit RetainedCanvas(Renderer& renderer, Uint32 format = SDL_PIXELFORMAT_ARGB8888);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted copy constructor
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	RetainedCanvas(const RetainedCanvas& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted assignment operator
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	RetainedCanvas& operator=(const RetainedCanvas& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Mark area as needing redraw
+	///
+	/// \param[in] rect Damaged area
+	///
+	////////////////////////////////////////////////////////////
+	void Invalidate(const Rect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Mark area as needing redraw
+	///
+	/// \param[in] region Damaged area
+	///
+	////////////////////////////////////////////////////////////
+	void Invalidate(const Region& region);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Mark whole canvas as needing redraw
+	///
+	////////////////////////////////////////////////////////////
+	void InvalidateAll();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get areas which need redrawing
+	///
+	/// \returns Damaged region
+	///
+	////////////////////////////////////////////////////////////
+	const Region& GetDamage() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set max number of separately redrawn rectangles
+	///
+	/// As drawing function is called once per rectangle, heavily
+	/// fragmented damage is instead redrawn as a single bounding
+	/// box, which is cheaper than many calls.
+	///
+	/// \param[in] max_rects Max number of rectangles
+	///
+	////////////////////////////////////////////////////////////
+	void SetMaxRects(size_t max_rects);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Redraw damaged areas
+	///
+	/// Renderer target, viewport, clip rect, scale and draw color
+	/// are restored afterwards, also when drawing function throws. In that case, areas
+	/// which were not redrawn stay damaged.
+	///
+	/// \param[in] draw Function which draws the scene
+	///
+	/// \returns True if anything was redrawn
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	bool Redraw(const DrawFunction& draw);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Copy canvas to current rendering target
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	void Draw();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get target texture
+	///
+	/// \returns Texture holding canvas contents
+	///
+	////////////////////////////////////////////////////////////
+	Texture& GetTexture();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get canvas size
+	///
+	/// \returns Canvas size in pixels
+	///
+	////////////////////////////////////////////////////////////
+	Point GetSize() const;
+};
+
+}
+
+#endif
@@ -33,7 +33,9 @@
 ////////////////////////////////////////////////////////////
 #include <SDL2pp/SDL.hh>
 #include <SDL2pp/Exception.hh>
+#include <SDL2pp/Result.hh>
 #include <SDL2pp/Optional.hh>
+#include <SDL2pp/Profiler.hh>
 
 ////////////////////////////////////////////////////////////
 /// \defgroup audio Audio
@@ -73,6 +75,16 @@
 #include <SDL2pp/Renderer.hh>
 #include <SDL2pp/Surface.hh>
 #include <SDL2pp/Texture.hh>
+#include <SDL2pp/PixelView.hh>
+#include <SDL2pp/MipmappedTexture.hh>
+#include <SDL2pp/RenderTargetPool.hh>
+#include <SDL2pp/SurfacePool.hh>
+#include <SDL2pp/FrameCapture.hh>
+#include <SDL2pp/RetainedCanvas.hh>
+#include <SDL2pp/TileMap.hh>
+#include <SDL2pp/TiledRasterizer.hh>
+#include <SDL2pp/ParticleSystem.hh>
+#include <SDL2pp/VertexBuffer.hh>
 #include <SDL2pp/Color.hh>
 
 ////////////////////////////////////////////////////////////
@@ -85,6 +97,12 @@
 ////////////////////////////////////////////////////////////
 #include <SDL2pp/Rect.hh>
 #include <SDL2pp/Point.hh>
+#include <SDL2pp/FRect.hh>
+#include <SDL2pp/FPoint.hh>
+#include <SDL2pp/PointArray.hh>
+#include <SDL2pp/RectArray.hh>
+#include <SDL2pp/SpatialGrid.hh>
+#include <SDL2pp/Region.hh>
 
 ////////////////////////////////////////////////////////////
 /// \defgroup io I/O abstraction
@@ -106,6 +124,7 @@
 ////////////////////////////////////////////////////////////
 #	include <SDL2pp/SDLTTF.hh>
 #	include <SDL2pp/Font.hh>
+#	include <SDL2pp/TextLayout.hh>
 #endif
 
 #ifdef SDL2PP_WITH_IMAGE
@@ -0,0 +1,269 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <SDL2pp/SpatialGrid.hh>
+
+namespace SDL2pp {
+
+namespace {
+
+int FloorDiv(int value, int divisor) {
+	int quotient = value / divisor;
+	if (value % divisor < 0)
+		quotient--;
+	return quotient;
+}
+
+// Items covering more cells are tested by every query instead,
+// as storing them would take time and memory proportional to
+// their area
+const long long max_item_cells = 64;
+
+// Empty cells are purged when there are more of these
+const size_t min_purged_cells = 256;
+
+}
+
+SpatialGrid::SpatialGrid(int cell_size) : cell_size_(cell_size), num_empty_cells_(0), query_stamp_(0) {
+	if (cell_size <= 0)
+		throw std::invalid_argument("Cell size must be positive");
+}
+
+Rect SpatialGrid::GetCellRange(const Rect& rect) const {
+	// for degenerate rects, X2 < X; covering both ends is enough
+	// for any rect which Intersects() this one to share a cell
+	const int x1 = FloorDiv(std::min(rect.x, rect.GetX2()), cell_size_);
+	const int y1 = FloorDiv(std::min(rect.y, rect.GetY2()), cell_size_);
+	const int x2 = FloorDiv(std::max(rect.x, rect.GetX2()), cell_size_);
+	const int y2 = FloorDiv(std::max(rect.y, rect.GetY2()), cell_size_);
+	return Rect::FromCorners(x1, y1, x2, y2);
+}
+
+Rect SpatialGrid::GetCellKey(int x, int y) const {
+	return Rect(x * cell_size_, y * cell_size_, cell_size_, cell_size_);
+}
+
+bool SpatialGrid::IsLarge(const Rect& cells) {
+	return static_cast<long long>(cells.w) * cells.h > max_item_cells;
+}
+
+void SpatialGrid::Link(size_t id, const Rect& cells) {
+	if (IsLarge(cells)) {
+		large_items_.push_back(id);
+		return;
+	}
+
+	for (int y = cells.y; y <= cells.GetY2(); y++) {
+		for (int x = cells.x; x <= cells.GetX2(); x++) {
+			auto cell = cells_.try_emplace(GetCellKey(x, y));
+			if (!cell.second && cell.first->second.empty())
+				num_empty_cells_--;
+			cell.first->second.push_back(id);
+		}
+	}
+}
+
+void SpatialGrid::Unlink(size_t id, const Rect& cells) {
+	if (IsLarge(cells)) {
+		auto found = std::find(large_items_.begin(), large_items_.end(), id);
+		if (found != large_items_.end()) {
+			*found = large_items_.back();
+			large_items_.pop_back();
+		}
+		return;
+	}
+
+	for (int y = cells.y; y <= cells.GetY2(); y++) {
+		for (int x = cells.x; x <= cells.GetX2(); x++) {
+			auto cell = cells_.find(GetCellKey(x, y));
+			if (cell == cells_.end())
+				continue;
+
+			std::vector<size_t>& ids = cell->second;
+			auto found = std::find(ids.begin(), ids.end(), id);
+			if (found != ids.end()) {
+				*found = ids.back();
+				ids.pop_back();
+				if (ids.empty())
+					num_empty_cells_++;
+			}
+		}
+	}
+
+	// items wandering over an unbounded area would otherwise
+	// leave an ever growing trail of empty cells
+	if (num_empty_cells_ > min_purged_cells && num_empty_cells_ > cells_.size() / 2) {
+		for (auto cell = cells_.begin(); cell != cells_.end(); ) {
+			if (cell->second.empty())
+				cell = cells_.erase(cell);
+			else
+				++cell;
+		}
+		num_empty_cells_ = 0;
+	}
+}
+
+Uint32 SpatialGrid::NextQueryStamp() {
+	// on wraparound, stale stamps could match again, so reset them
+	if (++query_stamp_ == 0) {
+		for (Item& item : items_)
+			item.query_stamp = 0;
+		query_stamp_ = 1;
+	}
+	return query_stamp_;
+}
+
+size_t SpatialGrid::Insert(const Rect& rect) {
+	size_t id;
+	if (free_ids_.empty()) {
+		id = items_.size();
+		items_.push_back(Item());
+	} else {
+		id = free_ids_.back();
+		free_ids_.pop_back();
+	}
+
+	Item& item = items_[id];
+	item.rect = rect;
+	item.cells = GetCellRange(rect);
+	item.query_stamp = 0;
+	item.alive = true;
+
+	Link(id, item.cells);
+
+	return id;
+}
+
+void SpatialGrid::Move(size_t id, const Rect& rect) {
+	if (id >= items_.size() || !items_[id].alive)
+		throw std::out_of_range("No such item in spatial grid");
+
+	Item& item = items_[id];
+	Rect cells = GetCellRange(rect);
+
+	if (cells != item.cells) {
+		Unlink(id, item.cells);
+		Link(id, cells);
+		item.cells = cells;
+	}
+
+	item.rect = rect;
+}
+
+void SpatialGrid::Remove(size_t id) {
+	if (id >= items_.size() || !items_[id].alive)
+		throw std::out_of_range("No such item in spatial grid");
+
+	Unlink(id, items_[id].cells);
+	items_[id].alive = false;
+	free_ids_.push_back(id);
+}
+
+void SpatialGrid::Clear() {
+	items_.clear();
+	free_ids_.clear();
+	cells_.clear();
+	num_empty_cells_ = 0;
+	large_items_.clear();
+}
+
+const Rect& SpatialGrid::GetRect(size_t id) const {
+	if (id >= items_.size() || !items_[id].alive)
+		throw std::out_of_range("No such item in spatial grid");
+
+	return items_[id].rect;
+}
+
+size_t SpatialGrid::GetNumItems() const {
+	return items_.size() - free_ids_.size();
+}
+
+size_t SpatialGrid::GetNumCells() const {
+	return cells_.size() - num_empty_cells_;
+}
+
+int SpatialGrid::GetCellSize() const {
+	return cell_size_;
+}
+
+size_t SpatialGrid::Query(const Rect& rect, std::vector<size_t>& result) {
+	const Rect cells = GetCellRange(rect);
+	const size_t initial_size = result.size();
+
+	// when query covers more cells than there are stored, it's
+	// cheaper to just test all items
+	if (static_cast<long long>(cells.w) * cells.h > static_cast<long long>(GetNumCells())) {
+		for (size_t id = 0; id < items_.size(); id++)
+			if (items_[id].alive && rect.Intersects(items_[id].rect))
+				result.push_back(id);
+		return result.size() - initial_size;
+	}
+
+	const Uint32 stamp = NextQueryStamp();
+
+	for (int y = cells.y; y <= cells.GetY2(); y++) {
+		for (int x = cells.x; x <= cells.GetX2(); x++) {
+			auto cell = cells_.find(GetCellKey(x, y));
+			if (cell == cells_.end())
+				continue;
+
+			for (size_t id : cell->second) {
+				Item& item = items_[id];
+				if (item.query_stamp == stamp)
+					continue;
+
+				// items spanning several cells are tested once
+				item.query_stamp = stamp;
+				if (rect.Intersects(item.rect))
+					result.push_back(id);
+			}
+		}
+	}
+
+	for (size_t id : large_items_)
+		if (rect.Intersects(items_[id].rect))
+			result.push_back(id);
+
+	return result.size() - initial_size;
+}
+
+size_t SpatialGrid::Query(const Point& point, std::vector<size_t>& result) const {
+	const size_t initial_size = result.size();
+
+	// each item is stored in a cell at most once, so
+	// no deduplication is needed for a single cell
+	auto cell = cells_.find(GetCellKey(FloorDiv(point.x, cell_size_), FloorDiv(point.y, cell_size_)));
+	if (cell != cells_.end())
+		for (size_t id : cell->second)
+			if (items_[id].rect.Contains(point))
+				result.push_back(id);
+
+	for (size_t id : large_items_)
+		if (items_[id].rect.Contains(point))
+			result.push_back(id);
+
+	return result.size() - initial_size;
+}
+
+}
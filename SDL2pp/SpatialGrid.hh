@@ -0,0 +1,288 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_SPATIALGRID_HH
+#define SDL2PP_SPATIALGRID_HH
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL_stdinc.h>
+
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+////////////////////////////////////////////////////////////
+/// \brief Uniform grid spatial index over rectangles
+///
+/// \ingroup geometry
+///
+/// \headerfile SDL2pp/SpatialGrid.hh
+///
+/// Speeds up picking and culling over large sets of
+/// rectangles, such as UI elements or tile map objects,
+/// by only testing items which share grid cells with the
+/// query. Grid is sparse and unbounded: only cells which
+/// contain items are stored, in a hash table keyed by cell
+/// Rect. Query results follow Rect::Intersects() and
+/// Rect::Contains() semantics exactly.
+///
+/// Items are referred to by ids returned by Insert(). Ids
+/// are assigned sequentially starting from 0, and ids of
+/// removed items are reused. Cell size should be close
+/// to a typical item size: small items in huge cells are
+/// tested needlessly. Items covering more than 64 cells,
+/// such as backgrounds, are not stored in cells at all, but
+/// kept in a separate list tested by every query, so these
+/// should be few.
+///
+/// Rect queries mark tested items to skip duplicates, so they
+/// are not const, and a grid shared between threads needs
+/// external locking for them. Const methods, including point
+/// queries, may be called concurrently.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::SpatialGrid grid(64);
+///     std::vector<Widget*> widgets;
+///
+///     for (auto& widget : ui) {
+///         grid.Insert(widget.GetRect());
+///         widgets.push_back(&widget);
+///     }
+///
+///     std::vector<size_t> hits;
+///     grid.Query(mouse_position, hits);
+///     for (size_t id : hits)
+///         widgets[id]->OnClick();
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT SpatialGrid {
+private:
+	struct Item {
+		Rect rect;                   ///< Item bounds
+		Rect cells;                  ///< Range of covered cells, in cell coordinates
+		Uint32 query_stamp;          ///< Stamp of last query which tested the item
+		bool alive;                  ///< Whether the item is not removed
+	};
+
+private:
+	int cell_size_;                                        ///< Size of grid cell in pixels
+	std::vector<Item> items_;                              ///< Items indexed by id
+	std::vector<size_t> free_ids_;                         ///< Ids of removed items
+	std::unordered_map<Rect, std::vector<size_t>> cells_;  ///< Ids of items covering each cell
+	size_t num_empty_cells_;                               ///< Number of cells kept with no items
+	std::vector<size_t> large_items_;                      ///< Ids of items covering too many cells
+	Uint32 query_stamp_;                                   ///< Stamp of current query
+
+private:
+	////////////////////////////////////////////////////////////
+	/// \brief Get range of cells covered by rectangle
+	///
+	/// \param[in] rect Rectangle
+	///
+	/// \returns Range of cell coordinates
+	///
+	////////////////////////////////////////////////////////////
+	Rect GetCellRange(const Rect& rect) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get hash table key of cell
+	///
+	/// \param[in] x Horizontal cell coordinate
+	/// \param[in] y Vertical cell coordinate
+	///
+	/// \returns Rect covered by the cell
+	///
+	////////////////////////////////////////////////////////////
+	Rect GetCellKey(int x, int y) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check whether item is kept in large items list
+	///
+	/// \param[in] cells Range of cells covered by the item
+	///
+	/// \returns True if item covers too many cells to be stored
+	///          in each of them
+	///
+	////////////////////////////////////////////////////////////
+	static bool IsLarge(const Rect& cells);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Add item to cells in given range
+	///
+	/// \param[in] id Item id
+	/// \param[in] cells Range of cells
+	///
+	////////////////////////////////////////////////////////////
+	void Link(size_t id, const Rect& cells);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Remove item from cells in given range
+	///
+	/// Emptied cells are kept, so items moving back and forth
+	/// do not reallocate them, until there are more empty cells
+	/// than non-empty ones.
+	///
+	/// \param[in] id Item id
+	/// \param[in] cells Range of cells
+	///
+	////////////////////////////////////////////////////////////
+	void Unlink(size_t id, const Rect& cells);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Start new query
+	///
+	/// \returns Stamp used to skip items reported more than once
+	///
+	////////////////////////////////////////////////////////////
+	Uint32 NextQueryStamp();
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Construct empty grid
+	///
+	/// \param[in] cell_size Size of square grid cell in pixels
+	///
+	/// \throws std::invalid_argument if cell size is not positive
+	///
+	////////////////////////////////////////////////////////////
+	explicit SpatialGrid(int cell_size = 64);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Add item to the index
+	///
+	/// \param[in] rect Item bounds
+	///
+	/// \returns Item id
+	///
+	////////////////////////////////////////////////////////////
+	size_t Insert(const Rect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Change item bounds
+	///
+	/// This is cheap if item stays within the same cells.
+	///
+	/// \param[in] id Item id
+	/// \param[in] rect New item bounds
+	///
+	/// \throws std::out_of_range if there's no such item
+	///
+	////////////////////////////////////////////////////////////
+	void Move(size_t id, const Rect& rect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Remove item from the index
+	///
+	/// \param[in] id Item id
+	///
+	/// \throws std::out_of_range if there's no such item
+	///
+	////////////////////////////////////////////////////////////
+	void Remove(size_t id);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Remove all items
+	///
+	////////////////////////////////////////////////////////////
+	void Clear();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get item bounds
+	///
+	/// \param[in] id Item id
+	///
+	/// \returns Item bounds
+	///
+	/// \throws std::out_of_range if there's no such item
+	///
+	////////////////////////////////////////////////////////////
+	const Rect& GetRect(size_t id) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of items
+	///
+	/// \returns Number of items in the index
+	///
+	////////////////////////////////////////////////////////////
+	size_t GetNumItems() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of non-empty cells
+	///
+	/// \returns Number of cells which contain items
+	///
+	////////////////////////////////////////////////////////////
+	size_t GetNumCells() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get cell size
+	///
+	/// \returns Size of grid cell in pixels
+	///
+	////////////////////////////////////////////////////////////
+	int GetCellSize() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Find items intersecting given rectangle
+	///
+	/// \param[in] rect Rectangle to test items against
+	/// \param[out] result Vector to append ids of found items to;
+	///                    each item is reported once, in no
+	///                    particular order
+	///
+	/// \returns Number of found items
+	///
+	/// This method marks tested items to report each of them
+	/// once, so it modifies the grid and must not be called
+	/// concurrently with any other method.
+	///
+	/// \see Rect::Intersects
+	///
+	////////////////////////////////////////////////////////////
+	size_t Query(const Rect& rect, std::vector<size_t>& result);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Find items containing given point
+	///
+	/// \param[in] point Point to test items against
+	/// \param[out] result Vector to append ids of found items to,
+	///                    in no particular order
+	///
+	/// \returns Number of found items
+	///
+	/// \see Rect::Contains
+	///
+	////////////////////////////////////////////////////////////
+	size_t Query(const Point& point, std::vector<size_t>& result) const;
+};
+
+}
+
+#endif
@@ -20,6 +20,7 @@
 */
 
 #include <vector>
+#include <algorithm>
 #include <cassert>
 
 #include <SDL2pp/Config.hh>
@@ -31,12 +32,90 @@
 
 #include <SDL2pp/Surface.hh>
 #include <SDL2pp/Exception.hh>
+#include <SDL2pp/Profiler.hh>
 #ifdef SDL2PP_WITH_IMAGE
 #	include <SDL2pp/RWops.hh>
 #endif
 
 namespace SDL2pp {
 
+namespace {
+
+// Exact rounded c * a / 255 without division
+inline Uint32 MulDiv255(Uint32 c, Uint32 a) {
+	Uint32 t = c * a + 128;
+	return (t + (t >> 8)) >> 8;
+}
+
+// 16.16 fixed point reciprocals used to undo premultiplication
+struct UnpremultiplyTable {
+	Uint32 recip[256];
+
+	UnpremultiplyTable() {
+		recip[0] = 0;
+		for (Uint32 a = 1; a < 256; ++a)
+			recip[a] = (255u * 65536u + a / 2) / a;
+	}
+};
+
+bool IsFast32BitAlphaFormat(const SDL_PixelFormat& format) {
+	return format.BytesPerPixel == 4 && format.Amask != 0 && format.Aloss == 0 && format.Rloss == 0 && format.Gloss == 0 && format.Bloss == 0;
+}
+
+void PremultiplyRow32(Uint32* row, int width, const SDL_PixelFormat& format) {
+	const Uint32 rs = format.Rshift, gs = format.Gshift, bs = format.Bshift, as = format.Ashift;
+
+	// branchless body so the compiler can vectorize it
+	for (int x = 0; x < width; ++x) {
+		Uint32 p = row[x];
+		Uint32 a = (p >> as) & 0xff;
+		Uint32 r = MulDiv255((p >> rs) & 0xff, a);
+		Uint32 g = MulDiv255((p >> gs) & 0xff, a);
+		Uint32 b = MulDiv255((p >> bs) & 0xff, a);
+		row[x] = (r << rs) | (g << gs) | (b << bs) | (a << as);
+	}
+}
+
+void UnpremultiplyRow32(Uint32* row, int width, const SDL_PixelFormat& format, const UnpremultiplyTable& table) {
+	const Uint32 rs = format.Rshift, gs = format.Gshift, bs = format.Bshift, as = format.Ashift;
+
+	for (int x = 0; x < width; ++x) {
+		Uint32 p = row[x];
+		Uint32 a = (p >> as) & 0xff;
+		Uint32 recip = table.recip[a];
+		Uint32 r = std::min<Uint32>((((p >> rs) & 0xff) * recip + 0x8000) >> 16, 255);
+		Uint32 g = std::min<Uint32>((((p >> gs) & 0xff) * recip + 0x8000) >> 16, 255);
+		Uint32 b = std::min<Uint32>((((p >> bs) & 0xff) * recip + 0x8000) >> 16, 255);
+		row[x] = (r << rs) | (g << gs) | (b << bs) | (a << as);
+	}
+}
+
+// Slow path for 16 and 32 bit formats with non-byte alpha channel
+template<class T, class F>
+void ForEachPixelGeneric(SDL_Surface* surface, F&& func) {
+	const SDL_PixelFormat* format = surface->format;
+
+	for (int y = 0; y < surface->h; ++y) {
+		T* row = reinterpret_cast<T*>(static_cast<Uint8*>(surface->pixels) + y * surface->pitch);
+		for (int x = 0; x < surface->w; ++x) {
+			Uint8 r, g, b, a;
+			SDL_GetRGBA(row[x], format, &r, &g, &b, &a);
+			func(r, g, b, a);
+			row[x] = static_cast<T>(SDL_MapRGBA(format, r, g, b, a));
+		}
+	}
+}
+
+template<class F>
+void ForEachPixelGeneric(SDL_Surface* surface, F&& func) {
+	if (surface->format->BytesPerPixel == 2)
+		ForEachPixelGeneric<Uint16>(surface, func);
+	else if (surface->format->BytesPerPixel == 4)
+		ForEachPixelGeneric<Uint32>(surface, func);
+}
+
+}
+
 Surface::Surface(SDL_Surface* surface) : surface_(surface) {
 	assert(surface);
 }
@@ -87,6 +166,8 @@ SDL_Surface* Surface::Get() const {
 }
 
 Surface Surface::Convert(const SDL_PixelFormat& format) {
+	SDL2PP_PROFILE_SCOPE(SurfaceConvert);
+
 	SDL_Surface* surface = SDL_ConvertSurface(surface_, &format, 0);
 	if (surface == nullptr)
 		throw Exception("SDL_ConvertSurface");
@@ -94,6 +175,8 @@ Surface Surface::Convert(const SDL_PixelFormat& format) {
 }
 
 Surface Surface::Convert(Uint32 pixel_format) {
+	SDL2PP_PROFILE_SCOPE(SurfaceConvert);
+
 	SDL_Surface* surface = SDL_ConvertSurfaceFormat(surface_, pixel_format, 0);
 	if (surface == nullptr)
 		throw Exception("SDL_ConvertSurfaceFormat");
@@ -101,17 +184,31 @@ Surface Surface::Convert(Uint32 pixel_format) {
 }
 
 void Surface::Blit(const Optional<Rect>& srcrect, Surface& dst, const Rect& dstrect) {
+	TryBlit(srcrect, dst, dstrect).ThrowIfFailed();
+}
+
+void Surface::BlitScaled(const Optional<Rect>& srcrect, Surface& dst, const Optional<Rect>& dstrect) {
+	TryBlitScaled(srcrect, dst, dstrect).ThrowIfFailed();
+}
+
+Result Surface::TryBlit(const Optional<Rect>& srcrect, Surface& dst, const Rect& dstrect) {
+	SDL2PP_PROFILE_SCOPE(SurfaceBlit);
+
 	SDL_Rect tmpdstrect = dstrect; // 4th argument is non-const; does it modify rect?
 	if (SDL_BlitSurface(surface_, srcrect ? &*srcrect : nullptr, dst.Get(), &tmpdstrect) != 0)
-		throw Exception("SDL_BlitSurface");
+		return Result("SDL_BlitSurface", -1);
+	return Result();
 }
 
-void Surface::BlitScaled(const Optional<Rect>& srcrect, Surface& dst, const Optional<Rect>& dstrect) {
+Result Surface::TryBlitScaled(const Optional<Rect>& srcrect, Surface& dst, const Optional<Rect>& dstrect) {
+	SDL2PP_PROFILE_SCOPE(SurfaceBlit);
+
 	SDL_Rect tmpdstrect; // 4th argument is non-const; does it modify rect?
 	if (dstrect)
 		tmpdstrect = *dstrect;
 	if (SDL_BlitScaled(surface_, srcrect ? &*srcrect : nullptr, dst.Get(), dstrect ? &tmpdstrect : nullptr) != 0)
-		throw Exception("SDL_BlitScaled");
+		return Result("SDL_BlitScaled", -1);
+	return Result();
 }
 
 Surface::LockHandle Surface::Lock() {
@@ -198,11 +295,16 @@ Surface& Surface::SetRLE(bool flag) {
 }
 
 Surface& Surface::FillRect(const Optional<Rect>& rect, Uint32 color) {
-	if (SDL_FillRect(surface_, rect ? &*rect : nullptr, color) != 0)
-		throw Exception("SDL_FillRect");
+	TryFillRect(rect, color).ThrowIfFailed();
 	return *this;
 }
 
+Result Surface::TryFillRect(const Optional<Rect>& rect, Uint32 color) {
+	if (SDL_FillRect(surface_, rect ? &*rect : nullptr, color) != 0)
+		return Result("SDL_FillRect", -1);
+	return Result();
+}
+
 Surface& Surface::FillRects(const Rect* rects, int count, Uint32 color) {
 	std::vector<SDL_Rect> sdl_rects;
 	sdl_rects.reserve(static_cast<size_t>(count));
@@ -214,6 +316,50 @@ Surface& Surface::FillRects(const Rect* rects, int count, Uint32 color) {
 	return *this;
 }
 
+Surface& Surface::PremultiplyAlpha() {
+	const SDL_PixelFormat& format = *surface_->format;
+	if (format.Amask == 0)
+		return *this;
+
+	LockHandle lock = Lock();
+
+	if (IsFast32BitAlphaFormat(format)) {
+		for (int y = 0; y < surface_->h; ++y)
+			PremultiplyRow32(reinterpret_cast<Uint32*>(static_cast<Uint8*>(lock.GetPixels()) + y * lock.GetPitch()), surface_->w, format);
+	} else {
+		ForEachPixelGeneric(surface_, [](Uint8& r, Uint8& g, Uint8& b, Uint8 a) {
+			r = static_cast<Uint8>(MulDiv255(r, a));
+			g = static_cast<Uint8>(MulDiv255(g, a));
+			b = static_cast<Uint8>(MulDiv255(b, a));
+		});
+	}
+
+	return *this;
+}
+
+Surface& Surface::UnpremultiplyAlpha() {
+	const SDL_PixelFormat& format = *surface_->format;
+	if (format.Amask == 0)
+		return *this;
+
+	static const UnpremultiplyTable table;
+
+	LockHandle lock = Lock();
+
+	if (IsFast32BitAlphaFormat(format)) {
+		for (int y = 0; y < surface_->h; ++y)
+			UnpremultiplyRow32(reinterpret_cast<Uint32*>(static_cast<Uint8*>(lock.GetPixels()) + y * lock.GetPitch()), surface_->w, format, table);
+	} else {
+		ForEachPixelGeneric(surface_, [](Uint8& r, Uint8& g, Uint8& b, Uint8 a) {
+			r = static_cast<Uint8>(std::min<Uint32>((r * table.recip[a] + 0x8000) >> 16, 255));
+			g = static_cast<Uint8>(std::min<Uint32>((g * table.recip[a] + 0x8000) >> 16, 255));
+			b = static_cast<Uint8>(std::min<Uint32>((b * table.recip[a] + 0x8000) >> 16, 255));
+		});
+	}
+
+	return *this;
+}
+
 int Surface::GetWidth() const {
 	return surface_->w;
 }
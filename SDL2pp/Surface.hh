@@ -29,6 +29,7 @@
 #include <SDL2pp/Optional.hh>
 #include <SDL2pp/Rect.hh>
 #include <SDL2pp/Point.hh>
+#include <SDL2pp/Result.hh>
 #include <SDL2pp/Export.hh>
 #include <SDL2pp/Color.hh>
 
@@ -55,6 +56,16 @@ private:
 	SDL_Surface* surface_; ///< Managed SDL_Surface object
 
 public:
+	////////////////////////////////////////////////////////////
+	/// \brief Filter used by Surface::Resample()
+	///
+	////////////////////////////////////////////////////////////
+	enum class ResampleFilter {
+		Box,      ///< Box filter (area average when downscaling, nearest when upscaling)
+		Bilinear, ///< Triangle filter
+		Lanczos3, ///< Lanczos filter with 3 lobes, sharpest and slowest
+	};
+
 	////////////////////////////////////////////////////////////
 	/// \brief SDL2pp::Surface lock
 	///
@@ -161,6 +172,15 @@ public:
 		///
 		////////////////////////////////////////////////////////////
 		const SDL_PixelFormat& GetFormat() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get dimensions of locked pixel data
+		///
+		/// \returns SDL2pp::Point representing width and height
+		///          of the surface in pixels
+		///
+		////////////////////////////////////////////////////////////
+		Point GetSize() const;
 	};
 
 public:
@@ -323,6 +343,20 @@ public:
 	////////////////////////////////////////////////////////////
 	void Blit(const Optional<Rect>& srcrect, Surface& dst, const Rect& dstrect);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of Blit()
+	///
+	/// \param[in] srcrect Rectangle to be copied, or NullOpt to copy the entire surface
+	/// \param[in] dst Blit target surface
+	/// \param[in] dstrect Rectangle that is copied into
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see Blit
+	///
+	////////////////////////////////////////////////////////////
+	Result TryBlit(const Optional<Rect>& srcrect, Surface& dst, const Rect& dstrect);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Scaled surface copy to a destination surface
 	///
@@ -337,6 +371,20 @@ public:
 	////////////////////////////////////////////////////////////
 	void BlitScaled(const Optional<Rect>& srcrect, Surface& dst, const Optional<Rect>& dstrect);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of BlitScaled()
+	///
+	/// \param[in] srcrect Rectangle to be copied, or NullOpt to copy the entire surface
+	/// \param[in] dst Blit target surface
+	/// \param[in] dstrect Rectangle that is copied into, or NullOpt to copy into entire surface
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see BlitScaled
+	///
+	////////////////////////////////////////////////////////////
+	Result TryBlitScaled(const Optional<Rect>& srcrect, Surface& dst, const Optional<Rect>& dstrect);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Lock surface for direct pixel access
 	///
@@ -537,6 +585,19 @@ public:
 	////////////////////////////////////////////////////////////
 	Surface& FillRect(const Optional<Rect>& rect, Uint32 color);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of FillRect()
+	///
+	/// \param[in] rect Rectangle to fill, or NullOpt to fill the entire surface
+	/// \param[in] color Color to fill with
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see FillRect
+	///
+	////////////////////////////////////////////////////////////
+	Result TryFillRect(const Optional<Rect>& rect, Uint32 color);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Perform a fast fill of a set of rectangles with a specific color
 	///
@@ -551,6 +612,207 @@ public:
 	////////////////////////////////////////////////////////////
 	Surface& FillRects(const Rect* rects, int count, Uint32 color);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Fill a rectangle blending color over existing pixels
+	///
+	/// Unlike FillRect(), which replaces pixels, this performs
+	/// alpha blending same as SDL_BLENDMODE_BLEND. Like other
+	/// drawing functions below, it respects surface clip rectangle
+	/// and has fast paths for ARGB8888 and ABGR8888 surfaces, for
+	/// which whole spans are blended in loops vectorized by the
+	/// compiler. Other formats go through SDL_GetRGBA() and
+	/// SDL_MapRGBA() per pixel.
+	///
+	/// \param[in] rect Rectangle to fill, or NullOpt to fill the entire surface
+	/// \param[in] color Color to blend
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Surface& BlendFillRect(const Optional<Rect>& rect, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Fill a set of rectangles blending color over existing pixels
+	///
+	/// \param[in] rects Array rectangles to be filled
+	/// \param[in] count Number of rectangles in the array
+	/// \param[in] color Color to blend
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see BlendFillRect
+	///
+	////////////////////////////////////////////////////////////
+	Surface& BlendFillRects(const Rect* rects, int count, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Draw an anti-aliased line
+	///
+	/// Coordinates are continuous, so center of pixel (0, 0)
+	/// is at (0.5, 0.5). Line is one pixel wide, and endpoint
+	/// pixels are covered in proportion to the part of them
+	/// the line spans.
+	///
+	/// \param[in] x1 X coordinate of the start point
+	/// \param[in] y1 Y coordinate of the start point
+	/// \param[in] x2 X coordinate of the end point
+	/// \param[in] y2 Y coordinate of the end point
+	/// \param[in] color Line color
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Surface& DrawLine(float x1, float y1, float x2, float y2, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Draw an anti-aliased circle outline
+	///
+	/// \param[in] x X coordinate of the center
+	/// \param[in] y Y coordinate of the center
+	/// \param[in] radius Circle radius
+	/// \param[in] color Outline color
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Surface& DrawCircle(float x, float y, float radius, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Draw a filled anti-aliased circle
+	///
+	/// Interior of the circle is blended as whole spans, only
+	/// edge pixels have coverage computed individually.
+	///
+	/// \param[in] x X coordinate of the center
+	/// \param[in] y Y coordinate of the center
+	/// \param[in] radius Circle radius
+	/// \param[in] color Fill color
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Surface& FillCircle(float x, float y, float radius, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Draw an anti-aliased closed polygon outline
+	///
+	/// Vertices are pixel coordinates, so lines pass through
+	/// centers of vertex pixels
+	///
+	/// \param[in] points Array of polygon vertices
+	/// \param[in] count Number of vertices
+	/// \param[in] color Outline color
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Surface& DrawPolygon(const Point* points, int count, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Draw a filled polygon
+	///
+	/// Polygon may be concave or self-intersecting, and is filled
+	/// with nonzero winding rule. Vertices are pixel coordinates,
+	/// as in DrawPolygon(); pixels on the top and left edges are
+	/// filled, while ones on the bottom and right edges are not,
+	/// so adjacent polygons do not overlap. Edges are not
+	/// anti-aliased; combine with DrawPolygon() for smooth edges.
+	///
+	/// \param[in] points Array of polygon vertices
+	/// \param[in] count Number of vertices
+	/// \param[in] color Fill color
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Surface& FillPolygon(const Point* points, int count, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Blend a color through an 8 bit coverage mask
+	///
+	/// Each pixel of the rectangle is blended with the color,
+	/// its alpha scaled by corresponding mask value, so this
+	/// may be used to draw anti-aliased glyphs and other
+	/// prerendered shapes in any color.
+	///
+	/// \param[in] rect Position and size of the mask in the surface
+	/// \param[in] mask Coverage values, rect.w by rect.h
+	/// \param[in] pitch Distance between mask rows in bytes
+	/// \param[in] color Color to blend
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Surface& BlendMask(const Rect& rect, const Uint8* mask, int pitch, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Convert surface pixels to premultiplied alpha in place
+	///
+	/// Each color component is multiplied by the pixel alpha value.
+	/// Surfaces without alpha channel are left untouched. 32 bit
+	/// formats with 8 bit alpha take a fast path which processes
+	/// whole rows at a time.
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see Texture::PremultipliedBlendMode
+	///
+	////////////////////////////////////////////////////////////
+	Surface& PremultiplyAlpha();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Convert surface pixels from premultiplied to straight alpha in place
+	///
+	/// This is inverse of PremultiplyAlpha(). Color of fully
+	/// transparent pixels is set to zero.
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Surface& UnpremultiplyAlpha();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create scaled copy of the surface using high quality filter
+	///
+	/// \param[in] srcrect Rectangle to be scaled, or NullOpt to scale the entire surface
+	/// \param[in] size Dimensions of the resulting surface
+	/// \param[in] filter Resampling filter to use
+	///
+	/// Unlike BlitScaled(), this performs proper separable
+	/// filtering, so downscaled images do not alias and upscaled
+	/// ones are not blocky. Surfaces with alpha channel are
+	/// filtered in premultiplied space, so transparent pixels do
+	/// not bleed their color into the result. Filter coefficients
+	/// are cached by source and destination size, so repeated
+	/// scaling between same sizes does not recompute them.
+	///
+	/// \returns New surface of the same pixel format
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Surface Resample(const Optional<Rect>& srcrect, const Point& size, ResampleFilter filter = ResampleFilter::Lanczos3);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Get surface width
 	///
@@ -0,0 +1,620 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <SDL_endian.h>
+#include <SDL_surface.h>
+
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/PixelView.hh>
+
+namespace SDL2pp {
+
+namespace {
+
+// Half-open clip bounds
+struct Clip {
+	int x1, y1, x2, y2;
+};
+
+// Exact rounding division by 255 for values up to 65535
+inline Uint32 Div255(Uint32 v) {
+	v += 128;
+	return (v + (v >> 8)) >> 8;
+}
+
+inline Uint32 CoverageAlpha(const Color& color, float coverage) {
+	return static_cast<Uint32>(color.a * std::min(std::max(coverage, 0.0f), 1.0f) + 0.5f);
+}
+
+// Conversions of coordinates to int which are clamped to given
+// range first, as far away coordinates do not fit into int. NaN
+// gives the lower bound
+inline int FloorClamped(float value, int low, int high) {
+	return static_cast<int>(std::floor(std::min(static_cast<float>(high), std::max(static_cast<float>(low), value))));
+}
+
+inline int CeilClamped(float value, int low, int high) {
+	return static_cast<int>(std::ceil(std::min(static_cast<float>(high), std::max(static_cast<float>(low), value))));
+}
+
+// Source over blending of a constant color, same as SDL_BLENDMODE_BLEND
+struct Blender {
+	Uint32 r, g, b, a, inv;
+
+	Blender(const Color& color, Uint32 alpha) : r(color.r * alpha), g(color.g * alpha), b(color.b * alpha), a(255 * alpha), inv(255 - alpha) {
+	}
+
+	Color operator()(const Color& dst) const {
+		return Color(
+				static_cast<Uint8>(Div255(r + dst.r * inv)),
+				static_cast<Uint8>(Div255(g + dst.g * inv)),
+				static_cast<Uint8>(Div255(b + dst.b * inv)),
+				static_cast<Uint8>(Div255(a + dst.a * inv))
+			);
+	}
+};
+
+// Fast target for 32 bit formats known at compile time: spans
+// are branchless loops of constant shifts, which are vectorized
+template <Uint32 Format>
+class FastTarget {
+private:
+	typedef PixelView<Format> View;
+	typedef typename View::PixelType PixelType;
+
+	View view_;
+	Clip clip_;
+
+public:
+	FastTarget(const Surface::LockHandle& lock, const Clip& clip) : view_(lock), clip_(clip) {
+	}
+
+	const Clip& GetClip() const {
+		return clip_;
+	}
+
+	void BlendSpan(int y, int x1, int x2, const Color& color, Uint32 alpha) {
+		x1 = std::max(x1, clip_.x1);
+		x2 = std::min(x2, clip_.x2);
+		if (y < clip_.y1 || y >= clip_.y2 || x1 >= x2 || alpha == 0)
+			return;
+
+		PixelType* row = view_.GetRow(y).begin();
+
+		if (alpha == 255) {
+			std::fill(row + x1, row + x2, View::MapRGBA(color.r, color.g, color.b, 255));
+			return;
+		}
+
+		const Blender blend(color, alpha);
+		for (int x = x1; x < x2; x++)
+			row[x] = View::MapColor(blend(View::GetColor(row[x])));
+	}
+
+	void BlendPixel(int x, int y, const Color& color, Uint32 alpha) {
+		if (x < clip_.x1 || x >= clip_.x2 || y < clip_.y1 || y >= clip_.y2 || alpha == 0)
+			return;
+
+		PixelType& pixel = view_(x, y);
+		pixel = View::MapColor(Blender(color, alpha)(View::GetColor(pixel)));
+	}
+
+	void BlendMaskSpan(int y, int x1, int x2, const Uint8* mask, const Color& color) {
+		const int start = std::max(x1, clip_.x1);
+		const int end = std::min(x2, clip_.x2);
+		if (y < clip_.y1 || y >= clip_.y2 || start >= end)
+			return;
+
+		PixelType* row = view_.GetRow(y).begin();
+		mask += start - x1;
+
+		// zero coverage blends to the same value, so no branch is needed
+		for (int x = start; x < end; x++)
+			row[x] = View::MapColor(Blender(color, Div255(mask[x - start] * color.a))(View::GetColor(row[x])));
+	}
+};
+
+// Slow target for any format, through SDL_GetRGBA()/SDL_MapRGBA()
+class GenericTarget {
+private:
+	Uint8* pixels_;
+	int pitch_;
+	const SDL_PixelFormat& format_;
+	Clip clip_;
+
+	Uint32 ReadPixel(const Uint8* p) const {
+		switch (format_.BytesPerPixel) {
+		case 1:
+			return *p;
+		case 2: {
+			Uint16 v;
+			std::memcpy(&v, p, sizeof(v));
+			return v;
+		}
+		case 3:
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+			return p[0] | (p[1] << 8) | (p[2] << 16);
+#else
+			return (p[0] << 16) | (p[1] << 8) | p[2];
+#endif
+		default: {
+			Uint32 v;
+			std::memcpy(&v, p, sizeof(v));
+			return v;
+		}
+		}
+	}
+
+	void WritePixel(Uint8* p, Uint32 v) const {
+		switch (format_.BytesPerPixel) {
+		case 1:
+			*p = static_cast<Uint8>(v);
+			break;
+		case 2: {
+			Uint16 v16 = static_cast<Uint16>(v);
+			std::memcpy(p, &v16, sizeof(v16));
+			break;
+		}
+		case 3:
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+			p[0] = static_cast<Uint8>(v);
+			p[1] = static_cast<Uint8>(v >> 8);
+			p[2] = static_cast<Uint8>(v >> 16);
+#else
+			p[0] = static_cast<Uint8>(v >> 16);
+			p[1] = static_cast<Uint8>(v >> 8);
+			p[2] = static_cast<Uint8>(v);
+#endif
+			break;
+		default:
+			std::memcpy(p, &v, sizeof(v));
+			break;
+		}
+	}
+
+	void Blend(Uint8* p, const Blender& blend) const {
+		Color dst;
+		SDL_GetRGBA(ReadPixel(p), &format_, &dst.r, &dst.g, &dst.b, &dst.a);
+		dst = blend(dst);
+		WritePixel(p, SDL_MapRGBA(&format_, dst.r, dst.g, dst.b, dst.a));
+	}
+
+public:
+	GenericTarget(const Surface::LockHandle& lock, const Clip& clip) : pixels_(static_cast<Uint8*>(lock.GetPixels())), pitch_(lock.GetPitch()), format_(lock.GetFormat()), clip_(clip) {
+	}
+
+	const Clip& GetClip() const {
+		return clip_;
+	}
+
+	void BlendSpan(int y, int x1, int x2, const Color& color, Uint32 alpha) {
+		x1 = std::max(x1, clip_.x1);
+		x2 = std::min(x2, clip_.x2);
+		if (y < clip_.y1 || y >= clip_.y2 || x1 >= x2 || alpha == 0)
+			return;
+
+		const Blender blend(color, alpha);
+		Uint8* p = pixels_ + y * pitch_ + x1 * format_.BytesPerPixel;
+		for (int x = x1; x < x2; x++, p += format_.BytesPerPixel)
+			Blend(p, blend);
+	}
+
+	void BlendPixel(int x, int y, const Color& color, Uint32 alpha) {
+		if (x < clip_.x1 || x >= clip_.x2 || y < clip_.y1 || y >= clip_.y2 || alpha == 0)
+			return;
+
+		Blend(pixels_ + y * pitch_ + x * format_.BytesPerPixel, Blender(color, alpha));
+	}
+
+	void BlendMaskSpan(int y, int x1, int x2, const Uint8* mask, const Color& color) {
+		const int start = std::max(x1, clip_.x1);
+		const int end = std::min(x2, clip_.x2);
+		if (y < clip_.y1 || y >= clip_.y2 || start >= end)
+			return;
+
+		mask += start - x1;
+
+		Uint8* p = pixels_ + y * pitch_ + start * format_.BytesPerPixel;
+		for (int x = start; x < end; x++, p += format_.BytesPerPixel) {
+			const Uint32 alpha = Div255(mask[x - start] * color.a);
+			if (alpha != 0)
+				Blend(p, Blender(color, alpha));
+		}
+	}
+};
+
+// Locks surface and runs func with the best target for its format
+template <class F>
+void Rasterize(Surface& surface, F&& func) {
+	Surface::LockHandle lock = surface.Lock();
+
+	const SDL_Rect& clip_rect = surface.Get()->clip_rect;
+	const Clip clip = { clip_rect.x, clip_rect.y, clip_rect.x + clip_rect.w, clip_rect.y + clip_rect.h };
+
+	switch (lock.GetFormat().format) {
+	case SDL_PIXELFORMAT_ARGB8888: {
+		FastTarget<SDL_PIXELFORMAT_ARGB8888> target(lock, clip);
+		func(target);
+		break;
+	}
+	case SDL_PIXELFORMAT_ABGR8888: {
+		FastTarget<SDL_PIXELFORMAT_ABGR8888> target(lock, clip);
+		func(target);
+		break;
+	}
+	default: {
+		GenericTarget target(lock, clip);
+		func(target);
+		break;
+	}
+	}
+}
+
+template <class Target>
+void BlendFillRectImpl(Target& target, const Rect& rect, const Color& color) {
+	const int y1 = std::max(rect.y, target.GetClip().y1);
+	const int y2 = std::min(rect.y + rect.h, target.GetClip().y2);
+	for (int y = y1; y < y2; y++)
+		target.BlendSpan(y, rect.x, rect.x + rect.w, color, color.a);
+}
+
+// Liang-Barsky clipping of a segment in pixel center coordinates
+// to the clip rectangle grown by a pixel, so antialiased edges
+// touching it are kept. Done in double, as huge coordinates would
+// lose all precision in float. Returns false if nothing is left
+bool ClipSegment(const Clip& clip, float& x1, float& y1, float& x2, float& y2) {
+	if (clip.x1 >= clip.x2 || clip.y1 >= clip.y2)
+		return false;
+	if (!std::isfinite(x1) || !std::isfinite(y1) || !std::isfinite(x2) || !std::isfinite(y2))
+		return false;
+
+	const double dx = static_cast<double>(x2) - x1;
+	const double dy = static_cast<double>(y2) - y1;
+	double t1 = 0.0, t2 = 1.0;
+
+	// p is the projection of the direction on the edge normal,
+	// q is the distance from the start point to the edge
+	auto edge = [&](double p, double q) {
+		if (p == 0.0)
+			return q >= 0.0;
+		const double t = q / p;
+		if (p < 0.0) {
+			if (t > t2)
+				return false;
+			t1 = std::max(t1, t);
+		} else {
+			if (t < t1)
+				return false;
+			t2 = std::min(t2, t);
+		}
+		return true;
+	};
+
+	if (!edge(-dx, x1 - (clip.x1 - 1.0)) || !edge(dx, clip.x2 - static_cast<double>(x1)) ||
+			!edge(-dy, y1 - (clip.y1 - 1.0)) || !edge(dy, clip.y2 - static_cast<double>(y1)))
+		return false;
+
+	const double ox = x1, oy = y1;
+	x1 = static_cast<float>(ox + t1 * dx);
+	y1 = static_cast<float>(oy + t1 * dy);
+	x2 = static_cast<float>(ox + t2 * dx);
+	y2 = static_cast<float>(oy + t2 * dy);
+	return true;
+}
+
+// Xiaolin Wu's algorithm; pixel centers are moved to integer
+// coordinates before stepping. The segment is clipped first, so
+// only visible pixels are stepped through
+template <class Target>
+void DrawLineImpl(Target& target, float x1, float y1, float x2, float y2, const Color& color) {
+	x1 -= 0.5f;
+	y1 -= 0.5f;
+	x2 -= 0.5f;
+	y2 -= 0.5f;
+
+	if (!ClipSegment(target.GetClip(), x1, y1, x2, y2))
+		return;
+
+	const bool steep = std::fabs(y2 - y1) > std::fabs(x2 - x1);
+	if (steep) {
+		std::swap(x1, y1);
+		std::swap(x2, y2);
+	}
+	if (x1 > x2) {
+		std::swap(x1, x2);
+		std::swap(y1, y2);
+	}
+
+	auto plot = [&](int x, int y, float coverage) {
+		if (steep)
+			target.BlendPixel(y, x, color, CoverageAlpha(color, coverage));
+		else
+			target.BlendPixel(x, y, color, CoverageAlpha(color, coverage));
+	};
+
+	const float dx = x2 - x1;
+	const float gradient = dx == 0.0f ? 1.0f : (y2 - y1) / dx;
+
+	// first endpoint
+	float xend = std::floor(x1 + 0.5f);
+	float yend = y1 + gradient * (xend - x1);
+	float xgap = 1.0f - (x1 + 0.5f - std::floor(x1 + 0.5f));
+	const int xpxl1 = static_cast<int>(xend);
+	int ypxl = static_cast<int>(std::floor(yend));
+	float frac = yend - std::floor(yend);
+	plot(xpxl1, ypxl, (1.0f - frac) * xgap);
+	plot(xpxl1, ypxl + 1, frac * xgap);
+
+	float intery = yend + gradient;
+
+	// second endpoint
+	xend = std::floor(x2 + 0.5f);
+	yend = y2 + gradient * (xend - x2);
+	xgap = x2 + 0.5f - std::floor(x2 + 0.5f);
+	const int xpxl2 = static_cast<int>(xend);
+	ypxl = static_cast<int>(std::floor(yend));
+	frac = yend - std::floor(yend);
+	if (xpxl2 != xpxl1) {
+		plot(xpxl2, ypxl, (1.0f - frac) * xgap);
+		plot(xpxl2, ypxl + 1, frac * xgap);
+	}
+
+	for (int x = xpxl1 + 1; x < xpxl2; x++) {
+		const float base = std::floor(intery);
+		frac = intery - base;
+		plot(x, static_cast<int>(base), 1.0f - frac);
+		plot(x, static_cast<int>(base) + 1, frac);
+		intery += gradient;
+	}
+}
+
+template <class Target>
+void FillCircleImpl(Target& target, float cx, float cy, float radius, const Color& color) {
+	const float outer_radius = radius + 0.5f;
+	const float inner_radius = radius - 0.5f;
+
+	if (!std::isfinite(cx) || !std::isfinite(cy) || !std::isfinite(radius))
+		return;
+
+	// span ends are bound to the clip before conversion to int
+	const Clip& clip = target.GetClip();
+	const int y1 = FloorClamped(cy - outer_radius, clip.y1, clip.y2);
+	const int y2 = CeilClamped(cy + outer_radius, clip.y1, clip.y2);
+
+	for (int y = y1; y < y2; y++) {
+		const float dy = y + 0.5f - cy;
+		const float outer2 = outer_radius * outer_radius - dy * dy;
+		if (outer2 <= 0.0f)
+			continue;
+
+		const float outer = std::sqrt(outer2);
+		const int xo1 = CeilClamped(cx - outer - 0.5f, clip.x1, clip.x2);
+		const int xo2 = FloorClamped(cx + outer - 0.5f, clip.x1, clip.x2) + 1;
+
+		// fully covered interior span
+		int xi1 = xo2, xi2 = xo2;
+		const float inner2 = inner_radius > 0.0f ? inner_radius * inner_radius - dy * dy : 0.0f;
+		if (inner2 > 0.0f) {
+			const float inner = std::sqrt(inner2);
+			xi1 = CeilClamped(cx - inner - 0.5f, clip.x1, clip.x2);
+			xi2 = FloorClamped(cx + inner - 0.5f, clip.x1, clip.x2) + 1;
+			target.BlendSpan(y, xi1, xi2, color, color.a);
+		}
+
+		auto edge = [&](int x) {
+			const float dx = x + 0.5f - cx;
+			target.BlendPixel(x, y, color, CoverageAlpha(color, outer_radius - std::sqrt(dx * dx + dy * dy)));
+		};
+
+		for (int x = xo1; x < std::min(xi1, clip.x2); x++)
+			edge(x);
+		for (int x = std::max(xi2, clip.x1); x < std::min(xo2, clip.x2); x++)
+			edge(x);
+	}
+}
+
+template <class Target>
+void DrawCircleImpl(Target& target, float cx, float cy, float radius, const Color& color) {
+	const float outer_radius = radius + 1.0f;
+	const float inner_radius = radius - 1.0f;
+
+	if (!std::isfinite(cx) || !std::isfinite(cy) || !std::isfinite(radius))
+		return;
+
+	// span ends are bound to the clip before conversion to int
+	const Clip& clip = target.GetClip();
+	const int y1 = FloorClamped(cy - outer_radius, clip.y1, clip.y2);
+	const int y2 = CeilClamped(cy + outer_radius, clip.y1, clip.y2);
+
+	for (int y = y1; y < y2; y++) {
+		const float dy = y + 0.5f - cy;
+		const float outer2 = outer_radius * outer_radius - dy * dy;
+		if (outer2 <= 0.0f)
+			continue;
+
+		const float outer = std::sqrt(outer2);
+		const int xo1 = FloorClamped(cx - outer - 0.5f, clip.x1, clip.x2);
+		const int xo2 = std::min(CeilClamped(cx + outer - 0.5f, clip.x1, clip.x2) + 1, clip.x2);
+
+		// pixels inside inner radius have zero coverage
+		int xi1 = xo2, xi2 = xo2;
+		const float inner2 = inner_radius > 0.0f ? inner_radius * inner_radius - dy * dy : 0.0f;
+		if (inner2 > 0.0f) {
+			const float inner = std::sqrt(inner2);
+			xi1 = CeilClamped(cx - inner - 0.5f, clip.x1, clip.x2);
+			xi2 = FloorClamped(cx + inner - 0.5f, clip.x1, clip.x2) + 1;
+		}
+
+		for (int x = xo1; x < xo2; x++) {
+			if (x == xi1 && xi1 < xi2)
+				x = xi2;
+			if (x >= xo2)
+				break;
+
+			const float dx = x + 0.5f - cx;
+			target.BlendPixel(x, y, color, CoverageAlpha(color, 1.0f - std::fabs(std::sqrt(dx * dx + dy * dy) - radius)));
+		}
+	}
+}
+
+struct Crossing {
+	float x;
+	int direction;
+
+	bool operator<(const Crossing& other) const {
+		return x < other.x;
+	}
+};
+
+// Scanline fill with nonzero winding rule; vertices are pixel
+// centers, so rows and columns are sampled at integer coordinates
+template <class Target>
+void FillPolygonImpl(Target& target, const Point* points, int count, const Color& color) {
+	int min_y = points[0].y, max_y = points[0].y;
+	for (int i = 1; i < count; i++) {
+		min_y = std::min(min_y, points[i].y);
+		max_y = std::max(max_y, points[i].y);
+	}
+
+	const Clip& clip = target.GetClip();
+	const int y1 = std::max(min_y, clip.y1);
+	const int y2 = std::min(max_y, clip.y2);
+
+	std::vector<Crossing> crossings;
+	crossings.reserve(static_cast<size_t>(count));
+
+	for (int y = y1; y < y2; y++) {
+		crossings.clear();
+		for (int i = 0; i < count; i++) {
+			const Point& a = points[i];
+			const Point& b = points[(i + 1) % count];
+
+			int direction;
+			if (a.y <= y && b.y > y)
+				direction = 1;
+			else if (b.y <= y && a.y > y)
+				direction = -1;
+			else
+				continue;
+
+			// in float, as differences of extreme coordinates overflow int
+			const float x = a.x + (static_cast<float>(y) - a.y) * (static_cast<float>(b.x) - a.x) / (static_cast<float>(b.y) - a.y);
+			crossings.push_back(Crossing{ x, direction });
+		}
+
+		std::sort(crossings.begin(), crossings.end());
+
+		int winding = 0;
+		float start = 0.0f;
+		for (const Crossing& crossing : crossings) {
+			if (winding == 0)
+				start = crossing.x;
+			winding += crossing.direction;
+			if (winding == 0)
+				target.BlendSpan(y, CeilClamped(start, clip.x1, clip.x2), CeilClamped(crossing.x, clip.x1, clip.x2), color, color.a);
+		}
+	}
+}
+
+}
+
+Surface& Surface::BlendFillRect(const Optional<Rect>& rect, const Color& color) {
+	const Rect area = rect ? *rect : Rect(0, 0, surface_->w, surface_->h);
+
+	Rasterize(*this, [&](auto& target) {
+			BlendFillRectImpl(target, area, color);
+		});
+	return *this;
+}
+
+Surface& Surface::BlendFillRects(const Rect* rects, int count, const Color& color) {
+	Rasterize(*this, [&](auto& target) {
+			for (const Rect* r = rects; r != rects + count; ++r)
+				BlendFillRectImpl(target, *r, color);
+		});
+	return *this;
+}
+
+Surface& Surface::BlendMask(const Rect& rect, const Uint8* mask, int pitch, const Color& color) {
+	Rasterize(*this, [&](auto& target) {
+			const int y1 = std::max(rect.y, target.GetClip().y1);
+			const int y2 = std::min(rect.y + rect.h, target.GetClip().y2);
+			for (int y = y1; y < y2; y++)
+				target.BlendMaskSpan(y, rect.x, rect.x + rect.w, mask + (y - rect.y) * pitch, color);
+		});
+	return *this;
+}
+
+Surface& Surface::DrawLine(float x1, float y1, float x2, float y2, const Color& color) {
+	Rasterize(*this, [&](auto& target) {
+			DrawLineImpl(target, x1, y1, x2, y2, color);
+		});
+	return *this;
+}
+
+Surface& Surface::DrawCircle(float x, float y, float radius, const Color& color) {
+	Rasterize(*this, [&](auto& target) {
+			DrawCircleImpl(target, x, y, radius, color);
+		});
+	return *this;
+}
+
+Surface& Surface::FillCircle(float x, float y, float radius, const Color& color) {
+	Rasterize(*this, [&](auto& target) {
+			FillCircleImpl(target, x, y, radius, color);
+		});
+	return *this;
+}
+
+Surface& Surface::DrawPolygon(const Point* points, int count, const Color& color) {
+	if (count < 2)
+		return *this;
+
+	// two points make a single line, not a degenerate polygon
+	const int edges = count == 2 ? 1 : count;
+
+	Rasterize(*this, [&](auto& target) {
+			for (int i = 0; i < edges; i++) {
+				const Point& a = points[i];
+				const Point& b = points[(i + 1) % count];
+				DrawLineImpl(target, a.x + 0.5f, a.y + 0.5f, b.x + 0.5f, b.y + 0.5f, color);
+			}
+		});
+	return *this;
+}
+
+Surface& Surface::FillPolygon(const Point* points, int count, const Color& color) {
+	if (count < 3)
+		return *this;
+
+	Rasterize(*this, [&](auto& target) {
+			FillPolygonImpl(target, points, count, color);
+		});
+	return *this;
+}
+
+}
@@ -22,6 +22,7 @@
 #include <SDL_surface.h>
 
 #include <SDL2pp/Exception.hh>
+#include <SDL2pp/Point.hh>
 
 #include <SDL2pp/Surface.hh>
 
@@ -76,4 +77,8 @@ const SDL_PixelFormat& Surface::LockHandle::GetFormat() const {
 	return *surface_->Get()->format;
 }
 
+Point Surface::LockHandle::GetSize() const {
+	return Point(surface_->Get()->w, surface_->Get()->h);
+}
+
 }
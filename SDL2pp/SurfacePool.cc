@@ -0,0 +1,220 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <SDL_pixels.h>
+#include <SDL_surface.h>
+
+#include <SDL2pp/SurfacePool.hh>
+#include <SDL2pp/Exception.hh>
+#include <SDL2pp/Profiler.hh>
+
+namespace SDL2pp {
+
+SurfacePool::Lease::Lease() : pool_(nullptr) {
+}
+
+SurfacePool::Lease::Lease(SurfacePool* pool, Surface&& surface, std::unique_ptr<Uint8[]>&& pixels) : pool_(pool), surface_(std::move(surface)), pixels_(std::move(pixels)) {
+}
+
+SurfacePool::Lease::~Lease() {
+	Release();
+}
+
+SurfacePool::Lease::Lease(Lease&& other) noexcept : pool_(other.pool_), surface_(std::move(other.surface_)), pixels_(std::move(other.pixels_)) {
+	other.pool_ = nullptr;
+	other.surface_.reset();
+}
+
+SurfacePool::Lease& SurfacePool::Lease::operator=(Lease&& other) noexcept {
+	if (&other == this)
+		return *this;
+
+	Release();
+
+	pool_ = other.pool_;
+	surface_ = std::move(other.surface_);
+	pixels_ = std::move(other.pixels_);
+
+	other.pool_ = nullptr;
+	other.surface_.reset();
+
+	return *this;
+}
+
+void SurfacePool::Lease::Release() {
+	if (pool_ != nullptr && surface_)
+		pool_->Return(std::move(*surface_), std::move(pixels_));
+
+	pool_ = nullptr;
+	surface_.reset();
+	pixels_.reset();
+}
+
+Surface& SurfacePool::Lease::GetSurface() {
+	return *surface_;
+}
+
+SurfacePool::Lease::operator bool() const {
+	return static_cast<bool>(surface_);
+}
+
+SurfacePool::SurfacePool(int max_unused_frames) :
+	max_unused_frames_(max_unused_frames),
+	frame_(0),
+	num_leased_(0),
+	num_idle_(0),
+	hits_(0),
+	misses_(0) {
+}
+
+SurfacePool::Lease SurfacePool::Acquire(Uint32 format, int w, int h, int pitch) {
+	if (SDL_ISPIXELFORMAT_INDEXED(format) || SDL_ISPIXELFORMAT_FOURCC(format) || format == SDL_PIXELFORMAT_UNKNOWN)
+		throw std::invalid_argument("SurfacePool only supports packed and array pixel formats");
+	if (w <= 0 || h <= 0)
+		throw std::invalid_argument("Invalid SurfacePool surface size");
+
+	// rows are 4 byte aligned, same as in SDL_CreateRGBSurface
+	const int min_pitch = w * SDL_BYTESPERPIXEL(format);
+	if (pitch == 0)
+		pitch = (min_pitch + 3) & ~3;
+	else if (pitch < min_pitch)
+		throw std::invalid_argument("SurfacePool surface pitch is too small");
+
+	auto found = idle_.find(Key(format, w, h, pitch));
+	if (found != idle_.end() && !found->second.empty()) {
+		// most recently returned surface is taken, so rarely used
+		// surplus ones age out
+		IdleSurface& idle = found->second.back();
+		Surface surface(std::move(idle.surface));
+		std::unique_ptr<Uint8[]> pixels(std::move(idle.pixels));
+		found->second.pop_back();
+
+		num_idle_--;
+		num_leased_++;
+		hits_++;
+
+		return Lease(this, std::move(surface), std::move(pixels));
+	}
+
+	int bpp;
+	Uint32 rmask, gmask, bmask, amask;
+	if (!SDL_PixelFormatEnumToMasks(format, &bpp, &rmask, &gmask, &bmask, &amask))
+		throw Exception("SDL_PixelFormatEnumToMasks");
+
+	std::unique_ptr<Uint8[]> pixels(new Uint8[static_cast<size_t>(pitch) * h]);
+	Surface surface(pixels.get(), w, h, bpp, pitch, rmask, gmask, bmask, amask);
+
+	num_leased_++;
+	misses_++;
+
+	return Lease(this, std::move(surface), std::move(pixels));
+}
+
+SurfacePool::Lease SurfacePool::Acquire(Uint32 format, const Point& size) {
+	return Acquire(format, size.x, size.y);
+}
+
+SurfacePool::Lease SurfacePool::Convert(Surface& surface, Uint32 pixel_format) {
+	SDL2PP_PROFILE_SCOPE(SurfaceConvert);
+
+	Lease lease = Acquire(pixel_format, surface.GetWidth(), surface.GetHeight());
+	SDL_Surface* src = surface.Get();
+	SDL_Surface* dst = lease.GetSurface().Get();
+
+	if (!SDL_ISPIXELFORMAT_INDEXED(src->format->format)) {
+		Surface::LockHandle lock = surface.Lock();
+		if (SDL_ConvertPixels(src->w, src->h, src->format->format, lock.GetPixels(), lock.GetPitch(), pixel_format, dst->pixels, dst->pitch) != 0)
+			throw Exception("SDL_ConvertPixels");
+	} else {
+		// SDL_ConvertPixels can't handle palettes, so indexed
+		// sources go through regular, allocating, conversion
+		Surface converted = surface.Convert(pixel_format);
+		Surface::LockHandle lock = converted.Lock();
+
+		const size_t row_size = static_cast<size_t>(dst->w) * dst->format->BytesPerPixel;
+		for (int y = 0; y < dst->h; y++)
+			std::memcpy(static_cast<Uint8*>(dst->pixels) + y * dst->pitch, static_cast<const Uint8*>(lock.GetPixels()) + y * lock.GetPitch(), row_size);
+	}
+
+	return lease;
+}
+
+void SurfacePool::Return(Surface&& surface, std::unique_ptr<Uint8[]>&& pixels) {
+	SDL_Surface* sdl_surface = surface.Get();
+	idle_[Key(sdl_surface->format->format, sdl_surface->w, sdl_surface->h, sdl_surface->pitch)].push_back(IdleSurface{std::move(surface), std::move(pixels), frame_});
+
+	num_leased_--;
+	num_idle_++;
+}
+
+void SurfacePool::NextFrame() {
+	frame_++;
+
+	// empty buckets are kept, so returning a surface of a known
+	// class never allocates
+	for (auto& bucket : idle_) {
+		auto& surfaces = bucket.second;
+
+		// surfaces are ordered by last use, oldest first
+		auto keep = surfaces.begin();
+		while (keep != surfaces.end() && frame_ - keep->last_used > static_cast<unsigned long>(max_unused_frames_))
+			++keep;
+
+		num_idle_ -= static_cast<std::size_t>(keep - surfaces.begin());
+		surfaces.erase(surfaces.begin(), keep);
+	}
+}
+
+void SurfacePool::Clear() {
+	idle_.clear();
+	num_idle_ = 0;
+}
+
+std::size_t SurfacePool::GetNumLeased() const {
+	return num_leased_;
+}
+
+std::size_t SurfacePool::GetNumIdle() const {
+	return num_idle_;
+}
+
+unsigned long SurfacePool::GetHits() const {
+	return hits_;
+}
+
+unsigned long SurfacePool::GetMisses() const {
+	return misses_;
+}
+
+float SurfacePool::GetHitRate() const {
+	unsigned long total = hits_ + misses_;
+	return total == 0 ? 0.0f : static_cast<float>(hits_) / static_cast<float>(total);
+}
+
+void SurfacePool::ResetStats() {
+	hits_ = misses_ = 0;
+}
+
+}
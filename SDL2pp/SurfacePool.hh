@@ -0,0 +1,359 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_SURFACEPOOL_HH
+#define SDL2PP_SURFACEPOOL_HH
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include <SDL_stdinc.h>
+
+#include <SDL2pp/Optional.hh>
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+////////////////////////////////////////////////////////////
+/// \brief Pool of reusable surfaces
+///
+/// \ingroup rendering
+///
+/// \headerfile SDL2pp/SurfacePool.hh
+///
+/// Format conversions and texture uploads often need a
+/// temporary surface which is freed right after use, costing
+/// a heap allocation of the pixel buffer and the surface
+/// itself each time. This class keeps released surfaces,
+/// along with their pixel buffers, grouped by format, size and
+/// pitch, and hands them out again on later requests, so a
+/// steady state of such operations allocates no memory.
+/// Surfaces unused for a number of frames are destroyed.
+///
+/// Contents and state (clipping rectangle, blend mode, color
+/// and alpha modulation) of acquired surface are those left
+/// by its previous user.
+///
+/// Pool must outlive all of its leases, and thus is neither
+/// copyable nor movable. Pool is not thread safe.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::SurfacePool pool;
+///
+///     while (running) {
+///         // conversion buffer is reused between frames
+///         texture.Update(SDL2pp::NullOpt, frame, pool);
+///
+///         pool.NextFrame();
+///     }
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT SurfacePool {
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Scoped ownership of a pooled surface
+	///
+	/// The surface is returned to the pool as soon as Lease is
+	/// destroyed or Release() is called.
+	///
+	////////////////////////////////////////////////////////////
+	class SDL2PP_EXPORT Lease {
+		friend class SurfacePool;
+
+	private:
+		SurfacePool* pool_;               ///< Pool the surface is returned to
+		Optional<Surface> surface_;       ///< Leased surface
+		std::unique_ptr<Uint8[]> pixels_; ///< Pixel buffer of the surface
+
+	private:
+		////////////////////////////////////////////////////////////
+		/// \brief Create lease of given surface
+		///
+		/// \param[in] pool Pool the surface belongs to
+		/// \param[in] surface Surface to lease
+		/// \param[in] pixels Pixel buffer of the surface
+		///
+		////////////////////////////////////////////////////////////
+		Lease(SurfacePool* pool, Surface&& surface, std::unique_ptr<Uint8[]>&& pixels);
+
+	public:
+		////////////////////////////////////////////////////////////
+		/// \brief Create empty lease
+		///
+		/// This may be initialized with real lease later via move
+		/// assignment
+		///
+		////////////////////////////////////////////////////////////
+		Lease();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destructor
+		///
+		/// Returns the surface to the pool
+		///
+		////////////////////////////////////////////////////////////
+		~Lease();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Move constructor
+		///
+		/// \param[in] other SDL2pp::SurfacePool::Lease to move data from
+		///
+		////////////////////////////////////////////////////////////
+		Lease(Lease&& other) noexcept;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Move assignment operator
+		///
+		/// \param[in] other SDL2pp::SurfacePool::Lease to move data from
+		///
+		/// \returns Reference to self
+		///
+		////////////////////////////////////////////////////////////
+		Lease& operator=(Lease&& other) noexcept;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Deleted copy constructor
+		///
+		/// This class is not copyable
+		///
+		////////////////////////////////////////////////////////////
+		Lease(const Lease& other) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Deleted assignment operator
+		///
+		/// This class is not copyable
+		///
+		////////////////////////////////////////////////////////////
+		Lease& operator=(const Lease& other) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Return surface to the pool before lease is destroyed
+		///
+		////////////////////////////////////////////////////////////
+		void Release();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get leased surface
+		///
+		/// \returns Reference to leased surface
+		///
+		////////////////////////////////////////////////////////////
+		Surface& GetSurface();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether lease holds a surface
+		///
+		/// \returns True if lease holds a surface
+		///
+		////////////////////////////////////////////////////////////
+		explicit operator bool() const;
+	};
+
+private:
+	typedef std::tuple<Uint32, int, int, int> Key;
+
+	struct IdleSurface {
+		Surface surface;                  ///< Surface returned to the pool
+		std::unique_ptr<Uint8[]> pixels;  ///< Pixel buffer of the surface
+		unsigned long last_used;          ///< Frame number it was returned at
+	};
+
+private:
+	std::map<Key, std::vector<IdleSurface>> idle_; ///< Released surfaces by format, size and pitch
+	int max_unused_frames_;                        ///< Number of frames idle surface is kept for
+	unsigned long frame_;                          ///< Current frame number
+	std::size_t num_leased_;                       ///< Number of surfaces currently leased
+	std::size_t num_idle_;                         ///< Number of surfaces currently idle
+	unsigned long hits_;                           ///< Number of requests satisfied from the pool
+	unsigned long misses_;                         ///< Number of requests which created a surface
+
+private:
+	////////////////////////////////////////////////////////////
+	/// \brief Return surface into the pool
+	///
+	/// \param[in] surface Surface to return
+	/// \param[in] pixels Pixel buffer of the surface
+	///
+	////////////////////////////////////////////////////////////
+	void Return(Surface&& surface, std::unique_ptr<Uint8[]>&& pixels);
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Create pool
+	///
+	/// \param[in] max_unused_frames Number of NextFrame() calls after
+	///                              which unused surface is destroyed
+	///
+	////////////////////////////////////////////////////////////
+	explicit SurfacePool(int max_unused_frames = 60);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted copy constructor
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	SurfacePool(const SurfacePool& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted assignment operator
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	SurfacePool& operator=(const SurfacePool& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Acquire surface
+	///
+	/// \param[in] format One of the enumerated values in SDL_PixelFormatEnum,
+	///                   indexed and FourCC formats are not supported
+	/// \param[in] w Width of the surface in pixels
+	/// \param[in] h Height of the surface in pixels
+	/// \param[in] pitch Length of a row of pixels in bytes, or 0 for
+	///                  the same pitch SDL uses for new surfaces
+	///
+	/// \returns Lease of pooled or newly created surface
+	///
+	/// \throws std::invalid_argument
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_CreateRGBSurfaceFrom
+	///
+	////////////////////////////////////////////////////////////
+	Lease Acquire(Uint32 format, int w, int h, int pitch = 0);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Acquire surface
+	///
+	/// \param[in] format One of the enumerated values in SDL_PixelFormatEnum,
+	///                   indexed and FourCC formats are not supported
+	/// \param[in] size Size of the surface
+	///
+	/// \returns Lease of pooled or newly created surface
+	///
+	/// \throws std::invalid_argument
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_CreateRGBSurfaceFrom
+	///
+	////////////////////////////////////////////////////////////
+	Lease Acquire(Uint32 format, const Point& size);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Copy surface to a pooled surface of the specified format
+	///
+	/// Pooled counterpart of Surface::Convert(Uint32). Pixel data
+	/// is converted as with SDL_ConvertPixels, so unlike with
+	/// SDL_ConvertSurfaceFormat color key is not converted into
+	/// alpha channel.
+	///
+	/// \param[in] surface Surface to convert
+	/// \param[in] pixel_format One of the enumerated values in SDL_PixelFormatEnum
+	///
+	/// \returns Lease of converted surface
+	///
+	/// \throws std::invalid_argument
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_ConvertPixels
+	///
+	////////////////////////////////////////////////////////////
+	Lease Convert(Surface& surface, Uint32 pixel_format);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Advance frame counter and destroy stale surfaces
+	///
+	/// Should be called once per frame
+	///
+	////////////////////////////////////////////////////////////
+	void NextFrame();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Destroy all idle surfaces
+	///
+	/// Leased surfaces are not affected
+	///
+	////////////////////////////////////////////////////////////
+	void Clear();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of surfaces currently leased
+	///
+	/// \returns Number of leased surfaces
+	///
+	////////////////////////////////////////////////////////////
+	std::size_t GetNumLeased() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of surfaces kept idle in the pool
+	///
+	/// \returns Number of idle surfaces
+	///
+	////////////////////////////////////////////////////////////
+	std::size_t GetNumIdle() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of requests satisfied from the pool
+	///
+	/// \returns Number of hits since creation or last ResetStats()
+	///
+	////////////////////////////////////////////////////////////
+	unsigned long GetHits() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of requests which created a new surface
+	///
+	/// \returns Number of misses since creation or last ResetStats()
+	///
+	////////////////////////////////////////////////////////////
+	unsigned long GetMisses() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get ratio of requests satisfied from the pool
+	///
+	/// \returns Hit rate in [0.0, 1.0] range, 0.0 if there were
+	///          no requests
+	///
+	////////////////////////////////////////////////////////////
+	float GetHitRate() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Reset hit and miss counters
+	///
+	////////////////////////////////////////////////////////////
+	void ResetStats();
+};
+
+}
+
+#endif
@@ -0,0 +1,260 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <SDL_surface.h>
+
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/Exception.hh>
+
+namespace SDL2pp {
+
+namespace {
+
+// Filter weights for one axis: for each destination pixel, first
+// source pixel and number of contributing source pixels, plus
+// fixed stride array of normalized weights
+struct FilterCoeffs {
+	int taps;
+	std::vector<int> first;
+	std::vector<int> count;
+	std::vector<float> weights;
+};
+
+constexpr double pi = 3.14159265358979323846;
+
+double Sinc(double x) {
+	if (x == 0.0)
+		return 1.0;
+	x *= pi;
+	return std::sin(x) / x;
+}
+
+double FilterSupport(Surface::ResampleFilter filter) {
+	switch (filter) {
+	case Surface::ResampleFilter::Box: return 0.5;
+	case Surface::ResampleFilter::Bilinear: return 1.0;
+	case Surface::ResampleFilter::Lanczos3: return 3.0;
+	}
+	return 1.0;
+}
+
+double FilterWeight(Surface::ResampleFilter filter, double x) {
+	switch (filter) {
+	case Surface::ResampleFilter::Box:
+		return (x > -0.5 && x <= 0.5) ? 1.0 : 0.0;
+	case Surface::ResampleFilter::Bilinear:
+		x = std::fabs(x);
+		return x < 1.0 ? 1.0 - x : 0.0;
+	case Surface::ResampleFilter::Lanczos3:
+		return (x > -3.0 && x < 3.0) ? Sinc(x) * Sinc(x / 3.0) : 0.0;
+	}
+	return 0.0;
+}
+
+std::shared_ptr<const FilterCoeffs> ComputeCoeffs(Surface::ResampleFilter filter, int src_size, int dst_size) {
+	const double scale = static_cast<double>(src_size) / dst_size;
+	const double filter_scale = std::max(scale, 1.0);
+	const double support = FilterSupport(filter) * filter_scale;
+
+	auto coeffs = std::make_shared<FilterCoeffs>();
+	coeffs->taps = static_cast<int>(std::ceil(support)) * 2 + 1;
+	coeffs->first.resize(dst_size);
+	coeffs->count.resize(dst_size);
+	coeffs->weights.assign(static_cast<size_t>(dst_size) * coeffs->taps, 0.0f);
+
+	for (int i = 0; i < dst_size; ++i) {
+		const double center = (i + 0.5) * scale;
+		const int first = std::max(static_cast<int>(center - support + 0.5), 0);
+		const int last = std::min(static_cast<int>(center + support + 0.5), src_size);
+		const int count = std::min(last - first, coeffs->taps);
+
+		float* weights = coeffs->weights.data() + static_cast<size_t>(i) * coeffs->taps;
+
+		double total = 0.0;
+		for (int k = 0; k < count; ++k) {
+			double w = FilterWeight(filter, (first + k - center + 0.5) / filter_scale);
+			weights[k] = static_cast<float>(w);
+			total += w;
+		}
+
+		if (total != 0.0)
+			for (int k = 0; k < count; ++k)
+				weights[k] = static_cast<float>(weights[k] / total);
+
+		coeffs->first[i] = first;
+		coeffs->count[i] = count;
+	}
+
+	return coeffs;
+}
+
+// Coefficient tables are cached, as thumbnails and mip levels
+// are usually produced for many images of the same size
+std::shared_ptr<const FilterCoeffs> GetCoeffs(Surface::ResampleFilter filter, int src_size, int dst_size) {
+	static const size_t max_cached = 64;
+	static std::mutex mutex;
+	static std::map<std::tuple<int, int, int>, std::shared_ptr<const FilterCoeffs>> cache;
+
+	auto key = std::make_tuple(static_cast<int>(filter), src_size, dst_size);
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		auto found = cache.find(key);
+		if (found != cache.end())
+			return found->second;
+	}
+
+	auto coeffs = ComputeCoeffs(filter, src_size, dst_size);
+
+	std::lock_guard<std::mutex> lock(mutex);
+	if (cache.size() >= max_cached)
+		cache.clear();
+	cache.emplace(key, coeffs);
+	return coeffs;
+}
+
+Uint8 ClampToByte(float v) {
+	return static_cast<Uint8>(std::min(std::max(v + 0.5f, 0.0f), 255.0f));
+}
+
+// 32 bit formats with 8 bit channels are processed directly, as
+// all 4 bytes of a pixel can be filtered independently regardless
+// of channel order
+bool IsDirectFormat(const SDL_PixelFormat& format) {
+	return format.BytesPerPixel == 4 && format.Rloss == 0 && format.Gloss == 0 && format.Bloss == 0 && (format.Amask == 0 || format.Aloss == 0);
+}
+
+void ResamplePixels(const Uint8* src, int src_pitch, int src_w, int src_h, Uint8* dst, int dst_pitch, int dst_w, int dst_h, Surface::ResampleFilter filter) {
+	auto hcoeffs = GetCoeffs(filter, src_w, dst_w);
+	auto vcoeffs = GetCoeffs(filter, src_h, dst_h);
+
+	const size_t row_floats = static_cast<size_t>(dst_w) * 4;
+
+	// horizontal pass: src_h rows of dst_w pixels
+	std::vector<float> horizontal(row_floats * src_h);
+	for (int y = 0; y < src_h; ++y) {
+		const Uint8* in = src + y * src_pitch;
+		float* out = horizontal.data() + row_floats * y;
+
+		for (int x = 0; x < dst_w; ++x) {
+			const float* weights = hcoeffs->weights.data() + static_cast<size_t>(x) * hcoeffs->taps;
+			const Uint8* pixel = in + hcoeffs->first[x] * 4;
+
+			float acc[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			for (int k = 0; k < hcoeffs->count[x]; ++k, pixel += 4)
+				for (int c = 0; c < 4; ++c)
+					acc[c] += weights[k] * pixel[c];
+
+			for (int c = 0; c < 4; ++c)
+				out[x * 4 + c] = acc[c];
+		}
+	}
+
+	// vertical pass: whole rows are accumulated at once, which is
+	// a contiguous multiply-add loop the compiler vectorizes
+	std::vector<float> acc(row_floats);
+	for (int y = 0; y < dst_h; ++y) {
+		const float* weights = vcoeffs->weights.data() + static_cast<size_t>(y) * vcoeffs->taps;
+
+		std::fill(acc.begin(), acc.end(), 0.0f);
+		for (int k = 0; k < vcoeffs->count[y]; ++k) {
+			const float w = weights[k];
+			const float* in = horizontal.data() + row_floats * (vcoeffs->first[y] + k);
+			for (size_t i = 0; i < row_floats; ++i)
+				acc[i] += w * in[i];
+		}
+
+		Uint8* out = dst + y * dst_pitch;
+		for (size_t i = 0; i < row_floats; ++i)
+			out[i] = ClampToByte(acc[i]);
+	}
+}
+
+}
+
+Surface Surface::Resample(const Optional<Rect>& srcrect, const Point& size, ResampleFilter filter) {
+	Rect src = srcrect ? *srcrect : Rect(0, 0, GetWidth(), GetHeight());
+	if (size.x <= 0 || size.y <= 0 || src.w <= 0 || src.h <= 0 || !Rect(0, 0, GetWidth(), GetHeight()).Contains(src))
+		throw std::invalid_argument("Invalid source rectangle or size for Surface::Resample");
+
+	const SDL_PixelFormat& format = *surface_->format;
+	const bool direct = IsDirectFormat(format);
+	const bool has_alpha = format.Amask != 0;
+
+	// filtering is done on a premultiplied copy when there's alpha,
+	// otherwise transparent pixels would bleed into opaque ones
+	Optional<Surface> working;
+	if (!direct) {
+		working = Convert(SDL_PIXELFORMAT_ARGB8888);
+	} else if (has_alpha) {
+		working.emplace(0, src.w, src.h, 32, format.Rmask, format.Gmask, format.Bmask, format.Amask);
+
+		LockHandle src_lock = Lock();
+		LockHandle dst_lock = working->Lock();
+		for (int y = 0; y < src.h; ++y)
+			std::memcpy(
+					static_cast<Uint8*>(dst_lock.GetPixels()) + y * dst_lock.GetPitch(),
+					static_cast<const Uint8*>(src_lock.GetPixels()) + (src.y + y) * src_lock.GetPitch() + src.x * 4,
+					static_cast<size_t>(src.w) * 4
+				);
+
+		src.x = src.y = 0;
+	}
+
+	if (working && working->Get()->format->Amask != 0)
+		working->PremultiplyAlpha();
+
+	Surface& input = working ? *working : *this;
+	const SDL_PixelFormat& input_format = *input.Get()->format;
+
+	Surface result(0, size.x, size.y, 32, input_format.Rmask, input_format.Gmask, input_format.Bmask, input_format.Amask);
+
+	{
+		LockHandle src_lock = input.Lock();
+		LockHandle dst_lock = result.Lock();
+
+		ResamplePixels(
+				static_cast<const Uint8*>(src_lock.GetPixels()) + src.y * src_lock.GetPitch() + src.x * 4, src_lock.GetPitch(), src.w, src.h,
+				static_cast<Uint8*>(dst_lock.GetPixels()), dst_lock.GetPitch(), size.x, size.y,
+				filter
+			);
+	}
+
+	if (input_format.Amask != 0)
+		result.UnpremultiplyAlpha();
+
+	if (!direct)
+		return result.Convert(format);
+
+	return result;
+}
+
+}
@@ -0,0 +1,255 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <SDL2pp/TextLayout.hh>
+#include <SDL2pp/Font.hh>
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/private/UTF8.hh>
+
+namespace SDL2pp {
+
+namespace {
+
+Uint16 ToUCS2(Uint32 ch) {
+	return ch <= 0xffff ? static_cast<Uint16>(ch) : 0xfffd;
+}
+
+bool IsSpace(Uint32 ch) {
+	return ch == ' ' || ch == '\t';
+}
+
+}
+
+TextLayout::TextLayout(Font& font, int width) : TextLayout(font, std::string(), width) {
+}
+
+TextLayout::TextLayout(Font& font, const std::string& text, int width) : font_(&font), width_(width), text_(text) {
+	if (width < 0)
+		throw std::invalid_argument("Negative TextLayout width");
+	Relayout(0);
+}
+
+int TextLayout::GetKerning(Uint16 prev, Uint16 ch) {
+	const Uint32 key = static_cast<Uint32>(prev) << 16 | ch;
+
+	auto found = kernings_.find(key);
+	if (found != kernings_.end())
+		return found->second;
+
+	const int kerning = font_->GetGlyphKerning(prev, ch);
+	kernings_.emplace(key, kerning);
+	return kerning;
+}
+
+size_t TextLayout::CountStableLines(size_t changed) const {
+	// the last line is always laid out again, as it may continue
+	// into changed text
+	if (lines_.empty())
+		return 0;
+
+	return static_cast<size_t>(std::upper_bound(line_ends_.begin(), line_ends_.end() - 1, changed) - line_ends_.begin());
+}
+
+void TextLayout::Relayout(size_t first_line) {
+	size_t offset = 0;
+	if (first_line < lines_.size()) {
+		offset = lines_[first_line].begin;
+		glyphs_.resize(lines_[first_line].first_glyph);
+		lines_.resize(first_line);
+		line_ends_.resize(first_line);
+	} else {
+		glyphs_.clear();
+		lines_.clear();
+		line_ends_.clear();
+	}
+
+	const bool kerning = font_->GetKerning();
+
+	Line line = { offset, offset, glyphs_.size(), 0, 0 };
+	int pen = 0;
+	Uint32 prev = 0;
+	size_t wrap = line.first_glyph; // glyph the line may be wrapped before
+	Line wrapped = line;            // line state if wrapped there
+
+	auto next_line = [&](size_t begin, size_t end) {
+			line.num_glyphs = glyphs_.size() - line.first_glyph;
+			lines_.push_back(line);
+			line_ends_.push_back(end);
+
+			line = Line{ begin, begin, glyphs_.size(), 0, 0 };
+			pen = 0;
+			prev = 0;
+			wrap = line.first_glyph;
+			wrapped = line;
+		};
+
+	while (offset < text_.size()) {
+		const size_t start = offset;
+		const char* current = text_.data() + offset;
+		const Uint32 ch = Private::NextUTF8(current, text_.data() + text_.size());
+		offset = static_cast<size_t>(current - text_.data());
+
+		if (ch == '\n') {
+			glyphs_.push_back(Glyph{ ch, start, pen, 0 });
+			next_line(offset, offset);
+			continue;
+		}
+
+		if (kerning && prev != 0)
+			pen += GetKerning(ToUCS2(prev), ToUCS2(ch));
+
+		const int advance = font_->GetGlyphAdvance(ToUCS2(ch));
+
+		if (!IsSpace(ch)) {
+			if (prev != 0 && (IsSpace(prev) || prev == '-')) {
+				wrap = glyphs_.size();
+				wrapped = line;
+			}
+
+			// on overflow, the rest of the line is laid out again
+			// starting from the last wrap opportunity, or from the
+			// current glyph if the whole line is a single word
+			if (width_ > 0 && pen + advance > width_ && glyphs_.size() > line.first_glyph) {
+				const size_t end = offset;
+				if (wrap > line.first_glyph) {
+					offset = wrap < glyphs_.size() ? glyphs_[wrap].offset : start;
+					glyphs_.resize(wrap);
+					line = wrapped;
+				} else {
+					offset = start;
+				}
+				next_line(offset, end);
+				continue;
+			}
+
+			line.end = offset;
+			line.width = pen + advance;
+		}
+
+		glyphs_.push_back(Glyph{ ch, start, pen, advance });
+		pen += advance;
+		prev = ch;
+	}
+
+	line.num_glyphs = glyphs_.size() - line.first_glyph;
+	lines_.push_back(line);
+	line_ends_.push_back(text_.size());
+}
+
+const std::string& TextLayout::GetText() const {
+	return text_;
+}
+
+TextLayout& TextLayout::SetText(const std::string& text) {
+	const size_t common = static_cast<size_t>(std::mismatch(text_.begin(), text_.begin() + std::min(text_.size(), text.size()), text.begin()).first - text_.begin());
+	if (common == text_.size() && common == text.size())
+		return *this;
+
+	const size_t stable = CountStableLines(common);
+	text_ = text;
+	Relayout(stable);
+	return *this;
+}
+
+TextLayout& TextLayout::Append(const std::string& text) {
+	if (text.empty())
+		return *this;
+
+	const size_t stable = CountStableLines(text_.size());
+	text_ += text;
+	Relayout(stable);
+	return *this;
+}
+
+int TextLayout::GetWidth() const {
+	return width_;
+}
+
+TextLayout& TextLayout::SetWidth(int width) {
+	if (width < 0)
+		throw std::invalid_argument("Negative TextLayout width");
+	if (width == width_)
+		return *this;
+
+	width_ = width;
+	Relayout(0);
+	return *this;
+}
+
+TextLayout& TextLayout::Invalidate() {
+	kernings_.clear();
+	Relayout(0);
+	return *this;
+}
+
+const std::vector<TextLayout::Line>& TextLayout::GetLines() const {
+	return lines_;
+}
+
+const std::vector<TextLayout::Glyph>& TextLayout::GetGlyphs() const {
+	return glyphs_;
+}
+
+Point TextLayout::GetSize() const {
+	int width = 0;
+	for (const Line& line : lines_)
+		width = std::max(width, line.width);
+
+	return Point(width, static_cast<int>(lines_.size() - 1) * font_->GetLineSkip() + font_->GetHeight());
+}
+
+Rect TextLayout::Render(SDL_Color fg, Surface& dst, const Point& position) const {
+	const int skip = font_->GetLineSkip();
+	const int height = font_->GetHeight();
+	const Rect clip(dst.Get()->clip_rect);
+
+	// skip lines above the clipping rectangle without iterating them
+	size_t first = 0;
+	if (skip > 0 && clip.y - height > position.y)
+		first = std::min(static_cast<size_t>((clip.y - height - position.y) / skip), lines_.size());
+
+	Rect touched(position, Point(0, 0));
+	bool empty = true;
+
+	for (size_t i = first; i < lines_.size(); i++) {
+		const Line& line = lines_[i];
+		const int y = position.y + static_cast<int>(i) * skip;
+
+		if (y > clip.GetY2())
+			break;
+		if (y + height <= clip.y || line.end == line.begin)
+			continue;
+
+		Rect rect = font_->RenderUTF8_Blended(text_.substr(line.begin, line.end - line.begin), fg, dst, Point(position.x, y));
+		if (rect.w == 0 || rect.h == 0)
+			continue;
+
+		touched = empty ? rect : touched.GetUnion(rect);
+		empty = false;
+	}
+
+	return touched;
+}
+
+}
@@ -0,0 +1,309 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_TEXTLAYOUT_HH
+#define SDL2PP_TEXTLAYOUT_HH
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL_stdinc.h>
+#include <SDL_pixels.h>
+
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+class Font;
+class Surface;
+
+////////////////////////////////////////////////////////////
+/// \brief Multiline text laid out with a font
+///
+/// \ingroup ttf
+///
+/// \headerfile SDL2pp/TextLayout.hh
+///
+/// This breaks UTF-8 text into lines no wider than given
+/// width and calculates position of each glyph, the same way
+/// Font renders single line text: glyphs are placed by their
+/// advances, adjusted by kerning. Lines are broken at hard
+/// line breaks, at spaces and after hyphens; words which do
+/// not fit into a line on their own are broken between
+/// glyphs. Spaces at the end of a line do not count to its
+/// width. No complex text shaping or bidirectional reordering
+/// is done.
+///
+/// Glyph advances are taken from metrics cached by the Font,
+/// and kerning pairs are cached in the layout, so after the
+/// first few lines of text no calls to SDL_ttf are made.
+/// When the text is changed, only lines starting from the
+/// one containing the first changed char are laid out again,
+/// so appending to a long text (such as a log or a chat
+/// history) costs as much as laying out the appended part.
+///
+/// Chars outside of Basic Multilingual Plane are measured
+/// as U+FFFD REPLACEMENT CHARACTER, as Font metrics are
+/// limited to UCS-2.
+///
+/// Layout keeps a pointer to the font, so font must outlive
+/// it. Changes of font style, outline, hinting or kerning do
+/// not affect already laid out text: call Invalidate() after
+/// changing these.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::TextLayout log(font, 400);
+///
+///     while (running) {
+///         if (auto message = Poll())
+///             log.Append(*message + "\n");
+///
+///         log.Render(SDL_Color{255, 255, 255, 255}, screen, SDL2pp::Point(8, 8));
+///     }
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT TextLayout {
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Laid out glyph
+	///
+	////////////////////////////////////////////////////////////
+	struct Glyph {
+		Uint32 ch;     ///< Unicode code point
+		size_t offset; ///< Byte offset of the char in the text
+		int x;         ///< Pen position of the glyph relative to the start of the line
+		int advance;   ///< Pen advance of the glyph, 0 for line breaks
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Laid out line
+	///
+	////////////////////////////////////////////////////////////
+	struct Line {
+		size_t begin;       ///< Byte offset of the first char of the line
+		size_t end;         ///< Byte offset past the last char of the line, excluding trailing spaces and line break
+		size_t first_glyph; ///< Index of the first glyph of the line
+		size_t num_glyphs;  ///< Number of glyphs in the line, including trailing spaces and line break
+		int width;          ///< Width of the line, excluding trailing spaces
+	};
+
+private:
+	Font* font_;                                ///< Font used for layout
+	int width_;                                 ///< Maximal width of lines, or 0 for no limit
+	std::string text_;                          ///< UTF-8 text
+	std::vector<Glyph> glyphs_;                 ///< Glyphs of all lines
+	std::vector<Line> lines_;                   ///< Lines
+	std::vector<size_t> line_ends_;             ///< Byte offsets past the char which ended each line
+	std::unordered_map<Uint32, int> kernings_;  ///< Cached kerning, keyed by pair of chars
+
+private:
+	////////////////////////////////////////////////////////////
+	/// \brief Get kerning between chars, from cache if possible
+	///
+	/// \param[in] prev Preceding char
+	/// \param[in] ch Current char
+	///
+	/// \returns Offset to add to pen position
+	///
+	////////////////////////////////////////////////////////////
+	int GetKerning(Uint16 prev, Uint16 ch);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Count lines not affected by change of the text
+	///
+	/// Line is not affected if all chars its layout depends on,
+	/// which includes the char which caused it to be wrapped,
+	/// are before the change.
+	///
+	/// \param[in] changed Byte offset of the first changed char
+	///
+	/// \returns Number of leading lines which stay the same
+	///
+	////////////////////////////////////////////////////////////
+	size_t CountStableLines(size_t changed) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Lay out text starting from given line
+	///
+	/// \param[in] first_line Index of the first line to lay out
+	///
+	////////////////////////////////////////////////////////////
+	void Relayout(size_t first_line);
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Construct empty layout
+	///
+	/// \param[in] font Font to lay out text with
+	/// \param[in] width Maximal width of lines in pixels, or 0
+	///                  to only break lines at line breaks
+	///
+	/// \throws std::invalid_argument if width is negative
+	///
+	////////////////////////////////////////////////////////////
+	explicit TextLayout(Font& font, int width = 0);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Construct layout of given text
+	///
+	/// \param[in] font Font to lay out text with
+	/// \param[in] text UTF-8 text
+	/// \param[in] width Maximal width of lines in pixels, or 0
+	///                  to only break lines at line breaks
+	///
+	/// \throws SDL2pp::Exception
+	/// \throws std::invalid_argument if width is negative
+	///
+	////////////////////////////////////////////////////////////
+	TextLayout(Font& font, const std::string& text, int width = 0);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get text
+	///
+	/// \returns UTF-8 text
+	///
+	////////////////////////////////////////////////////////////
+	const std::string& GetText() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Replace text
+	///
+	/// Lines before the first changed char are not laid out
+	/// again.
+	///
+	/// \param[in] text UTF-8 text
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	TextLayout& SetText(const std::string& text);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append text
+	///
+	/// Only the last line and appended text are laid out.
+	///
+	/// \param[in] text UTF-8 text to append
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	TextLayout& Append(const std::string& text);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get maximal line width
+	///
+	/// \returns Maximal width of lines in pixels, or 0 if not limited
+	///
+	////////////////////////////////////////////////////////////
+	int GetWidth() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set maximal line width
+	///
+	/// This lays out whole text again, unless width is the same
+	///
+	/// \param[in] width Maximal width of lines in pixels, or 0
+	///                  to only break lines at line breaks
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	/// \throws std::invalid_argument if width is negative
+	///
+	////////////////////////////////////////////////////////////
+	TextLayout& SetWidth(int width);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Drop cached metrics and lay out whole text again
+	///
+	/// This must be called after changing style, outline,
+	/// hinting or kerning of the font.
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	TextLayout& Invalidate();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get laid out lines
+	///
+	/// There's always at least one line, which is empty for
+	/// empty text. Line with index i is placed i times
+	/// Font::GetLineSkip() pixels below the first one.
+	///
+	/// \returns Lines, in text order
+	///
+	////////////////////////////////////////////////////////////
+	const std::vector<Line>& GetLines() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get laid out glyphs
+	///
+	/// \returns Glyphs of all lines, one per char of the text
+	///
+	////////////////////////////////////////////////////////////
+	const std::vector<Glyph>& GetGlyphs() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get size of laid out text
+	///
+	/// \returns Width of the widest line and height of all lines
+	///
+	////////////////////////////////////////////////////////////
+	Point GetSize() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Render text into existing surface
+	///
+	/// Lines are rendered with Font::RenderUTF8_Blended().
+	/// Lines outside of surface clipping rectangle are skipped,
+	/// so rendering a visible part of long text is cheap.
+	///
+	/// \param[in] fg Foreground color
+	/// \param[in] dst Surface to render into
+	/// \param[in] position Position of the top left corner of the first line
+	///
+	/// \returns Part of the surface affected by the rendering
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	Rect Render(SDL_Color fg, Surface& dst, const Point& position) const;
+};
+
+}
+
+#endif
@@ -34,8 +34,10 @@
 #include <SDL2pp/Config.hh>
 #include <SDL2pp/Renderer.hh>
 #include <SDL2pp/Exception.hh>
+#include <SDL2pp/Profiler.hh>
 #include <SDL2pp/Rect.hh>
 #include <SDL2pp/Surface.hh>
+#include <SDL2pp/SurfacePool.hh>
 #ifdef SDL2PP_WITH_IMAGE
 #	include <SDL2pp/RWops.hh>
 #endif
@@ -68,6 +70,32 @@ Texture::Texture(Renderer& renderer, const Surface& surface) {
 		throw Exception("SDL_CreateTextureFromSurface");
 }
 
+#if SDL_VERSION_ATLEAST(2, 0, 6)
+Texture::Texture(Renderer& renderer, const Surface& surface, bool premultiply_alpha) {
+	if (!premultiply_alpha) {
+		if ((texture_ = SDL_CreateTextureFromSurface(renderer.Get(), surface.Get())) == nullptr)
+			throw Exception("SDL_CreateTextureFromSurface");
+		return;
+	}
+
+	SDL_Surface* copy = SDL_ConvertSurface(surface.Get(), surface.Get()->format, 0);
+	if (copy == nullptr)
+		throw Exception("SDL_ConvertSurface");
+
+	Surface premultiplied(copy);
+	premultiplied.PremultiplyAlpha();
+
+	if ((texture_ = SDL_CreateTextureFromSurface(renderer.Get(), premultiplied.Get())) == nullptr)
+		throw Exception("SDL_CreateTextureFromSurface");
+
+	if (SDL_SetTextureBlendMode(texture_, PremultipliedBlendMode()) != 0) {
+		Exception e("SDL_SetTextureBlendMode");
+		SDL_DestroyTexture(texture_);
+		throw e;
+	}
+}
+#endif
+
 Texture::~Texture() {
 	if (texture_ != nullptr)
 		SDL_DestroyTexture(texture_);
@@ -91,12 +119,29 @@ SDL_Texture* Texture::Get() const {
 	return texture_;
 }
 
+#if SDL_VERSION_ATLEAST(2, 0, 6)
+SDL_BlendMode Texture::PremultipliedBlendMode() {
+	static const SDL_BlendMode mode = SDL_ComposeCustomBlendMode(
+			SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+			SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD
+		);
+	return mode;
+}
+#endif
+
 Texture& Texture::Update(const Optional<Rect>& rect, const void* pixels, int pitch) {
-	if (SDL_UpdateTexture(texture_, rect ? &*rect : nullptr, pixels, pitch) != 0)
-		throw Exception("SDL_UpdateTexture");
+	TryUpdate(rect, pixels, pitch).ThrowIfFailed();
 	return *this;
 }
 
+Result Texture::TryUpdate(const Optional<Rect>& rect, const void* pixels, int pitch) {
+	SDL2PP_PROFILE_SCOPE(TextureUpdate);
+
+	if (SDL_UpdateTexture(texture_, rect ? &*rect : nullptr, pixels, pitch) != 0)
+		return Result("SDL_UpdateTexture", -1);
+	return Result();
+}
+
 Texture& Texture::Update(const Optional<Rect>& rect, Surface& surface) {
 	Rect real_rect = rect ? *rect : Rect(0, 0, GetWidth(), GetHeight());
 
@@ -133,7 +178,27 @@ Texture& Texture::Update(const Optional<Rect>& rect, Surface&& surface) {
 	}
 }
 
+Texture& Texture::Update(const Optional<Rect>& rect, Surface& surface, SurfacePool& pool) {
+	Rect real_rect = rect ? *rect : Rect(0, 0, GetWidth(), GetHeight());
+
+	real_rect.w = std::min(real_rect.w, surface.GetWidth());
+	real_rect.h = std::min(real_rect.h, surface.GetHeight());
+
+	if (GetFormat() == surface.GetFormat()) {
+		Surface::LockHandle lock = surface.Lock();
+
+		return Update(real_rect, lock.GetPixels(), lock.GetPitch());
+	} else {
+		SurfacePool::Lease converted = pool.Convert(surface, GetFormat());
+		Surface::LockHandle lock = converted.GetSurface().Lock();
+
+		return Update(real_rect, lock.GetPixels(), lock.GetPitch());
+	}
+}
+
 Texture& Texture::UpdateYUV(const Optional<Rect>& rect, const Uint8* yplane, int ypitch, const Uint8* uplane, int upitch, const Uint8* vplane, int vpitch) {
+	SDL2PP_PROFILE_SCOPE(TextureUpdate);
+
 	if (SDL_UpdateYUVTexture(texture_, rect ? &*rect : nullptr, yplane, ypitch, uplane, upitch, vplane, vpitch) != 0)
 		throw Exception("SDL_UpdateYUVTexture");
 	return *this;
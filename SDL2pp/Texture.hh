@@ -24,11 +24,14 @@
 
 #include <string>
 
+#include <SDL_version.h>
 #include <SDL_stdinc.h>
 #include <SDL_blendmode.h>
 
 #include <SDL2pp/Optional.hh>
 #include <SDL2pp/Rect.hh>
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Result.hh>
 #include <SDL2pp/Config.hh>
 #include <SDL2pp/Export.hh>
 #include <SDL2pp/Color.hh>
@@ -40,6 +43,7 @@ namespace SDL2pp {
 class Renderer;
 class RWops;
 class Surface;
+class SurfacePool;
 
 ////////////////////////////////////////////////////////////
 /// \brief Image stored in the graphics card memory that
@@ -99,6 +103,7 @@ public:
 		Texture* texture_; ///< SDL2pp::Texture this lock belongs to
 		void* pixels_;     ///< Pointer to raw pixel data of locked region
 		int pitch_;        ///< Number of bytes in a row of pixel data, including padding between lines
+		Point size_;       ///< Dimensions of locked region
 
 	private:
 		////////////////////////////////////////////////////////////
@@ -183,6 +188,25 @@ public:
 		///
 		////////////////////////////////////////////////////////////
 		int GetPitch() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get dimensions of locked region
+		///
+		/// \returns SDL2pp::Point representing width and height
+		///          of locked region in pixels
+		///
+		////////////////////////////////////////////////////////////
+		Point GetSize() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get pixel format of locked texture
+		///
+		/// \returns One of SDL_PixelFormatEnum values
+		///
+		/// \see Texture::GetFormat
+		///
+		////////////////////////////////////////////////////////////
+		Uint32 GetFormat() const;
 	};
 
 public:
@@ -247,6 +271,29 @@ public:
 	////////////////////////////////////////////////////////////
 	Texture(Renderer& renderer, const Surface& surface);
 
+#if SDL_VERSION_ATLEAST(2, 0, 6)
+	////////////////////////////////////////////////////////////
+	/// \brief Create texture from surface, optionally premultiplying alpha
+	///
+	/// \param[in] renderer Rendering context to create texture for
+	/// \param[in] surface Surface containing pixel data used to fill the texture
+	/// \param[in] premultiply_alpha Whether to convert pixel data to
+	///                              premultiplied alpha during upload
+	///
+	/// If premultiply_alpha is true, pixels are premultiplied on a
+	/// temporary copy of the surface (the source surface is not
+	/// modified) and the texture blend mode is set to
+	/// PremultipliedBlendMode(). This way the conversion is done
+	/// once instead of per frame.
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_CreateTextureFromSurface
+	///
+	////////////////////////////////////////////////////////////
+	Texture(Renderer& renderer, const Surface& surface, bool premultiply_alpha);
+#endif
+
 	////////////////////////////////////////////////////////////
 	/// \brief Destructor
 	///
@@ -297,6 +344,19 @@ public:
 	////////////////////////////////////////////////////////////
 	SDL_Texture* Get() const;
 
+#if SDL_VERSION_ATLEAST(2, 0, 6)
+	////////////////////////////////////////////////////////////
+	/// \brief Get blend mode for textures with premultiplied alpha
+	///
+	/// \returns Custom blend mode which computes
+	///          dstRGBA = srcRGBA + dstRGBA * (1 - srcA)
+	///
+	/// \see http://wiki.libsdl.org/SDL_ComposeCustomBlendMode
+	///
+	////////////////////////////////////////////////////////////
+	static SDL_BlendMode PremultipliedBlendMode();
+#endif
+
 	////////////////////////////////////////////////////////////
 	/// \brief Update the given texture rectangle with new pixel data
 	///
@@ -315,6 +375,22 @@ public:
 	////////////////////////////////////////////////////////////
 	Texture& Update(const Optional<Rect>& rect, const void* pixels, int pitch);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Non-throwing variant of Update()
+	///
+	/// \param[in] rect Rect representing the area to update, or NullOpt to
+	///                 update the entire texture
+	/// \param[in] pixels Raw pixel data
+	/// \param[in] pitch Number of bytes in a row of pixel data, including
+	///                  padding between lines
+	///
+	/// \returns SDL2pp::Result of the call
+	///
+	/// \see Update
+	///
+	////////////////////////////////////////////////////////////
+	Result TryUpdate(const Optional<Rect>& rect, const void* pixels, int pitch);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Update the given texture rectangle with new pixel data taken from surface
 	///
@@ -357,6 +433,27 @@ public:
 	////////////////////////////////////////////////////////////
 	Texture& Update(const Optional<Rect>& rect, Surface&& surface);
 
+	////////////////////////////////////////////////////////////
+	/// \brief Update the given texture rectangle with new pixel data taken from surface
+	///
+	/// Same as Update(const Optional<Rect>&, Surface&), but if
+	/// formats do not match, converted copy of the surface is
+	/// taken from the pool instead of being allocated
+	///
+	/// \param[in] rect Rect representing the area to update, or NullOpt to
+	///                 update the entire texture
+	/// \param[in] surface Surface to take pixel data from
+	/// \param[in] pool Pool to take conversion buffer from
+	///
+	/// \returns Reference to self
+	///
+	/// \throws SDL2pp::Exception
+	///
+	/// \see http://wiki.libsdl.org/SDL_UpdateTexture
+	///
+	////////////////////////////////////////////////////////////
+	Texture& Update(const Optional<Rect>& rect, Surface& surface, SurfacePool& pool);
+
 	////////////////////////////////////////////////////////////
 	/// \brief Update the given texture rectangle with new pixel data
 	///
@@ -22,24 +22,28 @@
 #include <SDL_render.h>
 
 #include <SDL2pp/Exception.hh>
+#include <SDL2pp/Profiler.hh>
 #include <SDL2pp/Rect.hh>
 
 #include <SDL2pp/Texture.hh>
 
 namespace SDL2pp {
 
-Texture::LockHandle::LockHandle() : texture_(nullptr), pixels_(nullptr), pitch_(0) {
+Texture::LockHandle::LockHandle() : texture_(nullptr), pixels_(nullptr), pitch_(0), size_(0, 0) {
 }
 
-Texture::LockHandle::LockHandle(Texture* texture, const Optional<Rect>& rect) : texture_(texture) {
+Texture::LockHandle::LockHandle(Texture* texture, const Optional<Rect>& rect) : texture_(texture), size_(rect ? rect->GetSize() : texture->GetSize()) {
+	SDL2PP_PROFILE_SCOPE(TextureLock);
+
 	if (SDL_LockTexture(texture_->Get(), rect ? &*rect : nullptr, &pixels_, &pitch_) != 0)
 		throw Exception("SDL_LockTexture");
 }
 
-Texture::LockHandle::LockHandle(Texture::LockHandle&& other) noexcept : texture_(other.texture_), pixels_(other.pixels_), pitch_(other.pitch_) {
+Texture::LockHandle::LockHandle(Texture::LockHandle&& other) noexcept : texture_(other.texture_), pixels_(other.pixels_), pitch_(other.pitch_), size_(other.size_) {
 	other.texture_ = nullptr;
 	other.pixels_ = nullptr;
 	other.pitch_ = 0;
+	other.size_ = Point(0, 0);
 }
 
 Texture::LockHandle& Texture::LockHandle::operator=(Texture::LockHandle&& other) noexcept {
@@ -52,10 +56,12 @@ Texture::LockHandle& Texture::LockHandle::operator=(Texture::LockHandle&& other)
 	texture_ = other.texture_;
 	pixels_ = other.pixels_;
 	pitch_ = other.pitch_;
+	size_ = other.size_;
 
 	other.texture_ = nullptr;
 	other.pixels_ = nullptr;
 	other.pitch_ = 0;
+	other.size_ = Point(0, 0);
 
 	return *this;
 }
@@ -73,4 +79,12 @@ int Texture::LockHandle::GetPitch() const {
 	return pitch_;
 }
 
+Point Texture::LockHandle::GetSize() const {
+	return size_;
+}
+
+Uint32 Texture::LockHandle::GetFormat() const {
+	return texture_->GetFormat();
+}
+
 }
@@ -0,0 +1,290 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include <SDL_render.h>
+
+#include <SDL2pp/TileMap.hh>
+#include <SDL2pp/Renderer.hh>
+#include <SDL2pp/private/TargetGuard.hh>
+
+namespace SDL2pp {
+
+namespace {
+
+// Sets blend mode of a texture and restores previous one on
+// scope exit
+class BlendModeGuard {
+private:
+	Texture& texture_;
+	SDL_BlendMode blend_mode_;
+
+public:
+	BlendModeGuard(Texture& texture, SDL_BlendMode blend_mode) : texture_(texture), blend_mode_(texture.GetBlendMode()) {
+		texture.SetBlendMode(blend_mode);
+	}
+
+	~BlendModeGuard() {
+		// errors can't be reported from destructor
+		SDL_SetTextureBlendMode(texture_.Get(), blend_mode_);
+	}
+
+	BlendModeGuard(const BlendModeGuard&) = delete;
+	BlendModeGuard& operator=(const BlendModeGuard&) = delete;
+};
+
+}
+
+TileMap::TileMap(Renderer& renderer, Texture& tileset, const Point& tile_size, const Point& map_size, int chunk_size)
+	: renderer_(renderer),
+	  tileset_(tileset),
+	  tile_size_(tile_size),
+	  map_size_(map_size),
+	  chunk_size_(chunk_size),
+	  max_cached_chunks_(64),
+	  frame_(0),
+	  num_bakes_(0) {
+	if (tile_size.x <= 0 || tile_size.y <= 0 || map_size.x <= 0 || map_size.y <= 0 || chunk_size <= 0)
+		throw std::invalid_argument("TileMap sizes must be positive");
+
+	tileset_columns_ = tileset.GetWidth() / tile_size.x;
+	if (tileset_columns_ == 0)
+		throw std::invalid_argument("Tileset is narrower than a single tile");
+
+	num_chunks_ = Point((map_size.x + chunk_size - 1) / chunk_size, (map_size.y + chunk_size - 1) / chunk_size);
+
+	tiles_.assign(static_cast<size_t>(map_size.x) * map_size.y, -1);
+	chunks_.assign(static_cast<size_t>(num_chunks_.x) * num_chunks_.y, Chunk{-1, true});
+}
+
+size_t TileMap::AcquireTexture(size_t chunk) {
+	Chunk& target = chunks_[chunk];
+	if (target.texture >= 0) {
+		cache_[target.texture].last_used = frame_;
+		return target.texture;
+	}
+
+	size_t index = cache_.size();
+
+	// reuse least recently drawn texture, unless all of them are
+	// visible in this frame
+	if (cache_.size() >= max_cached_chunks_) {
+		for (size_t i = 0; i < cache_.size(); i++)
+			if (cache_[i].last_used < frame_ && (index == cache_.size() || cache_[i].last_used < cache_[index].last_used))
+				index = i;
+	}
+
+	if (index == cache_.size()) {
+		Texture texture(renderer_, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, chunk_size_ * tile_size_.x, chunk_size_ * tile_size_.y);
+		texture.SetBlendMode(SDL_BLENDMODE_BLEND);
+		cache_.push_back(CachedTexture{std::move(texture), chunk, frame_});
+	} else {
+		chunks_[cache_[index].chunk].texture = -1;
+		cache_[index].chunk = chunk;
+		cache_[index].last_used = frame_;
+	}
+
+	target.texture = static_cast<int>(index);
+	target.dirty = true;
+
+	return index;
+}
+
+void TileMap::TrimCache() {
+	while (cache_.size() > max_cached_chunks_) {
+		size_t lru = 0;
+		for (size_t i = 1; i < cache_.size(); i++)
+			if (cache_[i].last_used < cache_[lru].last_used)
+				lru = i;
+
+		chunks_[cache_[lru].chunk].texture = -1;
+
+		if (lru != cache_.size() - 1) {
+			cache_[lru] = std::move(cache_.back());
+			chunks_[cache_[lru].chunk].texture = static_cast<int>(lru);
+		}
+		cache_.pop_back();
+	}
+}
+
+void TileMap::Bake(size_t chunk, Texture& texture) {
+	renderer_.SetTarget(texture);
+	renderer_.SetDrawColor(0, 0, 0, 0);
+	renderer_.Clear();
+
+	const int x0 = static_cast<int>(chunk % num_chunks_.x) * chunk_size_;
+	const int y0 = static_cast<int>(chunk / num_chunks_.x) * chunk_size_;
+	const int x1 = std::min(x0 + chunk_size_, map_size_.x);
+	const int y1 = std::min(y0 + chunk_size_, map_size_.y);
+
+	for (int y = y0; y < y1; y++) {
+		const int* row = tiles_.data() + static_cast<size_t>(y) * map_size_.x;
+		for (int x = x0; x < x1; x++) {
+			const int tile = row[x];
+			if (tile < 0)
+				continue;
+
+			renderer_.Copy(
+					tileset_,
+					Rect(tile % tileset_columns_ * tile_size_.x, tile / tileset_columns_ * tile_size_.y, tile_size_.x, tile_size_.y),
+					Rect((x - x0) * tile_size_.x, (y - y0) * tile_size_.y, tile_size_.x, tile_size_.y)
+				);
+		}
+	}
+
+	chunks_[chunk].dirty = false;
+	num_bakes_++;
+}
+
+void TileMap::InvalidateTile(int x, int y) {
+	chunks_[static_cast<size_t>(y / chunk_size_) * num_chunks_.x + x / chunk_size_].dirty = true;
+}
+
+int TileMap::GetTile(int x, int y) const {
+	if (x < 0 || y < 0 || x >= map_size_.x || y >= map_size_.y)
+		throw std::out_of_range("Tile position is outside of the map");
+
+	return tiles_[static_cast<size_t>(y) * map_size_.x + x];
+}
+
+void TileMap::SetTile(int x, int y, int tile) {
+	if (x < 0 || y < 0 || x >= map_size_.x || y >= map_size_.y)
+		throw std::out_of_range("Tile position is outside of the map");
+
+	int& current = tiles_[static_cast<size_t>(y) * map_size_.x + x];
+	if (current != tile) {
+		current = tile;
+		InvalidateTile(x, y);
+	}
+}
+
+void TileMap::Fill(const Rect& area, int tile) {
+	Optional<Rect> clipped = area.GetIntersection(Rect(Point(0, 0), map_size_));
+	if (!clipped)
+		return;
+
+	for (int y = clipped->y; y <= clipped->GetY2(); y++) {
+		int* row = tiles_.data() + static_cast<size_t>(y) * map_size_.x;
+		std::fill(row + clipped->x, row + clipped->x + clipped->w, tile);
+	}
+
+	for (int cy = clipped->y / chunk_size_; cy <= clipped->GetY2() / chunk_size_; cy++)
+		for (int cx = clipped->x / chunk_size_; cx <= clipped->GetX2() / chunk_size_; cx++)
+			chunks_[static_cast<size_t>(cy) * num_chunks_.x + cx].dirty = true;
+}
+
+void TileMap::SetTiles(const int* tiles) {
+	std::copy(tiles, tiles + tiles_.size(), tiles_.begin());
+	InvalidateAll();
+}
+
+void TileMap::InvalidateAll() {
+	for (Chunk& chunk : chunks_)
+		chunk.dirty = true;
+}
+
+void TileMap::SetMaxCachedChunks(size_t max_cached_chunks) {
+	max_cached_chunks_ = max_cached_chunks;
+}
+
+void TileMap::Draw(const Rect& viewport, const Point& position) {
+	frame_++;
+	TrimCache();
+
+	Optional<Rect> visible = viewport.GetIntersection(Rect(Point(0, 0), GetSize()));
+	if (!visible)
+		return;
+
+	const Point chunk_pixels = tile_size_ * chunk_size_;
+	const int cx1 = visible->x / chunk_pixels.x;
+	const int cy1 = visible->y / chunk_pixels.y;
+	const int cx2 = visible->GetX2() / chunk_pixels.x;
+	const int cy2 = visible->GetY2() / chunk_pixels.y;
+
+	// textures of visible chunks are acquired first, and all stale
+	// chunks are then baked at once, so rendering target is only
+	// switched away and back once
+	bool stale = false;
+	for (int cy = cy1; cy <= cy2; cy++) {
+		for (int cx = cx1; cx <= cx2; cx++) {
+			const size_t chunk = static_cast<size_t>(cy) * num_chunks_.x + cx;
+			AcquireTexture(chunk);
+			stale = stale || chunks_[chunk].dirty;
+		}
+	}
+
+	if (stale) {
+		// restores caller's target state and tileset blend mode,
+		// also if baking throws
+		Private::TargetGuard target_guard(renderer_);
+
+		// tiles do not overlap, so alpha is copied as is
+		// instead of being blended with the cleared target
+		BlendModeGuard blend_mode_guard(tileset_, SDL_BLENDMODE_NONE);
+
+		for (int cy = cy1; cy <= cy2; cy++) {
+			for (int cx = cx1; cx <= cx2; cx++) {
+				const size_t chunk = static_cast<size_t>(cy) * num_chunks_.x + cx;
+				if (chunks_[chunk].dirty)
+					Bake(chunk, cache_[chunks_[chunk].texture].texture);
+			}
+		}
+	}
+
+	for (int cy = cy1; cy <= cy2; cy++) {
+		for (int cx = cx1; cx <= cx2; cx++) {
+			const size_t chunk = static_cast<size_t>(cy) * num_chunks_.x + cx;
+			const Point origin(cx * chunk_pixels.x, cy * chunk_pixels.y);
+			const Rect part = *Rect(origin, chunk_pixels).GetIntersection(*visible);
+
+			renderer_.Copy(
+					cache_[chunks_[chunk].texture].texture,
+					part - origin,
+					part - viewport.GetTopLeft() + position
+				);
+		}
+	}
+}
+
+Point TileMap::GetMapSize() const {
+	return map_size_;
+}
+
+Point TileMap::GetTileSize() const {
+	return tile_size_;
+}
+
+Point TileMap::GetSize() const {
+	return Point(map_size_.x * tile_size_.x, map_size_.y * tile_size_.y);
+}
+
+size_t TileMap::GetNumCachedChunks() const {
+	return cache_.size();
+}
+
+unsigned long TileMap::GetNumBakes() const {
+	return num_bakes_;
+}
+
+}
@@ -0,0 +1,301 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_TILEMAP_HH
+#define SDL2PP_TILEMAP_HH
+
+#include <cstddef>
+#include <vector>
+
+#include <SDL_stdinc.h>
+#include <SDL_pixels.h>
+
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Texture.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+class Renderer;
+
+////////////////////////////////////////////////////////////
+/// \brief Grid of tiles drawn from a tileset with chunk caching
+///
+/// \ingroup rendering
+///
+/// \headerfile SDL2pp/TileMap.hh
+///
+/// Drawing large tile maps with a Renderer::Copy() call per
+/// tile does not scale. This class splits the map into square
+/// chunks of tiles which are baked into render target textures
+/// when first seen, so drawing the visible part of the map
+/// takes a single Renderer::Copy() call per visible chunk.
+/// Changing a tile only marks its chunk for re-baking.
+///
+/// Tiles are numbered left to right, top to bottom in the
+/// tileset texture, starting from zero. Negative index denotes
+/// an empty (transparent) tile.
+///
+/// Only a limited number of chunk textures is kept; least
+/// recently drawn chunks are evicted and their textures are
+/// reused. Contents of target textures may be lost by some
+/// renderers (see SDL_RENDER_TARGETS_RESET event), in which
+/// case InvalidateAll() must be called.
+///
+/// Neither tileset texture nor renderer may be destroyed
+/// before the map.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::Texture tileset(renderer, "tiles.png");
+///     SDL2pp::TileMap map(renderer, tileset, SDL2pp::Point(16, 16), SDL2pp::Point(4096, 4096));
+///
+///     map.SetTile(10, 20, 3);
+///
+///     // Draw part of the map visible through the camera
+///     map.Draw(SDL2pp::Rect(camera.x, camera.y, 1280, 720));
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT TileMap {
+private:
+	struct Chunk {
+		int texture;             ///< Index of cached texture or -1
+		bool dirty;              ///< Whether cached texture is stale
+	};
+
+	struct CachedTexture {
+		Texture texture;         ///< Chunk texture
+		size_t chunk;            ///< Index of chunk it holds
+		unsigned long last_used; ///< Frame number it was drawn at
+	};
+
+private:
+	Renderer& renderer_;                ///< Renderer the map is drawn with
+	Texture& tileset_;                  ///< Texture to take tiles from
+	Point tile_size_;                   ///< Size of a single tile in pixels
+	Point map_size_;                    ///< Size of the map in tiles
+	int chunk_size_;                    ///< Size of chunk side in tiles
+	Point num_chunks_;                  ///< Size of the map in chunks
+	int tileset_columns_;               ///< Number of tiles in tileset row
+	std::vector<int> tiles_;            ///< Tile indices, row by row
+	std::vector<Chunk> chunks_;         ///< Chunks, row by row
+	std::vector<CachedTexture> cache_;  ///< Textures holding baked chunks
+	size_t max_cached_chunks_;          ///< Soft limit on number of cached textures
+	unsigned long frame_;               ///< Number of Draw() calls so far
+	unsigned long num_bakes_;           ///< Number of chunks baked so far
+
+private:
+	////////////////////////////////////////////////////////////
+	/// \brief Get cached texture for given chunk
+	///
+	/// Evicts least recently drawn chunk or creates new texture
+	/// if the chunk is not cached yet; such texture is marked
+	/// as stale.
+	///
+	/// \param[in] chunk Index of chunk
+	///
+	/// \returns Index of texture in cache
+	///
+	////////////////////////////////////////////////////////////
+	size_t AcquireTexture(size_t chunk);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Free cached textures over the limit
+	///
+	////////////////////////////////////////////////////////////
+	void TrimCache();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Render tiles of chunk into texture
+	///
+	/// \param[in] chunk Index of chunk
+	/// \param[in] texture Target texture
+	///
+	////////////////////////////////////////////////////////////
+	void Bake(size_t chunk, Texture& texture);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Mark chunk containing given tile as stale
+	///
+	/// \param[in] x X coordinate of the tile
+	/// \param[in] y Y coordinate of the tile
+	///
+	////////////////////////////////////////////////////////////
+	void InvalidateTile(int x, int y);
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Create empty tile map
+	///
+	/// \param[in] renderer Renderer to draw with
+	/// \param[in] tileset Texture containing tiles laid out in a grid
+	/// \param[in] tile_size Size of a single tile in pixels
+	/// \param[in] map_size Size of the map in tiles
+	/// \param[in] chunk_size Size of cached chunk side in tiles
+	///
+	/// \throws std::invalid_argument if any of sizes is not positive
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	TileMap(Renderer& renderer, Texture& tileset, const Point& tile_size, const Point& map_size, int chunk_size = 32);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted copy constructor
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	TileMap(const TileMap& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted assignment operator
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	TileMap& operator=(const TileMap& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get tile at given position
+	///
+	/// \param[in] x X coordinate of the tile
+	/// \param[in] y Y coordinate of the tile
+	///
+	/// \returns Tile index
+	///
+	/// \throws std::out_of_range if position is outside of the map
+	///
+	////////////////////////////////////////////////////////////
+	int GetTile(int x, int y) const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set tile at given position
+	///
+	/// \param[in] x X coordinate of the tile
+	/// \param[in] y Y coordinate of the tile
+	/// \param[in] tile Tile index, negative for empty tile
+	///
+	/// \throws std::out_of_range if position is outside of the map
+	///
+	////////////////////////////////////////////////////////////
+	void SetTile(int x, int y, int tile);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set all tiles in given area
+	///
+	/// \param[in] area Area of the map in tiles, clipped to map bounds
+	/// \param[in] tile Tile index, negative for empty tile
+	///
+	////////////////////////////////////////////////////////////
+	void Fill(const Rect& area, int tile);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set tiles of the map from array
+	///
+	/// \param[in] tiles Array of map width * height tile indices, row by row
+	///
+	////////////////////////////////////////////////////////////
+	void SetTiles(const int* tiles);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Mark all cached chunks as stale
+	///
+	/// Should be called when tileset texture contents change or
+	/// when render targets are lost
+	///
+	////////////////////////////////////////////////////////////
+	void InvalidateAll();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Set number of chunk textures to keep
+	///
+	/// If more chunks are visible at once, the limit is
+	/// exceeded. Extra textures are freed on next Draw().
+	///
+	/// \param[in] max_cached_chunks Number of chunk textures to keep
+	///
+	////////////////////////////////////////////////////////////
+	void SetMaxCachedChunks(size_t max_cached_chunks);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Draw part of the map
+	///
+	/// Bakes visible chunks which are not cached or stale, then
+	/// copies them to current rendering target. Rendering target
+	/// with its viewport, clip rect and scale, draw color and
+	/// tileset blend mode are preserved, also if baking fails.
+	///
+	/// \param[in] viewport Area of the map in pixels to draw
+	/// \param[in] position Point of rendering target to draw viewport at
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	void Draw(const Rect& viewport, const Point& position = Point(0, 0));
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get size of the map in tiles
+	///
+	/// \returns Map size in tiles
+	///
+	////////////////////////////////////////////////////////////
+	Point GetMapSize() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get size of a single tile
+	///
+	/// \returns Tile size in pixels
+	///
+	////////////////////////////////////////////////////////////
+	Point GetTileSize() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get size of the map in pixels
+	///
+	/// \returns Map size in pixels
+	///
+	////////////////////////////////////////////////////////////
+	Point GetSize() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of currently cached chunk textures
+	///
+	/// \returns Number of cached chunks
+	///
+	////////////////////////////////////////////////////////////
+	size_t GetNumCachedChunks() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of chunk bakes done so far
+	///
+	/// \returns Number of chunk bakes
+	///
+	////////////////////////////////////////////////////////////
+	unsigned long GetNumBakes() const;
+};
+
+}
+
+#endif
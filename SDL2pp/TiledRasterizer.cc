@@ -0,0 +1,450 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <SDL_cpuinfo.h>
+#include <SDL_surface.h>
+
+#include <SDL2pp/TiledRasterizer.hh>
+#include <SDL2pp/Exception.hh>
+
+namespace SDL2pp {
+
+namespace {
+
+// Margin added to bounding boxes of anti-aliased primitives,
+// which may touch pixels adjacent to their geometric extent
+constexpr int aa_margin = 2;
+
+// Bounding box of float coordinates, grown by aa_margin and
+// clipped to the target of given size. Clipping is done in float,
+// as far away coordinates do not fit into int; box is empty for
+// non-finite input
+Rect FloatBounds(float x1, float y1, float x2, float y2, const Point& size) {
+	if (!std::isfinite(x1) || !std::isfinite(y1) || !std::isfinite(x2) || !std::isfinite(y2))
+		return Rect();
+
+	const float left = std::max(std::floor(std::min(x1, x2)) - aa_margin, 0.0f);
+	const float top = std::max(std::floor(std::min(y1, y2)) - aa_margin, 0.0f);
+	const float right = std::min(std::ceil(std::max(x1, x2)) + aa_margin, static_cast<float>(size.x));
+	const float bottom = std::min(std::ceil(std::max(y1, y2)) + aa_margin, static_cast<float>(size.y));
+	if (left >= right || top >= bottom)
+		return Rect();
+
+	return Rect(static_cast<int>(left), static_cast<int>(top), static_cast<int>(right - left), static_cast<int>(bottom - top));
+}
+
+// Same for points; computed in long long, as differences of
+// extreme int coordinates overflow
+Rect PointBounds(const Point* points, int count, const Point& size) {
+	int left = points[0].x, top = points[0].y, right = points[0].x, bottom = points[0].y;
+	for (const Point* p = points + 1; p != points + count; ++p) {
+		left = std::min(left, p->x);
+		top = std::min(top, p->y);
+		right = std::max(right, p->x);
+		bottom = std::max(bottom, p->y);
+	}
+
+	const long long x1 = std::max(static_cast<long long>(left) - aa_margin, 0LL);
+	const long long y1 = std::max(static_cast<long long>(top) - aa_margin, 0LL);
+	const long long x2 = std::min(static_cast<long long>(right) + 1 + aa_margin, static_cast<long long>(size.x));
+	const long long y2 = std::min(static_cast<long long>(bottom) + 1 + aa_margin, static_cast<long long>(size.y));
+	if (x1 >= x2 || y1 >= y2)
+		return Rect();
+
+	return Rect(static_cast<int>(x1), static_cast<int>(y1), static_cast<int>(x2 - x1), static_cast<int>(y2 - y1));
+}
+
+// Creates surface sharing pixels and blitting attributes of given one
+Surface MakeAlias(SDL_Surface* original, void* pixels, int width, int height) {
+	const SDL_PixelFormat* format = original->format;
+	Surface alias(pixels, width, height, format->BitsPerPixel, original->pitch, format->Rmask, format->Gmask, format->Bmask, format->Amask);
+
+	if (format->palette != nullptr && SDL_SetSurfacePalette(alias.Get(), format->palette) != 0)
+		throw Exception("SDL_SetSurfacePalette");
+
+	Uint32 key;
+	if (SDL_GetColorKey(original, &key) == 0)
+		alias.SetColorKey(true, key);
+
+	SDL_BlendMode blend_mode;
+	if (SDL_GetSurfaceBlendMode(original, &blend_mode) != 0)
+		throw Exception("SDL_GetSurfaceBlendMode");
+
+	Uint8 r, g, b, a;
+	if (SDL_GetSurfaceColorMod(original, &r, &g, &b) != 0)
+		throw Exception("SDL_GetSurfaceColorMod");
+	if (SDL_GetSurfaceAlphaMod(original, &a) != 0)
+		throw Exception("SDL_GetSurfaceAlphaMod");
+
+	alias.SetBlendMode(blend_mode).SetColorMod(r, g, b).SetAlphaMod(a);
+
+	return alias;
+}
+
+}
+
+TiledRasterizer::TiledRasterizer(Surface& target, int tile_size, int num_threads) :
+	target_(target),
+	tile_size_(tile_size),
+	mutex_(nullptr),
+	cond_(nullptr),
+	generation_(0),
+	busy_(0),
+	stop_(false),
+	next_tile_(0) {
+	SDL_Surface* surface = target_.Get();
+
+	if (tile_size < 1)
+		throw std::invalid_argument("Tile size must be positive");
+	if (SDL_MUSTLOCK(surface))
+		throw std::invalid_argument("TiledRasterizer target must not be RLE accelerated");
+
+	if (num_threads <= 0)
+		num_threads = SDL_GetCPUCount();
+	num_threads = std::max(num_threads, 1);
+
+	tiles_x_ = (surface->w + tile_size - 1) / tile_size;
+	tiles_y_ = (surface->h + tile_size - 1) / tile_size;
+	bins_.resize(static_cast<size_t>(tiles_x_) * tiles_y_);
+
+	// surfaces are created upfront, as SDL surface
+	// creation is not safe to do from worker threads
+	workers_.resize(static_cast<size_t>(num_threads));
+	for (Worker& worker : workers_) {
+		worker.self = this;
+		worker.thread = nullptr;
+		worker.target = MakeAlias(surface, surface->pixels, surface->w, surface->h);
+	}
+
+	if ((mutex_ = SDL_CreateMutex()) == nullptr)
+		throw Exception("SDL_CreateMutex");
+
+	if ((cond_ = SDL_CreateCond()) == nullptr) {
+		Exception e("SDL_CreateCond");
+		SDL_DestroyMutex(mutex_);
+		throw e;
+	}
+
+	for (auto worker = workers_.begin() + 1; worker != workers_.end(); ++worker) {
+		if ((worker->thread = SDL_CreateThread(WorkerThread, "SDL2pp rasterizer", &*worker)) == nullptr) {
+			Exception e("SDL_CreateThread");
+			StopWorkers();
+			throw e;
+		}
+	}
+}
+
+TiledRasterizer::~TiledRasterizer() {
+	StopWorkers();
+}
+
+void TiledRasterizer::StopWorkers() {
+	SDL_LockMutex(mutex_);
+	stop_ = true;
+	SDL_CondBroadcast(cond_);
+	SDL_UnlockMutex(mutex_);
+
+	for (Worker& worker : workers_)
+		if (worker.thread != nullptr)
+			SDL_WaitThread(worker.thread, nullptr);
+
+	SDL_DestroyCond(cond_);
+	SDL_DestroyMutex(mutex_);
+}
+
+int TiledRasterizer::WorkerThread(void* data) {
+	Worker* worker = static_cast<Worker*>(data);
+	TiledRasterizer* self = worker->self;
+
+	unsigned long generation = 0;
+
+	SDL_LockMutex(self->mutex_);
+	while (true) {
+		while (self->generation_ == generation && !self->stop_)
+			SDL_CondWait(self->cond_, self->mutex_);
+
+		if (self->stop_)
+			break;
+
+		generation = self->generation_;
+		SDL_UnlockMutex(self->mutex_);
+
+		self->RunTiles(*worker);
+
+		SDL_LockMutex(self->mutex_);
+		if (--self->busy_ == 0)
+			SDL_CondBroadcast(self->cond_);
+	}
+	SDL_UnlockMutex(self->mutex_);
+
+	return 0;
+}
+
+void TiledRasterizer::RunTiles(Worker& worker) {
+	const int num_tiles = static_cast<int>(active_tiles_.size());
+
+	int index;
+	while ((index = next_tile_++) < num_tiles) {
+		try {
+			RenderTile(active_tiles_[index], worker);
+		} catch (...) {
+			SDL_LockMutex(mutex_);
+			if (!error_)
+				error_ = std::current_exception();
+			SDL_UnlockMutex(mutex_);
+
+			// skip remaining tiles, the frame is incomplete anyway
+			next_tile_ = num_tiles;
+		}
+	}
+}
+
+void TiledRasterizer::RenderTile(int tile, Worker& worker) {
+	Surface& surface = *worker.target;
+
+	// commands are executed in target coordinates and clipped
+	// to the tile, so rounding is the same as for direct drawing
+	const Rect tile_rect(tile % tiles_x_ * tile_size_, tile / tiles_x_ * tile_size_, tile_size_, tile_size_);
+	const Optional<Rect> clip = tile_rect.GetIntersection(Rect(target_.Get()->clip_rect));
+	if (!clip)
+		return;
+	surface.SetClipRect(*clip);
+
+	for (Uint32 index : bins_[tile]) {
+		const Command& command = commands_[index];
+
+		switch (command.type) {
+		case CommandType::FillRect:
+			surface.FillRect(command.rect, SDL_MapRGBA(surface.Get()->format, command.color.r, command.color.g, command.color.b, command.color.a));
+			break;
+		case CommandType::BlendFillRect:
+			surface.BlendFillRect(command.rect, command.color);
+			break;
+		case CommandType::DrawLine:
+			surface.DrawLine(command.coords[0], command.coords[1], command.coords[2], command.coords[3], command.color);
+			break;
+		case CommandType::DrawCircle:
+			surface.DrawCircle(command.coords[0], command.coords[1], command.coords[2], command.color);
+			break;
+		case CommandType::FillCircle:
+			surface.FillCircle(command.coords[0], command.coords[1], command.coords[2], command.color);
+			break;
+		case CommandType::DrawPolygon:
+			surface.DrawPolygon(command.points, command.count, command.color);
+			break;
+		case CommandType::FillPolygon:
+			surface.FillPolygon(command.points, command.count, command.color);
+			break;
+		case CommandType::Copy:
+			if (command.srcrect.w == command.rect.w && command.srcrect.h == command.rect.h)
+				worker.sources[command.source].Blit(command.srcrect, surface, command.rect);
+			else
+				worker.sources[command.source].BlitScaled(command.srcrect, surface, command.rect);
+			break;
+		}
+	}
+}
+
+void TiledRasterizer::AddCommand(const Command& command, const Rect& bounds) {
+	SDL_Surface* surface = target_.Get();
+
+	const Uint32 index = static_cast<Uint32>(commands_.size());
+	commands_.push_back(command);
+
+	const int x1 = std::max(bounds.x, 0);
+	const int y1 = std::max(bounds.y, 0);
+	const int x2 = std::min(bounds.x + bounds.w, surface->w);
+	const int y2 = std::min(bounds.y + bounds.h, surface->h);
+	if (x1 >= x2 || y1 >= y2)
+		return;
+
+	for (int ty = y1 / tile_size_; ty <= (y2 - 1) / tile_size_; ty++) {
+		for (int tx = x1 / tile_size_; tx <= (x2 - 1) / tile_size_; tx++) {
+			const int tile = ty * tiles_x_ + tx;
+			if (bins_[tile].empty())
+				active_tiles_.push_back(tile);
+			bins_[tile].push_back(index);
+		}
+	}
+}
+
+TiledRasterizer& TiledRasterizer::Clear(const Color& color) {
+	return FillRect(Rect(0, 0, target_.GetWidth(), target_.GetHeight()), color);
+}
+
+TiledRasterizer& TiledRasterizer::FillRect(const Rect& rect, const Color& color) {
+	Command command = {};
+	command.type = CommandType::FillRect;
+	command.rect = rect;
+	command.color = color;
+	AddCommand(command, rect);
+	return *this;
+}
+
+TiledRasterizer& TiledRasterizer::BlendFillRect(const Rect& rect, const Color& color) {
+	Command command = {};
+	command.type = CommandType::BlendFillRect;
+	command.rect = rect;
+	command.color = color;
+	AddCommand(command, rect);
+	return *this;
+}
+
+TiledRasterizer& TiledRasterizer::DrawLine(float x1, float y1, float x2, float y2, const Color& color) {
+	Command command = {};
+	command.type = CommandType::DrawLine;
+	command.color = color;
+	command.coords[0] = x1;
+	command.coords[1] = y1;
+	command.coords[2] = x2;
+	command.coords[3] = y2;
+	AddCommand(command, FloatBounds(x1, y1, x2, y2, target_.GetSize()));
+	return *this;
+}
+
+TiledRasterizer& TiledRasterizer::DrawCircle(float x, float y, float radius, const Color& color) {
+	Command command = {};
+	command.type = CommandType::DrawCircle;
+	command.color = color;
+	command.coords[0] = x;
+	command.coords[1] = y;
+	command.coords[2] = radius;
+	AddCommand(command, FloatBounds(x - radius, y - radius, x + radius, y + radius, target_.GetSize()));
+	return *this;
+}
+
+TiledRasterizer& TiledRasterizer::FillCircle(float x, float y, float radius, const Color& color) {
+	Command command = {};
+	command.type = CommandType::FillCircle;
+	command.color = color;
+	command.coords[0] = x;
+	command.coords[1] = y;
+	command.coords[2] = radius;
+	AddCommand(command, FloatBounds(x - radius, y - radius, x + radius, y + radius, target_.GetSize()));
+	return *this;
+}
+
+TiledRasterizer& TiledRasterizer::DrawPolygon(const Point* points, int count, const Color& color) {
+	if (count < 2)
+		return *this;
+
+	Command command = {};
+	command.type = CommandType::DrawPolygon;
+	command.color = color;
+	command.points = points;
+	command.count = count;
+	AddCommand(command, PointBounds(points, count, target_.GetSize()));
+	return *this;
+}
+
+TiledRasterizer& TiledRasterizer::FillPolygon(const Point* points, int count, const Color& color) {
+	if (count < 3)
+		return *this;
+
+	Command command = {};
+	command.type = CommandType::FillPolygon;
+	command.color = color;
+	command.points = points;
+	command.count = count;
+	AddCommand(command, PointBounds(points, count, target_.GetSize()));
+	return *this;
+}
+
+TiledRasterizer& TiledRasterizer::Copy(Surface& source, const Optional<Rect>& srcrect, const Rect& dstrect) {
+	auto found = std::find(sources_.begin(), sources_.end(), &source);
+	if (found == sources_.end())
+		found = sources_.insert(sources_.end(), &source);
+
+	Command command = {};
+	command.type = CommandType::Copy;
+	command.rect = dstrect;
+	command.source = static_cast<size_t>(found - sources_.begin());
+	command.srcrect = srcrect ? *srcrect : Rect(0, 0, source.GetWidth(), source.GetHeight());
+	AddCommand(command, dstrect);
+	return *this;
+}
+
+void TiledRasterizer::Flush() {
+	if (commands_.empty())
+		return;
+
+	error_ = nullptr;
+
+	try {
+		std::vector<Surface::LockHandle> locks;
+		locks.reserve(sources_.size() + 1);
+		locks.push_back(target_.Lock());
+
+		// sources are locked so pixels of RLE surfaces are
+		// available, and aliased for each worker
+		for (Surface* source : sources_) {
+			locks.push_back(source->Lock());
+			for (Worker& worker : workers_)
+				worker.sources.push_back(MakeAlias(source->Get(), source->Get()->pixels, source->GetWidth(), source->GetHeight()));
+		}
+
+		next_tile_ = 0;
+
+		SDL_LockMutex(mutex_);
+		generation_++;
+		busy_ = static_cast<int>(workers_.size()) - 1;
+		SDL_CondBroadcast(cond_);
+		SDL_UnlockMutex(mutex_);
+
+		RunTiles(workers_.front());
+
+		SDL_LockMutex(mutex_);
+		while (busy_ > 0)
+			SDL_CondWait(cond_, mutex_);
+		SDL_UnlockMutex(mutex_);
+	} catch (...) {
+		error_ = std::current_exception();
+	}
+
+	for (Worker& worker : workers_)
+		worker.sources.clear();
+	for (int tile : active_tiles_)
+		bins_[tile].clear();
+	active_tiles_.clear();
+	commands_.clear();
+	sources_.clear();
+
+	if (error_)
+		std::rethrow_exception(error_);
+}
+
+size_t TiledRasterizer::GetNumCommands() const {
+	return commands_.size();
+}
+
+int TiledRasterizer::GetNumTiles() const {
+	return tiles_x_ * tiles_y_;
+}
+
+int TiledRasterizer::GetNumThreads() const {
+	return static_cast<int>(workers_.size());
+}
+
+}
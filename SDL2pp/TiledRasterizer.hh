@@ -0,0 +1,394 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_TILEDRASTERIZER_HH
+#define SDL2PP_TILEDRASTERIZER_HH
+
+#include <atomic>
+#include <exception>
+#include <vector>
+
+#include <SDL_stdinc.h>
+#include <SDL_mutex.h>
+#include <SDL_thread.h>
+
+#include <SDL2pp/Optional.hh>
+#include <SDL2pp/Color.hh>
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/Export.hh>
+
+namespace SDL2pp {
+
+////////////////////////////////////////////////////////////
+/// \brief Multi-threaded software rasterizer for a surface
+///
+/// \ingroup rendering
+///
+/// \headerfile SDL2pp/TiledRasterizer.hh
+///
+/// Records drawing commands, and on Flush() bins them into
+/// square tiles of the target surface by their bounding boxes,
+/// then rasterizes tiles in parallel on a pool of worker
+/// threads. Commands of a tile are executed in recording order
+/// with Surface drawing functions and blits, clipped to the
+/// tile, so the result is the same as when drawing directly
+/// into the target (scaled copies may differ by rounding at
+/// tile boundaries).
+///
+/// This is intended for headless rendering without a GPU,
+/// where a single threaded software renderer is the bottleneck.
+///
+/// Source surfaces of Copy() and point arrays are referenced
+/// until Flush(), and must not be modified or destroyed before
+/// it. Target surface must not be RLE accelerated.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::Surface frame(0, 1920, 1080, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+///     SDL2pp::TiledRasterizer rasterizer(frame);
+///
+///     rasterizer.Clear(SDL2pp::Color(0, 0, 0));
+///     for (auto& sprite : sprites)
+///         rasterizer.Copy(sprite.GetSurface(), SDL2pp::NullOpt, sprite.GetRect());
+///     rasterizer.Flush();
+///
+///     // frame now contains rendered image
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT TiledRasterizer {
+private:
+	////////////////////////////////////////////////////////////
+	/// \brief Recorded command type
+	///
+	////////////////////////////////////////////////////////////
+	enum class CommandType {
+		FillRect,
+		BlendFillRect,
+		DrawLine,
+		DrawCircle,
+		FillCircle,
+		DrawPolygon,
+		FillPolygon,
+		Copy,
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Recorded command
+	///
+	////////////////////////////////////////////////////////////
+	struct Command {
+		CommandType type;           ///< Command type
+		Rect rect;                  ///< Destination rectangle
+		Color color;                ///< Drawing color
+		float coords[4];            ///< Line or circle coordinates
+		const Point* points;        ///< Polygon vertices
+		int count;                  ///< Number of polygon vertices
+		size_t source;              ///< Index of source surface for Copy
+		Rect srcrect;               ///< Source rectangle for Copy
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Worker thread state
+	///
+	/// Each worker has its own surfaces sharing pixels of the
+	/// target and sources, as blitting modifies blit mapping
+	/// state of both source and destination surfaces, so these
+	/// may not be shared between threads
+	///
+	////////////////////////////////////////////////////////////
+	struct Worker {
+		TiledRasterizer* self;        ///< Owning rasterizer
+		SDL_Thread* thread;           ///< Thread handle, nullptr for calling thread
+		Optional<Surface> target;     ///< Surface sharing pixels of the target
+		std::vector<Surface> sources; ///< Surfaces sharing pixels of Copy sources
+	};
+
+	Surface& target_;                           ///< Target surface
+	int tile_size_;                             ///< Tile width and height in pixels
+	int tiles_x_;                               ///< Number of tile columns
+	int tiles_y_;                               ///< Number of tile rows
+
+	std::vector<std::vector<Uint32>> bins_;     ///< Per-tile indices of intersecting commands
+	std::vector<int> active_tiles_;             ///< Indices of tiles with commands
+	std::vector<Command> commands_;             ///< Recorded commands
+	std::vector<Surface*> sources_;             ///< Distinct source surfaces of recorded copies
+
+	std::vector<Worker> workers_;               ///< Worker states, first one is the calling thread
+	SDL_mutex* mutex_;                          ///< Mutex protecting pool state
+	SDL_cond* cond_;                            ///< Condition signaled on pool state changes
+	unsigned long generation_;                  ///< Number of started flushes
+	int busy_;                                  ///< Number of workers not yet done with current flush
+	bool stop_;                                 ///< Whether workers should exit
+	std::atomic<int> next_tile_;                ///< Index of next active tile to take
+	std::exception_ptr error_;                  ///< First exception thrown while rasterizing
+
+private:
+	////////////////////////////////////////////////////////////
+	/// \brief Worker thread function
+	///
+	////////////////////////////////////////////////////////////
+	static int WorkerThread(void* data);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Rasterize active tiles until none are left
+	///
+	/// \param[in] worker Worker state of the calling thread
+	///
+	////////////////////////////////////////////////////////////
+	void RunTiles(Worker& worker);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Execute binned commands of a single tile
+	///
+	/// \param[in] tile Tile index
+	/// \param[in] worker Worker state of the calling thread
+	///
+	////////////////////////////////////////////////////////////
+	void RenderTile(int tile, Worker& worker);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Record command and add it to bins of tiles it touches
+	///
+	/// \param[in] command Command to record
+	/// \param[in] bounds Bounding box of pixels command may touch
+	///
+	////////////////////////////////////////////////////////////
+	void AddCommand(const Command& command, const Rect& bounds);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Stop and join worker threads
+	///
+	////////////////////////////////////////////////////////////
+	void StopWorkers();
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Construct rasterizer for given target surface
+	///
+	/// \param[in] target Surface to draw into, must outlive the rasterizer
+	/// \param[in] tile_size Tile width and height in pixels
+	/// \param[in] num_threads Number of threads rasterizing tiles,
+	///                        including the one calling Flush(), or 0
+	///                        to use the number of CPU cores
+	///
+	/// \throws std::invalid_argument
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	TiledRasterizer(Surface& target, int tile_size = 64, int num_threads = 0);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Destructor
+	///
+	/// Pending commands are discarded
+	///
+	////////////////////////////////////////////////////////////
+	~TiledRasterizer();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted copy constructor
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	TiledRasterizer(const TiledRasterizer& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Deleted assignment operator
+	///
+	/// This class is not copyable
+	///
+	////////////////////////////////////////////////////////////
+	TiledRasterizer& operator=(const TiledRasterizer& other) = delete;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Record filling the whole target with a color
+	///
+	/// Same as Surface::FillRect(), respects target clipping
+	/// rectangle
+	///
+	/// \param[in] color Color to fill with
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	TiledRasterizer& Clear(const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Record filling a rectangle with a color
+	///
+	/// \param[in] rect Rectangle to fill
+	/// \param[in] color Color to fill with, replacing pixels
+	///                  including alpha
+	///
+	/// \returns Reference to self
+	///
+	/// \see Surface::FillRect
+	///
+	////////////////////////////////////////////////////////////
+	TiledRasterizer& FillRect(const Rect& rect, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Record alpha blended rectangle fill
+	///
+	/// \param[in] rect Rectangle to fill
+	/// \param[in] color Color to blend
+	///
+	/// \returns Reference to self
+	///
+	/// \see Surface::BlendFillRect
+	///
+	////////////////////////////////////////////////////////////
+	TiledRasterizer& BlendFillRect(const Rect& rect, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Record drawing an anti-aliased line
+	///
+	/// \param[in] x1 X coordinate of the start point
+	/// \param[in] y1 Y coordinate of the start point
+	/// \param[in] x2 X coordinate of the end point
+	/// \param[in] y2 Y coordinate of the end point
+	/// \param[in] color Line color
+	///
+	/// \returns Reference to self
+	///
+	/// \see Surface::DrawLine
+	///
+	////////////////////////////////////////////////////////////
+	TiledRasterizer& DrawLine(float x1, float y1, float x2, float y2, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Record drawing an anti-aliased circle outline
+	///
+	/// \param[in] x X coordinate of the center
+	/// \param[in] y Y coordinate of the center
+	/// \param[in] radius Circle radius
+	/// \param[in] color Outline color
+	///
+	/// \returns Reference to self
+	///
+	/// \see Surface::DrawCircle
+	///
+	////////////////////////////////////////////////////////////
+	TiledRasterizer& DrawCircle(float x, float y, float radius, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Record drawing a filled anti-aliased circle
+	///
+	/// \param[in] x X coordinate of the center
+	/// \param[in] y Y coordinate of the center
+	/// \param[in] radius Circle radius
+	/// \param[in] color Fill color
+	///
+	/// \returns Reference to self
+	///
+	/// \see Surface::FillCircle
+	///
+	////////////////////////////////////////////////////////////
+	TiledRasterizer& FillCircle(float x, float y, float radius, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Record drawing an anti-aliased polygon outline
+	///
+	/// \param[in] points Array of polygon vertices, referenced until Flush()
+	/// \param[in] count Number of vertices
+	/// \param[in] color Outline color
+	///
+	/// \returns Reference to self
+	///
+	/// \see Surface::DrawPolygon
+	///
+	////////////////////////////////////////////////////////////
+	TiledRasterizer& DrawPolygon(const Point* points, int count, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Record drawing a filled polygon
+	///
+	/// \param[in] points Array of polygon vertices, referenced until Flush()
+	/// \param[in] count Number of vertices
+	/// \param[in] color Fill color
+	///
+	/// \returns Reference to self
+	///
+	/// \see Surface::FillPolygon
+	///
+	////////////////////////////////////////////////////////////
+	TiledRasterizer& FillPolygon(const Point* points, int count, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Record copying a surface into the target
+	///
+	/// Blend mode, alpha, color modulation and color key of the
+	/// source are applied, same as for Surface::Blit()
+	///
+	/// \param[in] source Source surface, referenced until Flush()
+	/// \param[in] srcrect Source rectangle, NullOpt for entire surface
+	/// \param[in] dstrect Destination rectangle, source is scaled if
+	///                    its size differs
+	///
+	/// \returns Reference to self
+	///
+	////////////////////////////////////////////////////////////
+	TiledRasterizer& Copy(Surface& source, const Optional<Rect>& srcrect, const Rect& dstrect);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Rasterize all recorded commands
+	///
+	/// Blocks until all tiles are done, and clears recorded commands
+	///
+	/// \throws SDL2pp::Exception
+	///
+	////////////////////////////////////////////////////////////
+	void Flush();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of recorded commands
+	///
+	/// \returns Number of commands recorded since last Flush()
+	///
+	////////////////////////////////////////////////////////////
+	size_t GetNumCommands() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of tiles
+	///
+	/// \returns Total number of tiles target is split into
+	///
+	////////////////////////////////////////////////////////////
+	int GetNumTiles() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of rasterizing threads
+	///
+	/// \returns Number of threads including the calling one
+	///
+	////////////////////////////////////////////////////////////
+	int GetNumThreads() const;
+};
+
+}
+
+#endif
@@ -0,0 +1,134 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <SDL2pp/VertexBuffer.hh>
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+namespace SDL2pp {
+
+VertexBuffer::VertexBuffer() {
+}
+
+void VertexBuffer::Clear() {
+	vertices_.clear();
+	indices_.clear();
+}
+
+void VertexBuffer::Reserve(size_t num_vertices, size_t num_indices) {
+	vertices_.reserve(num_vertices);
+	indices_.reserve(num_indices);
+}
+
+bool VertexBuffer::IsEmpty() const {
+	return indices_.empty();
+}
+
+size_t VertexBuffer::GetNumVertices() const {
+	return vertices_.size();
+}
+
+size_t VertexBuffer::GetNumIndices() const {
+	return indices_.size();
+}
+
+const SDL_Vertex* VertexBuffer::GetVertices() const {
+	return vertices_.data();
+}
+
+const int* VertexBuffer::GetIndices() const {
+	return indices_.data();
+}
+
+SDL_Vertex* VertexBuffer::AllocVertices(size_t count) {
+	size_t first = vertices_.size();
+	vertices_.resize(first + count);
+	return vertices_.data() + first;
+}
+
+int* VertexBuffer::AllocIndices(size_t count) {
+	size_t first = indices_.size();
+	indices_.resize(first + count);
+	return indices_.data() + first;
+}
+
+int VertexBuffer::AddVertex(const FPoint& position, const Color& color, const FPoint& tex_coord) {
+	vertices_.push_back(SDL_Vertex{ position, color, tex_coord });
+	return static_cast<int>(vertices_.size() - 1);
+}
+
+void VertexBuffer::AddTriangle(int a, int b, int c) {
+	int* indices = AllocIndices(3);
+	indices[0] = a;
+	indices[1] = b;
+	indices[2] = c;
+}
+
+void VertexBuffer::AddTriangle(const FPoint& a, const FPoint& b, const FPoint& c, const Color& color) {
+	const int first = static_cast<int>(vertices_.size());
+
+	SDL_Vertex* vertices = AllocVertices(3);
+	vertices[0] = SDL_Vertex{ a, color, { 0.0f, 0.0f } };
+	vertices[1] = SDL_Vertex{ b, color, { 0.0f, 0.0f } };
+	vertices[2] = SDL_Vertex{ c, color, { 0.0f, 0.0f } };
+
+	AddTriangle(first, first + 1, first + 2);
+}
+
+void VertexBuffer::AddQuad(const FRect& dstrect, const Color& color) {
+	AddQuad(dstrect, FRect(0.0f, 0.0f, 0.0f, 0.0f), color);
+}
+
+void VertexBuffer::AddQuad(const Rect& dstrect, const Color& color) {
+	AddQuad(FRect(dstrect), color);
+}
+
+void VertexBuffer::AddQuad(const FRect& dstrect, const FRect& uvrect, const Color& color) {
+	const int first = static_cast<int>(vertices_.size());
+
+	SDL_Vertex* vertices = AllocVertices(4);
+	vertices[0] = SDL_Vertex{ { dstrect.x, dstrect.y }, color, { uvrect.x, uvrect.y } };
+	vertices[1] = SDL_Vertex{ { dstrect.GetX2(), dstrect.y }, color, { uvrect.GetX2(), uvrect.y } };
+	vertices[2] = SDL_Vertex{ { dstrect.GetX2(), dstrect.GetY2() }, color, { uvrect.GetX2(), uvrect.GetY2() } };
+	vertices[3] = SDL_Vertex{ { dstrect.x, dstrect.GetY2() }, color, { uvrect.x, uvrect.GetY2() } };
+
+	int* indices = AllocIndices(6);
+	indices[0] = first;
+	indices[1] = first + 1;
+	indices[2] = first + 2;
+	indices[3] = first + 2;
+	indices[4] = first + 3;
+	indices[5] = first;
+}
+
+void VertexBuffer::AddQuad(const FRect& dstrect, const Rect& srcrect, const Point& texture_size, const Color& color) {
+	const float sx = 1.0f / static_cast<float>(texture_size.x);
+	const float sy = 1.0f / static_cast<float>(texture_size.y);
+	AddQuad(dstrect, FRect(srcrect.x * sx, srcrect.y * sy, srcrect.w * sx, srcrect.h * sy), color);
+}
+
+void VertexBuffer::AddQuad(const Rect& dstrect, const Rect& srcrect, const Point& texture_size, const Color& color) {
+	AddQuad(FRect(dstrect), srcrect, texture_size, color);
+}
+
+}
+
+#endif
@@ -0,0 +1,254 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_VERTEXBUFFER_HH
+#define SDL2PP_VERTEXBUFFER_HH
+
+#include <cstddef>
+#include <vector>
+
+#include <SDL_version.h>
+#include <SDL_render.h>
+
+#include <SDL2pp/Color.hh>
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/FPoint.hh>
+#include <SDL2pp/FRect.hh>
+#include <SDL2pp/Export.hh>
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+namespace SDL2pp {
+
+////////////////////////////////////////////////////////////
+/// \brief Growable buffer of vertices and indices for Renderer::Geometry()
+///
+/// \ingroup rendering
+///
+/// \headerfile SDL2pp/VertexBuffer.hh
+///
+/// Collects triangles and quads in the SDL_Vertex layout
+/// SDL_RenderGeometry() expects, so many textured or colored
+/// primitives may be drawn with a single call, and the buffer
+/// is submitted without any copying.
+///
+/// Clear() keeps allocated memory, so a buffer reused across
+/// frames works as an arena and stops allocating once it has
+/// grown to the largest frame size.
+///
+/// Usage example:
+/// \code
+/// {
+///     SDL2pp::VertexBuffer buffer;
+///
+///     while (running) {
+///         buffer.Clear();
+///         for (auto& sprite : sprites)
+///             buffer.AddQuad(sprite.GetRect(), sprite.GetFrameRect(), atlas.GetSize(), sprite.GetTint());
+///
+///         renderer.Geometry(&atlas, buffer);
+///     }
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////
+class SDL2PP_EXPORT VertexBuffer {
+private:
+	std::vector<SDL_Vertex> vertices_;  ///< Vertex data
+	std::vector<int> indices_;          ///< Triangle vertex indices
+
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Construct empty buffer
+	///
+	////////////////////////////////////////////////////////////
+	VertexBuffer();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Remove all vertices and indices, keeping allocated memory
+	///
+	////////////////////////////////////////////////////////////
+	void Clear();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Preallocate memory
+	///
+	/// \param[in] num_vertices Number of vertices to reserve room for
+	/// \param[in] num_indices Number of indices to reserve room for
+	///
+	////////////////////////////////////////////////////////////
+	void Reserve(size_t num_vertices, size_t num_indices);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check whether buffer has no triangles
+	///
+	/// \returns True if there are no indices in the buffer
+	///
+	////////////////////////////////////////////////////////////
+	bool IsEmpty() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of vertices
+	///
+	/// \returns Number of vertices in the buffer
+	///
+	////////////////////////////////////////////////////////////
+	size_t GetNumVertices() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get number of indices
+	///
+	/// \returns Number of indices in the buffer, three per triangle
+	///
+	////////////////////////////////////////////////////////////
+	size_t GetNumIndices() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get vertex data
+	///
+	/// \returns Pointer to GetNumVertices() vertices
+	///
+	////////////////////////////////////////////////////////////
+	const SDL_Vertex* GetVertices() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get index data
+	///
+	/// \returns Pointer to GetNumIndices() indices
+	///
+	////////////////////////////////////////////////////////////
+	const int* GetIndices() const;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append uninitialized vertices
+	///
+	/// Allows filling vertex data directly, for instance from
+	/// a tight loop
+	///
+	/// \param[in] count Number of vertices to append
+	///
+	/// \returns Pointer to the first appended vertex, valid
+	///          until buffer is modified
+	///
+	////////////////////////////////////////////////////////////
+	SDL_Vertex* AllocVertices(size_t count);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append uninitialized indices
+	///
+	/// \param[in] count Number of indices to append
+	///
+	/// \returns Pointer to the first appended index, valid
+	///          until buffer is modified
+	///
+	////////////////////////////////////////////////////////////
+	int* AllocIndices(size_t count);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append a vertex
+	///
+	/// \param[in] position Vertex position in rendering target
+	/// \param[in] color Vertex color
+	/// \param[in] tex_coord Normalized texture coordinates
+	///
+	/// \returns Index of added vertex
+	///
+	////////////////////////////////////////////////////////////
+	int AddVertex(const FPoint& position, const Color& color, const FPoint& tex_coord = FPoint());
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append a triangle made of existing vertices
+	///
+	/// \param[in] a Index of first vertex
+	/// \param[in] b Index of second vertex
+	/// \param[in] c Index of third vertex
+	///
+	////////////////////////////////////////////////////////////
+	void AddTriangle(int a, int b, int c);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append a plain colored triangle
+	///
+	/// \param[in] a First vertex position
+	/// \param[in] b Second vertex position
+	/// \param[in] c Third vertex position
+	/// \param[in] color Triangle color
+	///
+	////////////////////////////////////////////////////////////
+	void AddTriangle(const FPoint& a, const FPoint& b, const FPoint& c, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append a plain colored quad
+	///
+	/// \param[in] dstrect Quad rectangle
+	/// \param[in] color Quad color
+	///
+	////////////////////////////////////////////////////////////
+	void AddQuad(const FRect& dstrect, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append a plain colored quad
+	///
+	/// \param[in] dstrect Quad rectangle
+	/// \param[in] color Quad color
+	///
+	////////////////////////////////////////////////////////////
+	void AddQuad(const Rect& dstrect, const Color& color);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append a textured quad
+	///
+	/// \param[in] dstrect Quad rectangle
+	/// \param[in] uvrect Normalized texture coordinates of the quad
+	/// \param[in] color Color to modulate texture with
+	///
+	////////////////////////////////////////////////////////////
+	void AddQuad(const FRect& dstrect, const FRect& uvrect, const Color& color = Color(255, 255, 255));
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append a textured quad
+	///
+	/// \param[in] dstrect Quad rectangle
+	/// \param[in] srcrect Source rectangle in texture pixels
+	/// \param[in] texture_size Size of the texture in pixels
+	/// \param[in] color Color to modulate texture with
+	///
+	////////////////////////////////////////////////////////////
+	void AddQuad(const FRect& dstrect, const Rect& srcrect, const Point& texture_size, const Color& color = Color(255, 255, 255));
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append a textured quad
+	///
+	/// \param[in] dstrect Quad rectangle
+	/// \param[in] srcrect Source rectangle in texture pixels
+	/// \param[in] texture_size Size of the texture in pixels
+	/// \param[in] color Color to modulate texture with
+	///
+	////////////////////////////////////////////////////////////
+	void AddQuad(const Rect& dstrect, const Rect& srcrect, const Point& texture_size, const Color& color = Color(255, 255, 255));
+};
+
+}
+
+#endif
+
+#endif
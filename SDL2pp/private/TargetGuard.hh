@@ -0,0 +1,88 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_PRIVATE_TARGETGUARD_HH
+#define SDL2PP_PRIVATE_TARGETGUARD_HH
+
+#include <SDL_render.h>
+
+#include <SDL2pp/Optional.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Renderer.hh>
+
+// Internal helpers shared by library sources; not installed
+
+namespace SDL2pp {
+
+namespace Private {
+
+////////////////////////////////////////////////////////////
+/// \brief Restores rendering target and related state on scope exit
+///
+/// Saves rendering target, viewport, clip rect, scale and draw
+/// color of the renderer, and restores them when destroyed,
+/// including on exceptions. Switching targets resets viewport,
+/// clip rect and scale; SDL restores them itself when switching
+/// back to the window, but not for texture targets.
+///
+/// Errors while restoring are ignored, as they can't be reported
+/// from destructor.
+///
+////////////////////////////////////////////////////////////
+class TargetGuard {
+private:
+	SDL_Renderer* renderer_;
+	SDL_Texture* target_;
+	SDL_Rect viewport_;
+	Optional<Rect> clip_rect_;
+	float scale_x_, scale_y_;
+	Uint8 r_, g_, b_, a_;
+
+public:
+	explicit TargetGuard(Renderer& renderer)
+		: renderer_(renderer.Get()),
+		  target_(SDL_GetRenderTarget(renderer.Get())),
+		  clip_rect_(renderer.GetClipRect()) {
+		SDL_RenderGetViewport(renderer_, &viewport_);
+		SDL_RenderGetScale(renderer_, &scale_x_, &scale_y_);
+		SDL_GetRenderDrawColor(renderer_, &r_, &g_, &b_, &a_);
+	}
+
+	~TargetGuard() {
+		SDL_SetRenderTarget(renderer_, target_);
+		if (target_ != nullptr) {
+			// viewport is in scaled coordinates, so scale goes first
+			SDL_RenderSetScale(renderer_, scale_x_, scale_y_);
+			SDL_RenderSetViewport(renderer_, &viewport_);
+		}
+		SDL_RenderSetClipRect(renderer_, clip_rect_ ? &*clip_rect_ : nullptr);
+		SDL_SetRenderDrawColor(renderer_, r_, g_, b_, a_);
+	}
+
+	TargetGuard(const TargetGuard&) = delete;
+	TargetGuard& operator=(const TargetGuard&) = delete;
+};
+
+}
+
+}
+
+#endif
@@ -0,0 +1,79 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_PRIVATE_UTF8_HH
+#define SDL2PP_PRIVATE_UTF8_HH
+
+#include <SDL_stdinc.h>
+
+// Internal helpers shared by library sources; not installed
+
+namespace SDL2pp {
+
+namespace Private {
+
+////////////////////////////////////////////////////////////
+/// \brief Decode next UTF-8 code point
+///
+/// \param[in,out] text Pointer to next byte, advanced past decoded sequence
+/// \param[in] end Pointer past the last byte of text
+///
+/// \returns Decoded code point, U+FFFD for invalid sequence or 0
+///          at the end of text
+///
+////////////////////////////////////////////////////////////
+inline Uint32 NextUTF8(const char*& text, const char* end) {
+	if (text == end)
+		return 0;
+
+	const Uint8 lead = static_cast<Uint8>(*text++);
+	if (lead < 0x80)
+		return lead;
+
+	int length;
+	Uint32 ch;
+	if ((lead & 0xe0) == 0xc0) {
+		length = 1;
+		ch = lead & 0x1f;
+	} else if ((lead & 0xf0) == 0xe0) {
+		length = 2;
+		ch = lead & 0x0f;
+	} else if ((lead & 0xf8) == 0xf0) {
+		length = 3;
+		ch = lead & 0x07;
+	} else {
+		return 0xfffd;
+	}
+
+	for (int i = 0; i < length; i++) {
+		if (text == end || (static_cast<Uint8>(*text) & 0xc0) != 0x80)
+			return 0xfffd;
+		ch = (ch << 6) | (static_cast<Uint8>(*text++) & 0x3f);
+	}
+
+	return ch;
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,141 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL2PP_BENCHMARKS_BENCHMARK_HH
+#define SDL2PP_BENCHMARKS_BENCHMARK_HH
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <SDL_timer.h>
+
+// Runs benchmark functions until they take at least given
+// time and collects per iteration timings
+class BenchmarkRunner {
+private:
+	struct Result {
+		std::string name;
+		unsigned long iterations;
+		double seconds;
+		double items_per_iteration;
+	};
+
+private:
+	std::vector<Result> results_;
+	std::string group_;
+	std::string filter_;
+	double min_time_;
+
+private:
+	// JSON has no inf or nan, so non-finite values are written as null
+	static void WriteNumber(std::ostream& stream, double value) {
+		if (std::isfinite(value))
+			stream << value;
+		else
+			stream << "null";
+	}
+
+public:
+	BenchmarkRunner(const std::string& filter, double min_time) : filter_(filter), min_time_(min_time) {
+	}
+
+	void SetGroup(const std::string& group) {
+		group_ = group;
+	}
+
+	bool Enabled(const std::string& name) const {
+		return filter_.empty() || (group_ + "/" + name).find(filter_) != std::string::npos;
+	}
+
+	// func is called repeatedly; items_per_iteration is the number
+	// of processed items (points, bytes, ...) per call, used for
+	// throughput reporting
+	template <class F>
+	void Run(const std::string& name, double items_per_iteration, F func) {
+		if (!Enabled(name))
+			return;
+
+		const double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+
+		// warm up caches and lazy initialization
+		func();
+
+		unsigned long iterations = 1;
+		while (true) {
+			Uint64 start = SDL_GetPerformanceCounter();
+			for (unsigned long i = 0; i < iterations; i++)
+				func();
+			double elapsed = static_cast<double>(SDL_GetPerformanceCounter() - start) / frequency;
+
+			// zero elapsed time, possible with coarse timers or zero
+			// min_time, gives no usable rate, so keep growing then
+			if ((elapsed >= min_time_ && elapsed > 0.0) || iterations >= 1000000000UL) {
+				results_.push_back(Result{group_ + "/" + name, iterations, elapsed, items_per_iteration});
+				break;
+			}
+
+			// aim slightly above target time, but grow at most 10x
+			// per step as first measurements are noisy
+			double estimate = elapsed > 0.0 ? static_cast<double>(iterations) * min_time_ * 1.2 / elapsed : static_cast<double>(iterations) * 10.0;
+			iterations = static_cast<unsigned long>(std::min(std::max(estimate, static_cast<double>(iterations) * 2.0), static_cast<double>(iterations) * 10.0));
+		}
+	}
+
+	template <class F>
+	void Run(const std::string& name, F func) {
+		Run(name, 1.0, func);
+	}
+
+	void WriteJSON(std::ostream& stream, const std::vector<std::pair<std::string, std::string>>& context) const {
+		stream << "{\n\t\"context\": {";
+		for (size_t i = 0; i < context.size(); i++)
+			stream << (i ? ", " : "") << "\"" << context[i].first << "\": \"" << context[i].second << "\"";
+		stream << "},\n\t\"benchmarks\": [";
+
+		for (size_t i = 0; i < results_.size(); i++) {
+			const Result& result = results_[i];
+			stream << (i ? "," : "") << "\n\t\t{"
+				<< "\"name\": \"" << result.name << "\", "
+				<< "\"iterations\": " << result.iterations << ", "
+				<< "\"seconds\": " << result.seconds << ", "
+				<< "\"ns_per_iteration\": ";
+			WriteNumber(stream, result.seconds * 1e9 / static_cast<double>(result.iterations));
+			stream << ", \"items_per_second\": ";
+			WriteNumber(stream, result.items_per_iteration * static_cast<double>(result.iterations) / result.seconds);
+			stream << "}";
+		}
+
+		stream << "\n\t]\n}\n";
+	}
+};
+
+void RunRenderingBenchmarks(BenchmarkRunner& runner);
+void RunSurfaceBenchmarks(BenchmarkRunner& runner);
+void RunRWopsBenchmarks(BenchmarkRunner& runner);
+void RunGeometryBenchmarks(BenchmarkRunner& runner);
+void RunErrorBenchmarks(BenchmarkRunner& runner);
+void RunFontBenchmarks(BenchmarkRunner& runner);
+void RunMixerBenchmarks(BenchmarkRunner& runner);
+
+#endif
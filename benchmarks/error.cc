@@ -0,0 +1,124 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <stdexcept>
+#include <string>
+
+#include <SDL_error.h>
+
+#include <SDL2pp/Exception.hh>
+#include <SDL2pp/Result.hh>
+
+#include "benchmark.hh"
+
+using namespace SDL2pp;
+
+namespace {
+
+// Copy of eager Exception implementation from before it was made
+// allocation free, kept to compare throw/catch cost against
+class EagerException : public std::runtime_error {
+private:
+	std::string sdl_function_;
+	std::string sdl_error_;
+
+private:
+	static std::string make_what(const char* function, const char* sdl_error) {
+		std::string tmp(function);
+		tmp += " failed: ";
+		tmp += sdl_error;
+		return tmp;
+	}
+
+public:
+	explicit EagerException(const char* function)
+		: std::runtime_error(make_what(function, SDL_GetError())),
+		  sdl_function_(function),
+		  sdl_error_(SDL_GetError()) {
+	}
+
+	std::string GetSDLError() const {
+		return sdl_error_;
+	}
+};
+
+// not inlined, so throw is not optimized against catch site
+template <class E>
+[[gnu::noinline]] void Fail() {
+	throw E("SDL_BenchmarkFunction");
+}
+
+[[gnu::noinline]] Result TryFail() {
+	return Result("SDL_BenchmarkFunction", -1);
+}
+
+}
+
+void RunErrorBenchmarks(BenchmarkRunner& runner) {
+	runner.SetGroup("error");
+
+	// realistic length of SDL error message
+	SDL_SetError("Texture is not currently available for rendering");
+
+	size_t sink = 0;
+
+	runner.Run("ThrowCatch/Eager", [&]() {
+			try {
+				Fail<EagerException>();
+			} catch (std::runtime_error&) {
+				sink++;
+			}
+		});
+
+	runner.Run("ThrowCatch/Exception", [&]() {
+			try {
+				Fail<Exception>();
+			} catch (std::runtime_error&) {
+				sink++;
+			}
+		});
+
+	runner.Run("ThrowCatchWhat/Eager", [&]() {
+			try {
+				Fail<EagerException>();
+			} catch (std::runtime_error& e) {
+				sink += e.what()[0];
+			}
+		});
+
+	runner.Run("ThrowCatchWhat/Exception", [&]() {
+			try {
+				Fail<Exception>();
+			} catch (std::runtime_error& e) {
+				sink += e.what()[0];
+			}
+		});
+
+	runner.Run("TryResult", [&]() {
+			Result result = TryFail();
+			if (!result)
+				sink += result.GetSDLError()[0];
+		});
+
+	// keep results observable, so what() calls are not optimized out
+	if (sink == 0)
+		SDL_ClearError();
+}
@@ -0,0 +1,91 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <string>
+
+#include <SDL2pp/SDLTTF.hh>
+#include <SDL2pp/Font.hh>
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/SurfacePool.hh>
+#include <SDL2pp/TextLayout.hh>
+
+#include "benchmark.hh"
+
+using namespace SDL2pp;
+
+void RunFontBenchmarks(BenchmarkRunner& runner) {
+	runner.SetGroup("font");
+
+	SDLTTF ttf;
+	Font font(TESTDATA_DIR "/Vera.ttf", 20);
+
+	const std::string text = "The quick brown fox jumps over the lazy dog";
+	const double glyphs = static_cast<double>(text.size());
+
+	runner.Run("RenderUTF8_Solid", glyphs, [&]() {
+			font.RenderUTF8_Solid(text, SDL_Color{255, 255, 255, 255});
+		});
+
+	runner.Run("RenderUTF8_Shaded", glyphs, [&]() {
+			font.RenderUTF8_Shaded(text, SDL_Color{255, 255, 255, 255}, SDL_Color{0, 0, 0, 255});
+		});
+
+	runner.Run("RenderUTF8_Blended", glyphs, [&]() {
+			font.RenderUTF8_Blended(text, SDL_Color{255, 255, 255, 255});
+		});
+
+	Surface target(0, 640, 40, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+	runner.Run("RenderUTF8_Blended/into", glyphs, [&]() {
+			font.RenderUTF8_Blended(text, SDL_Color{255, 255, 255, 255}, target, Point(0, 0));
+		});
+
+	SurfacePool pool;
+	runner.Run("RenderUTF8_Blended/pooled", glyphs, [&]() {
+			font.RenderUTF8_Blended(text, SDL_Color{255, 255, 255, 255}, pool);
+		});
+
+	runner.Run("GetSizeUTF8", glyphs, [&]() {
+			font.GetSizeUTF8(text);
+		});
+
+	runner.Run("GetGlyphAdvance", glyphs, [&]() {
+			int width = 0;
+			for (char ch : text)
+				width += font.GetGlyphAdvance(static_cast<Uint8>(ch));
+			(void)width;
+		});
+
+	runner.Run("TextLayout", glyphs, [&]() {
+			TextLayout(font, text, 200);
+		});
+
+	// appending to a long log only lays out the appended line,
+	// and removing it only drops it
+	std::string history;
+	for (int i = 0; i < 1000; i++)
+		history += text + "\n";
+
+	TextLayout log(font, history, 200);
+	runner.Run("TextLayout/Append", glyphs, [&]() {
+			log.Append(text);
+			log.SetText(history);
+		});
+}
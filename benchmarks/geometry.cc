@@ -0,0 +1,148 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <vector>
+
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/RectArray.hh>
+#include <SDL2pp/SpatialGrid.hh>
+
+#include "benchmark.hh"
+
+using namespace SDL2pp;
+
+namespace {
+
+// deterministic hash based pseudo-random numbers, so results of
+// branchy scalar code are not skewed by predictable patterns
+int Random(size_t seed) {
+	Uint32 hash = static_cast<Uint32>(seed) * 2654435761U;
+	hash ^= hash >> 13;
+	hash *= 0x5bd1e995U;
+	hash ^= hash >> 15;
+	return static_cast<int>(hash & 0x7fffffff);
+}
+
+}
+
+void RunGeometryBenchmarks(BenchmarkRunner& runner) {
+	runner.SetGroup("geometry");
+
+	// sprites randomly scattered over area 4x larger than the
+	// viewport, so about a quarter of them is visible
+	const Rect viewport(0, 0, 1280, 720);
+	const size_t count = 100000;
+
+	std::vector<Rect> rects;
+	rects.reserve(count);
+	for (size_t i = 0; i < count; i++)
+		rects.emplace_back(Random(i) % 2560 - 640, Random(i + count) % 1440 - 360, 32, 32);
+
+	std::vector<size_t> indices(count);
+	std::vector<Uint64> mask((count + 63) / 64);
+	const double items = static_cast<double>(count);
+
+	runner.Run("Cull/Intersects/100k", items, [&]() {
+			size_t found = 0;
+			for (size_t i = 0; i < count; i++)
+				if (viewport.Intersects(rects[i]))
+					indices[found++] = i;
+		});
+
+	runner.Run("Cull/FindIntersecting/100k", items, [&]() {
+			viewport.FindIntersecting(rects.data(), count, indices.data());
+		});
+
+	runner.Run("Cull/GetIntersectsMask/100k", items, [&]() {
+			viewport.GetIntersectsMask(rects.data(), count, mask.data());
+		});
+
+	RectArray array;
+	runner.Run("Cull/RectArray/100k", items, [&]() {
+			// includes refilling the array, as Cull is destructive
+			array.Clear();
+			for (const Rect& rect : rects)
+				array.Add(rect);
+			array.Cull(viewport);
+		});
+
+	std::vector<Point> lines;
+	lines.reserve(count * 2);
+	for (size_t i = 0; i < count; i++) {
+		lines.emplace_back(Random(i) % 2560 - 640, Random(i + count) % 1440 - 360);
+		lines.emplace_back(Random(i + count * 2) % 2560 - 640, Random(i + count * 3) % 1440 - 360);
+	}
+	std::vector<Point> clipped(lines.size());
+
+	runner.Run("IntersectLine/100k", items, [&]() {
+			clipped = lines;
+			for (size_t i = 0; i < count; i++)
+				viewport.IntersectLine(clipped[i * 2], clipped[i * 2 + 1]);
+		});
+
+	runner.Run("IntersectLines/100k", items, [&]() {
+			clipped = lines;
+			viewport.IntersectLines(clipped.data(), count, mask.data());
+		});
+
+	// objects spread over large world, of which a small
+	// part is visible or under the cursor
+	std::vector<Rect> world;
+	world.reserve(count);
+	for (size_t i = 0; i < count; i++)
+		world.emplace_back(Random(i) % 20000, Random(i + count) % 20000, 16 + Random(i + count * 2) % 64, 16 + Random(i + count * 3) % 64);
+
+	SpatialGrid grid(64);
+	for (const Rect& rect : world)
+		grid.Insert(rect);
+
+	std::vector<size_t> found;
+	found.reserve(count);
+
+	runner.Run("QueryRect/Scan/100k", [&]() {
+			viewport.FindIntersecting(world.data(), count, indices.data());
+		});
+
+	runner.Run("QueryRect/SpatialGrid/100k", [&]() {
+			found.clear();
+			grid.Query(viewport, found);
+		});
+
+	const Point cursor(640, 360);
+	runner.Run("QueryPoint/Scan/100k", [&]() {
+			found.clear();
+			for (size_t i = 0; i < count; i++)
+				if (world[i].Contains(cursor))
+					found.push_back(i);
+		});
+
+	runner.Run("QueryPoint/SpatialGrid/100k", [&]() {
+			found.clear();
+			grid.Query(cursor, found);
+		});
+
+	size_t moved = 0;
+	runner.Run("Move/SpatialGrid", [&]() {
+			size_t id = moved++ % count;
+			grid.Move(id, world[id] + Point(static_cast<int>(moved % 3) - 1, 1));
+		});
+}
@@ -0,0 +1,98 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include <SDL.h>
+
+#include <SDL2pp/Config.hh>
+#include <SDL2pp/SDL.hh>
+
+#include "benchmark.hh"
+
+static void Usage(const char* progname) {
+	std::cerr << "Usage: " << progname << " [-o output.json] [-f filter] [-t min_time]" << std::endl;
+}
+
+int main(int argc, char* argv[]) try {
+	const char* output = nullptr;
+	std::string filter;
+	double min_time = 0.5;
+
+	for (int i = 1; i < argc; i++) {
+		if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+			output = argv[++i];
+		} else if (std::strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+			filter = argv[++i];
+		} else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			min_time = std::atof(argv[++i]);
+		} else {
+			Usage(argv[0]);
+			return 1;
+		}
+	}
+
+	// run headless unless user explicitly asks otherwise
+	SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+	SDL_setenv("SDL_AUDIODRIVER", "dummy", 0);
+
+	SDL2pp::SDL sdl(SDL_INIT_VIDEO | SDL_INIT_AUDIO);
+
+	BenchmarkRunner runner(filter, min_time);
+
+	RunRenderingBenchmarks(runner);
+	RunGeometryBenchmarks(runner);
+	RunSurfaceBenchmarks(runner);
+	RunRWopsBenchmarks(runner);
+	RunErrorBenchmarks(runner);
+#ifdef SDL2PP_WITH_TTF
+	RunFontBenchmarks(runner);
+#endif
+#ifdef SDL2PP_WITH_MIXER
+	RunMixerBenchmarks(runner);
+#endif
+
+	SDL_version version;
+	SDL_GetVersion(&version);
+
+	std::vector<std::pair<std::string, std::string>> context = {
+		{ "sdl2pp_version", SDL2PP_VERSION },
+		{ "sdl_version", std::to_string(version.major) + "." + std::to_string(version.minor) + "." + std::to_string(version.patch) },
+		{ "video_driver", SDL_getenv("SDL_VIDEODRIVER") },
+		{ "audio_driver", SDL_getenv("SDL_AUDIODRIVER") },
+		{ "min_time", std::to_string(min_time) },
+	};
+
+	if (output) {
+		std::ofstream stream(output);
+		runner.WriteJSON(stream, context);
+	} else {
+		runner.WriteJSON(std::cout, context);
+	}
+
+	return 0;
+} catch (std::exception& e) {
+	std::cerr << "Error: " << e.what() << std::endl;
+	return 1;
+}
@@ -0,0 +1,60 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <SDL_mixer.h>
+
+#include <SDL2pp/Mixer.hh>
+#include <SDL2pp/Chunk.hh>
+
+#include "benchmark.hh"
+
+using namespace SDL2pp;
+
+void RunMixerBenchmarks(BenchmarkRunner& runner) {
+	runner.SetGroup("mixer");
+
+	Mixer mixer(MIX_DEFAULT_FREQUENCY, MIX_DEFAULT_FORMAT, MIX_DEFAULT_CHANNELS, 4096);
+	Chunk chunk(TESTDATA_DIR "/test.wav");
+
+	// these measure command overhead, which is dominated by
+	// audio device locking in SDL_mixer
+
+	runner.Run("PlayChannel+HaltChannel", [&]() {
+			int channel = mixer.PlayChannel(-1, chunk);
+			mixer.HaltChannel(channel);
+		});
+
+	runner.Run("SetVolume/all", [&]() {
+			mixer.SetVolume(-1, MIX_MAX_VOLUME / 2);
+		});
+
+	int channel = mixer.PlayChannel(-1, chunk, -1);
+
+	runner.Run("SetPanning", [&]() {
+			mixer.SetPanning(channel, 128, 255);
+		});
+
+	runner.Run("IsChannelPlaying", [&]() {
+			mixer.IsChannelPlaying(channel);
+		});
+
+	mixer.HaltChannel();
+}
@@ -0,0 +1,164 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <vector>
+
+#include <SDL.h>
+
+#include <SDL2pp/Window.hh>
+#include <SDL2pp/Renderer.hh>
+#include <SDL2pp/Texture.hh>
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/PointArray.hh>
+#include <SDL2pp/RectArray.hh>
+#include <SDL2pp/TileMap.hh>
+#include <SDL2pp/ParticleSystem.hh>
+#include <SDL2pp/VertexBuffer.hh>
+#include <SDL2pp/Color.hh>
+
+#include "benchmark.hh"
+
+using namespace SDL2pp;
+
+void RunRenderingBenchmarks(BenchmarkRunner& runner) {
+	runner.SetGroup("rendering");
+
+	Window window("libSDL2pp benchmark", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 640, 480, 0);
+	Renderer renderer(window, -1, SDL_RENDERER_SOFTWARE);
+
+	Surface sprite_surface(0, 64, 64, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+	sprite_surface.FillRect(Rect(0, 0, 64, 64), 0x80ff8000);
+	sprite_surface.FillRect(Rect(16, 16, 32, 32), 0xff0080ff);
+
+	Texture sprite(renderer, sprite_surface);
+
+	sprite.SetBlendMode(SDL_BLENDMODE_NONE);
+	runner.Run("Copy/64x64/opaque", [&]() {
+			renderer.Copy(sprite, NullOpt, Point(100, 100));
+		});
+
+	sprite.SetBlendMode(SDL_BLENDMODE_BLEND);
+	runner.Run("Copy/64x64/blend", [&]() {
+			renderer.Copy(sprite, NullOpt, Point(100, 100));
+		});
+
+	runner.Run("Copy/64x64/scaled_2x", [&]() {
+			renderer.Copy(sprite, NullOpt, Rect(100, 100, 128, 128));
+		});
+
+	runner.Run("Copy/64x64/rotated", [&]() {
+			renderer.Copy(sprite, NullOpt, Point(100, 100), 30.0);
+		});
+
+	sprite.SetBlendMode(SDL_BLENDMODE_NONE);
+	runner.Run("FillCopy/640x480", [&]() {
+			renderer.FillCopy(sprite);
+		});
+
+	std::vector<Point> points;
+	for (int i = 0; i < 1000; i++)
+		points.emplace_back(i * 7 % 640, i * 13 % 480);
+
+	runner.Run("DrawPoints/1000", static_cast<double>(points.size()), [&]() {
+			renderer.DrawPoints(points.data(), static_cast<int>(points.size()));
+		});
+
+	PointArray point_array(points.data(), points.size());
+	runner.Run("DrawPoints/PointArray/1000", static_cast<double>(point_array.GetSize()), [&]() {
+			renderer.DrawPoints(point_array);
+		});
+
+	std::vector<Rect> rects;
+	for (int i = 0; i < 100; i++)
+		rects.emplace_back(i * 7 % 600, i * 13 % 440, 32, 32);
+
+	runner.Run("FillRects/100x32x32", static_cast<double>(rects.size()), [&]() {
+			renderer.FillRects(rects.data(), static_cast<int>(rects.size()));
+		});
+
+	RectArray rect_array(rects.data(), rects.size());
+	runner.Run("FillRects/RectArray/100x32x32", static_cast<double>(rect_array.GetSize()), [&]() {
+			renderer.FillRects(rect_array);
+		});
+
+	// 640x480 view of 16x16 tiles is 40x30 tiles
+	sprite.SetBlendMode(SDL_BLENDMODE_BLEND);
+	runner.Run("Tiles/PerTileCopy/640x480", 40.0 * 30.0, [&]() {
+			for (int y = 0; y < 30; y++)
+				for (int x = 0; x < 40; x++)
+					renderer.Copy(sprite, Rect((x + y) % 4 * 16, 0, 16, 16), Point(x * 16, y * 16));
+		});
+
+	TileMap tile_map(renderer, sprite, Point(16, 16), Point(4096, 4096));
+	for (int y = 0; y < 4096; y++)
+		for (int x = 0; x < 4096; x++)
+			tile_map.SetTile(x, y, (x + y) % 4);
+
+	runner.Run("Tiles/TileMap/640x480", 40.0 * 30.0, [&]() {
+			tile_map.Draw(Rect(0, 0, 640, 480));
+		});
+
+	ParticleSystem particles(10000);
+	particles.SetGravity(0.0f, 10.0f);
+	particles.SetParticleSize(8.0f);
+	for (int i = 0; i < 10000; i++)
+		particles.Emit(static_cast<float>(i * 7 % 640), static_cast<float>(i * 13 % 480), static_cast<float>(i % 11 - 5), static_cast<float>(i % 7 - 3), 1000.0f, Color(255, static_cast<Uint8>(i), 0));
+
+	runner.Run("Particles/Update/10000", static_cast<double>(particles.GetNumParticles()), [&]() {
+			particles.Update(0.001f);
+		});
+
+	const float* particle_x = particles.GetX();
+	const float* particle_y = particles.GetY();
+	runner.Run("Particles/PerParticleCopy/1000", 1000.0, [&]() {
+			for (int i = 0; i < 1000; i++) {
+				sprite.SetColorMod(255, static_cast<Uint8>(i), 0);
+				renderer.Copy(sprite, NullOpt, Rect(static_cast<int>(particle_x[i]) - 4, static_cast<int>(particle_y[i]) - 4, 8, 8));
+			}
+			sprite.SetColorMod();
+		});
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+	ParticleSystem draw_particles(1000);
+	draw_particles.SetParticleSize(8.0f);
+	for (int i = 0; i < 1000; i++)
+		draw_particles.Emit(particle_x[i], particle_y[i], 0.0f, 0.0f, 1000.0f, Color(255, static_cast<Uint8>(i), 0));
+
+	runner.Run("Particles/Draw/1000", 1000.0, [&]() {
+			draw_particles.Draw(renderer, &sprite);
+		});
+
+	VertexBuffer vertex_buffer;
+	runner.Run("Geometry/VertexBuffer/1000", 1000.0, [&]() {
+			vertex_buffer.Clear();
+			for (int i = 0; i < 1000; i++)
+				vertex_buffer.AddQuad(FRect(particle_x[i] - 4.0f, particle_y[i] - 4.0f, 8.0f, 8.0f), FRect(0.0f, 0.0f, 1.0f, 1.0f), Color(255, static_cast<Uint8>(i), 0));
+			renderer.Geometry(&sprite, vertex_buffer);
+		});
+#endif
+
+	runner.Run("Clear+Present", [&]() {
+			renderer.Clear();
+			renderer.Present();
+		});
+}
@@ -0,0 +1,115 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <SDL2pp/RWops.hh>
+#include <SDL2pp/ContainerRWops.hh>
+#include <SDL2pp/StreamRWops.hh>
+
+#include "benchmark.hh"
+
+using namespace SDL2pp;
+
+namespace {
+
+const size_t data_size = 1024 * 1024;
+const size_t block_size = 4096;
+
+// reads exactly data_size bytes; hitting EOF is avoided as
+// it sets failbit on std streams, breaking subsequent seeks
+void ReadAll(RWops& rwops, std::vector<char>& buffer) {
+	rwops.Seek(0, RW_SEEK_SET);
+	for (size_t i = 0; i < data_size / block_size; i++)
+		rwops.Read(buffer.data(), 1, buffer.size());
+}
+
+}
+
+void RunRWopsBenchmarks(BenchmarkRunner& runner) {
+	runner.SetGroup("rwops");
+
+	std::vector<char> data(data_size);
+	for (size_t i = 0; i < data.size(); i++)
+		data[i] = static_cast<char>(i * 31);
+
+	std::vector<char> buffer(block_size);
+	const double bytes = static_cast<double>(data_size);
+
+	{
+		RWops rwops = RWops::FromConstMem(data.data(), static_cast<int>(data.size()));
+		runner.Run("Read/FromConstMem/4K", bytes, [&]() {
+				ReadAll(rwops, buffer);
+			});
+	}
+
+	{
+		RWops rwops = RWops::FromMem(data.data(), static_cast<int>(data.size()));
+		runner.Run("Read/FromMem/4K", bytes, [&]() {
+				ReadAll(rwops, buffer);
+			});
+	}
+
+	{
+		RWops rwops((ContainerRWops<std::vector<char>>(data)));
+		runner.Run("Read/ContainerRWops/4K", bytes, [&]() {
+				ReadAll(rwops, buffer);
+			});
+	}
+
+	{
+		std::istringstream stream(std::string(data.begin(), data.end()));
+		RWops rwops((StreamRWops<std::istringstream>(stream)));
+		runner.Run("Read/StreamRWops/4K", bytes, [&]() {
+				ReadAll(rwops, buffer);
+			});
+	}
+
+	if (runner.Enabled("Read/FromFile/4K")) {
+		const char* path = "sdl2pp_benchmark_rwops.tmp";
+		{
+			RWops rwops = RWops::FromFile(path, "wb");
+			rwops.Write(data.data(), 1, data.size());
+		}
+
+		{
+			// mostly measures page cache and SDL stdio wrapper
+			RWops rwops = RWops::FromFile(path, "rb");
+			runner.Run("Read/FromFile/4K", bytes, [&]() {
+					ReadAll(rwops, buffer);
+				});
+		}
+
+		std::remove(path);
+	}
+
+	{
+		RWops rwops = RWops::FromConstMem(data.data(), static_cast<int>(data.size()));
+		runner.Run("ReadLE32/FromConstMem", bytes / 4.0, [&]() {
+				rwops.Seek(0, RW_SEEK_SET);
+				for (size_t i = 0; i < data_size / 4; i++)
+					rwops.ReadLE32();
+			});
+	}
+}
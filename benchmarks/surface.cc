@@ -0,0 +1,178 @@
+/*
+  libSDL2pp - C++ bindings/wrapper for SDL2
+  Copyright (C) 2026 Dmitry Marakasov <amdmi3@amdmi3.ru>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include <vector>
+
+#include <SDL.h>
+
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/SurfacePool.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Color.hh>
+#include <SDL2pp/PixelView.hh>
+#include <SDL2pp/TiledRasterizer.hh>
+
+#include "benchmark.hh"
+
+using namespace SDL2pp;
+
+void RunSurfaceBenchmarks(BenchmarkRunner& runner) {
+	runner.SetGroup("surface");
+
+	Surface source(0, 256, 256, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+	source.FillRect(NullOpt, 0x80ff8000);
+
+	const double pixels = 256.0 * 256.0;
+
+	runner.Run("Convert/ARGB8888-ABGR8888/256x256", pixels, [&]() {
+			source.Convert(SDL_PIXELFORMAT_ABGR8888);
+		});
+
+	runner.Run("Convert/ARGB8888-RGB24/256x256", pixels, [&]() {
+			source.Convert(SDL_PIXELFORMAT_RGB24);
+		});
+
+	runner.Run("Convert/ARGB8888-RGB565/256x256", pixels, [&]() {
+			source.Convert(SDL_PIXELFORMAT_RGB565);
+		});
+
+	SurfacePool pool;
+
+	runner.Run("Convert/ARGB8888-ABGR8888/256x256/pooled", pixels, [&]() {
+			pool.Convert(source, SDL_PIXELFORMAT_ABGR8888);
+		});
+
+	runner.Run("Convert/ARGB8888-RGB565/256x256/pooled", pixels, [&]() {
+			pool.Convert(source, SDL_PIXELFORMAT_RGB565);
+		});
+
+	Surface target(0, 512, 512, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+
+	source.SetBlendMode(SDL_BLENDMODE_NONE);
+	runner.Run("Blit/256x256/opaque", pixels, [&]() {
+			source.Blit(NullOpt, target, Rect(10, 10, 256, 256));
+		});
+
+	source.SetBlendMode(SDL_BLENDMODE_BLEND);
+	runner.Run("Blit/256x256/blend", pixels, [&]() {
+			source.Blit(NullOpt, target, Rect(10, 10, 256, 256));
+		});
+
+	Surface rgb_target(0, 512, 512, 24, 0x00ff0000, 0x0000ff00, 0x000000ff, 0);
+	runner.Run("Blit/256x256/blend_to_RGB24", pixels, [&]() {
+			source.Blit(NullOpt, rgb_target, Rect(10, 10, 256, 256));
+		});
+
+	source.SetBlendMode(SDL_BLENDMODE_NONE);
+	runner.Run("BlitScaled/256x256-512x512", pixels * 4.0, [&]() {
+			source.BlitScaled(NullOpt, target, NullOpt);
+		});
+
+	runner.Run("InvertPixels/GetRGBA/256x256", pixels, [&]() {
+			Surface::LockHandle lock = source.Lock();
+			const SDL_PixelFormat& format = lock.GetFormat();
+			for (int y = 0; y < 256; y++) {
+				Uint32* row = reinterpret_cast<Uint32*>(static_cast<Uint8*>(lock.GetPixels()) + y * lock.GetPitch());
+				for (int x = 0; x < 256; x++) {
+					Uint8 r, g, b, a;
+					SDL_GetRGBA(row[x], &format, &r, &g, &b, &a);
+					row[x] = SDL_MapRGBA(&format, 255 - r, 255 - g, 255 - b, a);
+				}
+			}
+		});
+
+	runner.Run("InvertPixels/PixelView/256x256", pixels, [&]() {
+			Surface::LockHandle lock = source.Lock();
+			PixelView<SDL_PIXELFORMAT_ARGB8888>(lock).TransformColors([](const Color& c) {
+					return Color(255 - c.r, 255 - c.g, 255 - c.b, c.a);
+				});
+		});
+
+	runner.Run("BlendFillRect/256x256", pixels, [&]() {
+			target.BlendFillRect(Rect(10, 10, 256, 256), Color(255, 128, 0, 128));
+		});
+
+	runner.Run("BlendFillRect/RGB24/256x256", pixels, [&]() {
+			rgb_target.BlendFillRect(Rect(10, 10, 256, 256), Color(255, 128, 0, 128));
+		});
+
+	runner.Run("DrawLine/1000", 1000.0, [&]() {
+			for (int i = 0; i < 1000; i++)
+				target.DrawLine(static_cast<float>(i % 512), 0.0f, static_cast<float>(511 - i % 512), 511.0f, Color(255, 255, 255, 128));
+		});
+
+	runner.Run("FillCircle/r64", [&]() {
+			target.FillCircle(256.0f, 256.0f, 64.0f, Color(0, 255, 0, 128));
+		});
+
+	const Point star[] = { Point(256, 0), Point(406, 511), Point(0, 180), Point(511, 180), Point(106, 511) };
+	runner.Run("FillPolygon/star/512x512", [&]() {
+			target.FillPolygon(star, 5, Color(0, 0, 255, 128));
+		});
+
+	// same scene drawn directly and with tiled multi-threaded rasterizer
+	Surface frame(0, 1920, 1080, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+	TiledRasterizer rasterizer(frame);
+	source.SetBlendMode(SDL_BLENDMODE_BLEND);
+
+	runner.Run("Scene/Direct/1920x1080", [&]() {
+			frame.FillRect(NullOpt, 0xff000000);
+			for (int i = 0; i < 200; i++) {
+				frame.FillCircle(static_cast<float>(i * 37 % 1920), static_cast<float>(i * 53 % 1080), 40.0f, Color(0, 255, 0, 128));
+				source.Blit(NullOpt, frame, Rect(i * 71 % 1664, i * 29 % 824, 256, 256));
+			}
+		});
+
+	runner.Run("Scene/Tiled/1920x1080", [&]() {
+			rasterizer.Clear(Color(0, 0, 0));
+			for (int i = 0; i < 200; i++) {
+				rasterizer.FillCircle(static_cast<float>(i * 37 % 1920), static_cast<float>(i * 53 % 1080), 40.0f, Color(0, 255, 0, 128));
+				rasterizer.Copy(source, NullOpt, Rect(i * 71 % 1664, i * 29 % 824, 256, 256));
+			}
+			rasterizer.Flush();
+		});
+
+	source.SetBlendMode(SDL_BLENDMODE_NONE);
+
+	std::vector<Color> colors(10000);
+	std::vector<Uint32> mapped(colors.size());
+	Color::FillGradient(colors.data(), colors.size(), Color(255, 0, 0, 255), Color(0, 0, 255, 128));
+
+	const SDL_PixelFormat& format = *target.Get()->format;
+	const double items = static_cast<double>(colors.size());
+
+	runner.Run("MapRGBA/SDL/10000", items, [&]() {
+			for (size_t i = 0; i < colors.size(); i++)
+				mapped[i] = SDL_MapRGBA(&format, colors[i].r, colors[i].g, colors[i].b, colors[i].a);
+		});
+
+	runner.Run("MapRGBA/Batch/10000", items, [&]() {
+			Color::MapRGBA(colors.data(), colors.size(), format, mapped.data());
+		});
+
+	runner.Run("Premultiply/10000", items, [&]() {
+			Color::Premultiply(colors.data(), colors.size());
+		});
+
+	runner.Run("SRGBToLinear/10000", items, [&]() {
+			Color::SRGBToLinear(colors.data(), colors.size());
+		});
+}
@@ -1,3 +1,4 @@
+#include <stdexcept>
 #include <vector>
 
 #include <SDL.h>
@@ -247,6 +248,49 @@ BEGIN_TEST(int, char*[])
 		SDL_Delay(1000);
 	}
 
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+	{
+		// Subpixel drawing
+		renderer.SetDrawColor(0, 0, 0);
+		renderer.Clear();
+
+		renderer.SetDrawColor(255, 128, 0);
+		FRect frects[] = { { 10.0f, 10.0f, 10.0f, 10.0f }, { 30.0f, 10.0f, 10.0f, 10.0f } };
+		renderer.FillRects(frects, 2);
+
+		renderer.SetDrawColor(0, 255, 128);
+		FPoint fpoints[] = { { 10.0f, 30.0f }, { 30.0f, 30.0f } };
+		renderer.DrawPoints(fpoints, 2);
+
+		renderer.SetDrawColor(128, 0, 255);
+		FPoint fline[] = { { 10.0f, 40.0f }, { 30.0f, 40.0f } };
+		renderer.DrawLines(fline, 2);
+
+		Surface surface(0, 8, 8, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+		surface.FillRect(NullOpt, 0xff0102ff);
+		Texture texture(renderer, surface);
+
+		renderer.CopyF(texture, NullOpt, FRect(50.0f, 10.0f, 16.0f, 16.0f));
+		renderer.CopyF(texture, NullOpt, FPoint(70.0f, 10.0f));
+		renderer.CopyF(texture, NullOpt, FPoint(90.0f, 10.0f), 90.0, FPoint(4.0f, 4.0f));
+
+		pixels.Retrieve(renderer);
+
+		EXPECT_TRUE(pixels.Test(15, 15, 255, 128, 0));
+		EXPECT_TRUE(pixels.Test(35, 15, 255, 128, 0));
+		EXPECT_TRUE(pixels.Test(25, 15, 0, 0, 0));
+		EXPECT_TRUE(pixels.Test(10, 30, 0, 255, 128));
+		EXPECT_TRUE(pixels.Test(20, 40, 128, 0, 255));
+		EXPECT_TRUE(pixels.Test(60, 20, 1, 2, 255));
+		EXPECT_TRUE(pixels.Test(74, 14, 1, 2, 255));
+		EXPECT_TRUE(pixels.Test(94, 14, 1, 2, 255));
+		EXPECT_TRUE(pixels.Test(74, 20, 0, 0, 0));
+
+		renderer.Present();
+		SDL_Delay(1000);
+	}
+#endif
+
 	{
 		// Clip rect
 		renderer.SetDrawColor(0, 0, 0);
@@ -327,6 +371,328 @@ BEGIN_TEST(int, char*[])
 		EXPECT_TRUE(false, "render target is not supported here, some tests were skipped", NON_FATAL);
 	}
 
+	if (renderer.TargetSupported()) {
+		// Render target pool
+		RenderTargetPool pool(renderer, 1);
+
+		{
+			RenderTargetPool::Lease lease = pool.Acquire(SDL_PIXELFORMAT_RGBA8888, 32, 32);
+			EXPECT_TRUE(!!lease);
+			EXPECT_EQUAL(lease.GetTexture().GetAccess(), SDL_TEXTUREACCESS_TARGET);
+			EXPECT_EQUAL(lease.GetTexture().GetSize(), Point(32, 32));
+			EXPECT_EQUAL(pool.GetNumLeased(), 1U);
+			EXPECT_EQUAL(pool.GetNumIdle(), 0U);
+
+			renderer.SetTarget(lease.GetTexture());
+			renderer.SetDrawColor(1, 2, 255);
+			renderer.Clear();
+			renderer.SetTarget();
+		}
+
+		EXPECT_EQUAL(pool.GetNumLeased(), 0U);
+		EXPECT_EQUAL(pool.GetNumIdle(), 1U);
+
+		pool.NextFrame();
+
+		{
+			// same texture is handed out again
+			RenderTargetPool::Lease lease = pool.Acquire(SDL_PIXELFORMAT_RGBA8888, Point(32, 32));
+
+			renderer.SetDrawColor(0, 0, 0);
+			renderer.Clear();
+			renderer.Copy(lease.GetTexture());
+
+			pixels.Retrieve(renderer);
+			EXPECT_TRUE(pixels.Test(0, 0, 1, 2, 255));
+		}
+
+		EXPECT_EQUAL(pool.GetHits(), 1UL);
+		EXPECT_EQUAL(pool.GetMisses(), 1UL);
+		EXPECT_EQUAL(pool.GetHitRate(), 0.5f);
+
+		// unused textures are trimmed
+		pool.NextFrame();
+		EXPECT_EQUAL(pool.GetNumIdle(), 1U);
+		pool.NextFrame();
+		EXPECT_EQUAL(pool.GetNumIdle(), 0U);
+
+		renderer.Present();
+		SDL_Delay(1000);
+	}
+
+	if (renderer.TargetSupported()) {
+		// Retained canvas
+		RetainedCanvas canvas(renderer);
+		const Point output_size = renderer.GetOutputSize();
+
+		EXPECT_EQUAL(canvas.GetSize(), output_size);
+		EXPECT_EQUAL(canvas.GetDamage().GetBoundingBox(), Rect(Point(0, 0), renderer.GetOutputSize()));
+
+		std::vector<Rect> redrawn;
+		auto draw = [&redrawn](Renderer& renderer, const Rect& area) {
+			redrawn.push_back(area);
+			renderer.SetDrawColor(redrawn.size() == 1 ? 255 : 1, 2, 3);
+			renderer.FillRect(area);
+		};
+
+		EXPECT_TRUE(canvas.Redraw(draw));
+		EXPECT_EQUAL(redrawn.size(), 1U);
+		EXPECT_TRUE(canvas.GetDamage().IsEmpty());
+		EXPECT_TRUE(!canvas.Redraw(draw));
+
+		// only damaged area is repainted
+		redrawn.clear();
+		redrawn.push_back(Rect());
+		canvas.Invalidate(Rect(10, 10, 5, 5));
+		EXPECT_TRUE(canvas.Redraw(draw));
+		EXPECT_EQUAL(redrawn.size(), 2U);
+		EXPECT_EQUAL(redrawn.back(), Rect(10, 10, 5, 5));
+
+		renderer.SetDrawColor(0, 0, 0);
+		renderer.Clear();
+		canvas.Draw();
+
+		pixels.Retrieve(renderer);
+		EXPECT_TRUE(pixels.Test(0, 0, 255, 2, 3));
+		EXPECT_TRUE(pixels.Test(12, 12, 1, 2, 3));
+		EXPECT_TRUE(pixels.Test(16, 16, 255, 2, 3));
+
+		// caller's target and its state are preserved, and canvas
+		// keeps output size and contents while other target is bound
+		Texture offscreen(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, 16, 16);
+		renderer.SetTarget(offscreen);
+		renderer.SetViewport(Rect(2, 2, 8, 8));
+		renderer.SetClipRect(Rect(1, 1, 4, 4));
+		renderer.SetDrawColor(4, 5, 6, 7);
+		canvas.Invalidate(Rect(10, 10, 5, 5));
+		EXPECT_TRUE(canvas.Redraw(draw));
+		EXPECT_EQUAL(canvas.GetSize(), output_size);
+		EXPECT_EQUAL(redrawn.back(), Rect(10, 10, 5, 5));
+		EXPECT_TRUE(SDL_GetRenderTarget(renderer.Get()) == offscreen.Get());
+		EXPECT_EQUAL(renderer.GetViewport(), Rect(2, 2, 8, 8));
+		EXPECT_TRUE(renderer.GetClipRect() == Rect(1, 1, 4, 4));
+		EXPECT_TRUE(renderer.GetDrawColor() == Color(4, 5, 6, 7));
+
+		{
+			RetainedCanvas other(renderer);
+			EXPECT_EQUAL(other.GetSize(), canvas.GetSize());
+		}
+		EXPECT_TRUE(SDL_GetRenderTarget(renderer.Get()) == offscreen.Get());
+
+		// also when drawing throws, in which case damage is kept
+		canvas.Invalidate(Rect(10, 10, 5, 5));
+		EXPECT_EXCEPTION(canvas.Redraw([](Renderer&, const Rect&) { throw std::runtime_error("draw"); }), std::runtime_error);
+		EXPECT_TRUE(SDL_GetRenderTarget(renderer.Get()) == offscreen.Get());
+		EXPECT_TRUE(renderer.GetClipRect() == Rect(1, 1, 4, 4));
+		EXPECT_EQUAL(canvas.GetDamage().GetBoundingBox(), Rect(10, 10, 5, 5));
+
+		renderer.SetClipRect();
+		renderer.SetTarget();
+		EXPECT_TRUE(canvas.Redraw(draw));
+
+		renderer.Present();
+		SDL_Delay(1000);
+	}
+
+	if (renderer.TargetSupported()) {
+		// Tile map
+		Surface tiles_surface(0, 16, 8, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+		tiles_surface.FillRect(Rect(0, 0, 8, 8), 0xffff0102);
+		tiles_surface.FillRect(Rect(8, 0, 8, 8), 0xff0102ff);
+
+		Texture tileset(renderer, tiles_surface);
+		TileMap map(renderer, tileset, Point(8, 8), Point(256, 256), 4);
+
+		EXPECT_EQUAL(map.GetSize(), Point(2048, 2048));
+
+		map.Fill(Rect(0, 0, 256, 256), 0);
+		map.SetTile(1, 1, 1);
+		map.SetTile(2, 1, -1);
+
+		renderer.SetDrawColor(0, 0, 0);
+		renderer.Clear();
+		map.Draw(Rect(0, 0, 64, 64));
+
+		EXPECT_EQUAL(map.GetNumCachedChunks(), 4U);
+		EXPECT_EQUAL(map.GetNumBakes(), 4UL);
+
+		pixels.Retrieve(renderer);
+		EXPECT_TRUE(pixels.Test(0, 0, 255, 1, 2));
+		EXPECT_TRUE(pixels.Test(12, 12, 1, 2, 255));
+		EXPECT_TRUE(pixels.Test(20, 12, 0, 0, 0));
+		EXPECT_TRUE(pixels.Test(70, 70, 0, 0, 0));
+
+		// only changed and newly visible chunks are baked
+		map.SetTile(1, 1, 0);
+		map.SetTile(5, 5, 1);
+
+		renderer.Clear();
+		map.Draw(Rect(8, 8, 64, 64), Point(100, 100));
+
+		EXPECT_EQUAL(map.GetNumBakes(), 11UL);
+
+		pixels.Retrieve(renderer);
+		EXPECT_TRUE(pixels.Test(100, 100, 255, 1, 2));
+		EXPECT_TRUE(pixels.Test(134, 134, 1, 2, 255));
+		EXPECT_TRUE(pixels.Test(99, 99, 0, 0, 0));
+		EXPECT_TRUE(pixels.Test(164, 164, 0, 0, 0));
+
+		// caller's target and its state are preserved while baking
+		Texture offscreen(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, 16, 16);
+		renderer.SetTarget(offscreen);
+		renderer.SetViewport(Rect(2, 2, 8, 8));
+		renderer.SetClipRect(Rect(1, 1, 4, 4));
+		renderer.SetDrawColor(4, 5, 6, 7);
+		map.InvalidateAll();
+		map.Draw(Rect(0, 0, 16, 16));
+		EXPECT_TRUE(SDL_GetRenderTarget(renderer.Get()) == offscreen.Get());
+		EXPECT_EQUAL(renderer.GetViewport(), Rect(2, 2, 8, 8));
+		EXPECT_TRUE(renderer.GetClipRect() == Rect(1, 1, 4, 4));
+		EXPECT_TRUE(renderer.GetDrawColor() == Color(4, 5, 6, 7));
+		EXPECT_EQUAL(tileset.GetBlendMode(), SDL_BLENDMODE_BLEND);
+
+		renderer.SetClipRect();
+		renderer.SetTarget();
+		renderer.SetDrawColor(0, 0, 0);
+
+		renderer.Present();
+		SDL_Delay(1000);
+	}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+	{
+		// Particle system
+		ParticleSystem particles(2);
+		particles.SetParticleSize(10.0f);
+
+		particles.Emit(10.0f, 10.0f, 10.0f, 0.0f, 1.0f, Color(255, 1, 2));
+		particles.Emit(40.0f, 10.0f, 0.0f, 0.0f, 10.0f, Color(1, 2, 255));
+		particles.Update(1.0f);
+
+		EXPECT_EQUAL(particles.GetNumParticles(), 1U);
+
+		renderer.SetDrawColor(0, 0, 0);
+		renderer.Clear();
+		particles.Draw(renderer);
+
+		pixels.Retrieve(renderer);
+		EXPECT_TRUE(pixels.Test(20, 10, 0, 0, 0));
+		EXPECT_TRUE(pixels.Test(40, 10, 1, 2, 255));
+		EXPECT_TRUE(pixels.Test(50, 10, 0, 0, 0));
+
+		renderer.Present();
+		SDL_Delay(1000);
+	}
+
+	{
+		// Vertex buffer
+		VertexBuffer buffer;
+		buffer.AddQuad(Rect(10, 10, 20, 20), Color(255, 1, 2));
+		buffer.AddTriangle(FPoint(40.0f, 10.0f), FPoint(80.0f, 10.0f), FPoint(40.0f, 50.0f), Color(1, 2, 255));
+
+		renderer.SetDrawColor(0, 0, 0);
+		renderer.Clear();
+		renderer.Geometry(nullptr, buffer);
+
+		pixels.Retrieve(renderer);
+		EXPECT_TRUE(pixels.Test(20, 20, 255, 1, 2));
+		EXPECT_TRUE(pixels.Test(35, 20, 0, 0, 0));
+		EXPECT_TRUE(pixels.Test(45, 15, 1, 2, 255));
+		EXPECT_TRUE(pixels.Test(75, 45, 0, 0, 0));
+
+		renderer.Present();
+		SDL_Delay(1000);
+	}
+#endif
+
+	{
+		// Frame capture
+		renderer.SetDrawColor(1, 2, 255);
+		renderer.Clear();
+
+		Uint32 captured_pixel = 0;
+		{
+			FrameCapture capture(SDL_PIXELFORMAT_ARGB8888, 32, 32, [&captured_pixel](Surface& frame, unsigned long) {
+					captured_pixel = *static_cast<Uint32*>(frame.Get()->pixels);
+				});
+
+			EXPECT_TRUE(capture.Capture(renderer));
+			capture.Flush();
+
+			EXPECT_EQUAL(capture.GetNumCaptured(), 1UL);
+			EXPECT_EQUAL(capture.GetNumEncoded(), 1UL);
+			EXPECT_EQUAL(capture.GetNumDropped(), 0UL);
+		}
+
+		EXPECT_EQUAL(captured_pixel & 0x00ffffff, 0x000102ffU);
+
+		renderer.Present();
+		SDL_Delay(1000);
+	}
+
+	{
+		// Pixel view of streaming texture
+		Texture streaming(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, 8, 8);
+		{
+			Texture::LockHandle lock = streaming.Lock();
+			PixelView<SDL_PIXELFORMAT_ARGB8888> view(lock);
+			EXPECT_EQUAL(view.GetSize(), Point(8, 8));
+			view.Fill(view.MapRGBA(1, 2, 255));
+		}
+		{
+			Texture::LockHandle lock = streaming.Lock(Rect(4, 0, 4, 8));
+			PixelView<SDL_PIXELFORMAT_ARGB8888> view(lock);
+			EXPECT_EQUAL(view.GetSize(), Point(4, 8));
+			view.Fill(view.MapRGBA(255, 1, 2));
+		}
+
+		renderer.SetDrawColor(0, 0, 0);
+		renderer.Clear();
+		renderer.Copy(streaming, NullOpt, Rect(0, 0, 80, 80));
+
+		pixels.Retrieve(renderer);
+		EXPECT_TRUE(pixels.Test(20, 40, 1, 2, 255));
+		EXPECT_TRUE(pixels.Test(60, 40, 255, 1, 2));
+
+		renderer.Present();
+		SDL_Delay(1000);
+	}
+
+	{
+		// Mipmapped texture
+		Surface checker(0, 64, 64, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+		{
+			auto lock = checker.Lock();
+			for (int y = 0; y < 64; y++)
+				for (int x = 0; x < 64; x++)
+					static_cast<Uint32*>(static_cast<void*>(static_cast<Uint8*>(lock.GetPixels()) + y * lock.GetPitch()))[x] = ((x ^ y) & 1) ? 0xffffffff : 0xff000000;
+		}
+
+		MipmappedTexture mipmapped(renderer, checker);
+
+		EXPECT_EQUAL(mipmapped.GetNumLevels(), 7);
+		EXPECT_EQUAL(mipmapped.GetSize(), Point(64, 64));
+		EXPECT_EQUAL(mipmapped.GetLevel(3).GetSize(), Point(8, 8));
+		EXPECT_EQUAL(mipmapped.SelectLevel(Point(64, 64), Point(64, 64)), 0);
+		EXPECT_EQUAL(mipmapped.SelectLevel(Point(64, 64), Point(8, 8)), 3);
+		EXPECT_EQUAL(mipmapped.SelectLevel(Point(64, 64), Point(128, 128)), 0);
+		EXPECT_EQUAL(mipmapped.GetLevelRect(Rect(16, 16, 32, 32), 2), Rect(4, 4, 8, 8));
+
+		renderer.SetDrawColor(0, 0, 0);
+		renderer.Clear();
+
+		// minified checkerboard averages to grey instead of aliasing
+		renderer.Copy(mipmapped, NullOpt, Rect(0, 0, 8, 8));
+
+		pixels.Retrieve(renderer);
+		EXPECT_TRUE(pixels.Test(0, 0, 128, 128, 128));
+		EXPECT_TRUE(pixels.Test(7, 7, 128, 128, 128));
+		EXPECT_TRUE(pixels.Test(8, 8, 0, 0, 0));
+
+		renderer.Present();
+		SDL_Delay(1000);
+	}
+
 #ifdef SDL2PP_WITH_IMAGE
 	{
 		// Init
@@ -85,4 +85,74 @@ BEGIN_TEST(int, char*[])
 		stream << Color(1, 2, 3, 4);
 		EXPECT_EQUAL(stream.str(), "[r:1,g:2,b:3,a:4]");
 	}
+
+	{
+		// Batch interpolation
+		const Color from[2] = { Color(0, 0, 0, 0), Color(255, 255, 255, 255) };
+		const Color to[2] = { Color(255, 100, 10, 255), Color(0, 0, 0, 0) };
+		Color out[2];
+
+		Color::Lerp(from, to, out, 2, 0.0f);
+		EXPECT_TRUE(out[0] == from[0] && out[1] == from[1]);
+
+		Color::Lerp(from, to, out, 2, 1.0f);
+		EXPECT_TRUE(out[0] == to[0] && out[1] == to[1]);
+
+		Color::Lerp(from, to, out, 2, 0.5f);
+		EXPECT_TRUE(out[0] == Color(128, 50, 5, 128));
+		EXPECT_TRUE(out[1] == Color(128, 128, 128, 128));
+	}
+
+	{
+		// Gradient
+		Color colors[5];
+		Color::FillGradient(colors, 5, Color(0, 255, 10, 255), Color(100, 55, 10, 0));
+
+		EXPECT_TRUE(colors[0] == Color(0, 255, 10, 255));
+		EXPECT_TRUE(colors[2] == Color(50, 155, 10, 128));
+		EXPECT_TRUE(colors[4] == Color(100, 55, 10, 0));
+	}
+
+	{
+		// Premultiplication
+		Color colors[3] = { Color(255, 128, 0, 255), Color(255, 128, 10, 0), Color(255, 128, 0, 128) };
+		Color::Premultiply(colors, 3);
+
+		EXPECT_TRUE(colors[0] == Color(255, 128, 0, 255));
+		EXPECT_TRUE(colors[1] == Color(0, 0, 0, 0));
+		EXPECT_TRUE(colors[2] == Color(128, 64, 0, 128));
+	}
+
+	{
+		// Gamma conversion
+		Color colors[2] = { Color(0, 128, 255, 10), Color(188, 55, 99, 20) };
+
+		Color::SRGBToLinear(colors, 2);
+		EXPECT_TRUE(colors[0] == Color(0, 55, 255, 10));
+		EXPECT_EQUAL((int)colors[1].r, 128);
+		EXPECT_EQUAL((int)colors[1].a, 20);
+
+		Color::LinearToSRGB(colors, 1);
+		EXPECT_TRUE(colors[0] == Color(0, 128, 255, 10));
+
+		Color::ApplyGamma(colors, 1, 2.0f);
+		EXPECT_TRUE(colors[0] == Color(0, 64, 255, 10));
+	}
+
+	{
+		// Mapping to pixel values
+		const Color colors[3] = { Color(1, 2, 3, 4), Color(255, 128, 0, 255), Color(17, 34, 51, 0) };
+		const Uint32 formats[3] = { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 };
+
+		for (Uint32 f : formats) {
+			SDL_PixelFormat* format = SDL_AllocFormat(f);
+			Uint32 pixels[3];
+			Color::MapRGBA(colors, 3, *format, pixels);
+
+			for (int i = 0; i < 3; i++)
+				EXPECT_EQUAL(pixels[i], SDL_MapRGBA(format, colors[i].r, colors[i].g, colors[i].b, colors[i].a));
+
+			SDL_FreeFormat(format);
+		}
+	}
 END_TEST()
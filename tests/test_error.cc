@@ -1,7 +1,10 @@
+#include <string>
+
 #include <SDL_main.h>
 #include <SDL_error.h>
 
 #include <SDL2pp/Exception.hh>
+#include <SDL2pp/Result.hh>
 
 #include "testing.h"
 
@@ -19,4 +22,37 @@ BEGIN_TEST(int, char*[])
 		EXPECT_EQUAL(e.GetSDLError(), "BarError");
 		EXPECT_EQUAL((std::string)e.what(), "FooFunction failed: BarError");
 	}
+
+	{
+		// overlong SDL error is truncated to fit inline buffer
+		SDL_SetError("%s", std::string(1000, 'x').c_str());
+		Exception e("FooFunction");
+		EXPECT_EQUAL(e.GetSDLError(), std::string(Exception::error_buffer_size - 1, 'x'));
+		EXPECT_EQUAL(std::string(e.what()).substr(0, 20), "FooFunction failed: ");
+	}
+
+	{
+		// successful result carries value and no error
+		Result result(5);
+		EXPECT_TRUE(static_cast<bool>(result));
+		EXPECT_TRUE(!result.IsError());
+		EXPECT_EQUAL(result.GetValue(), 5);
+		EXPECT_TRUE(result.GetSDLFunction() == nullptr);
+		EXPECT_EQUAL((std::string)result.GetSDLError(), "");
+		EXPECT_EQUAL(result.ThrowIfFailed(), 5);
+	}
+
+	{
+		// failed result fetches error text lazily
+		Result result("FooFunction", -1);
+		EXPECT_TRUE(!result);
+		EXPECT_TRUE(result.IsError());
+		EXPECT_EQUAL(result.GetValue(), -1);
+		EXPECT_EQUAL((std::string)result.GetSDLFunction(), "FooFunction");
+
+		SDL_SetError("BazError");
+		EXPECT_EQUAL((std::string)result.GetSDLError(), "BazError");
+
+		EXPECT_EXCEPTION(result.ThrowIfFailed(), Exception);
+	}
 END_TEST()
@@ -4,6 +4,8 @@
 #include <SDL2pp/Font.hh>
 #include <SDL2pp/RWops.hh>
 #include <SDL2pp/SDLTTF.hh>
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/SurfacePool.hh>
 
 #include "testing.h"
 #include "movetest.hh"
@@ -137,6 +139,33 @@ BEGIN_TEST(int, char*[])
 		EXPECT_TRUE(isAllowedAADims(font.GetSizeUNICODE(u"AA")));
 	}
 
+	{
+		// Glyph metrics cache
+		auto rawAdvance = [&](Uint16 ch) {
+			int advance = 0;
+			TTF_GlyphMetrics(font.Get(), ch, nullptr, nullptr, nullptr, nullptr, &advance);
+			return advance;
+		};
+
+		EXPECT_NO_EXCEPTION(font.PreloadGlyphMetrics());
+		EXPECT_EQUAL(font.GetGlyphAdvance(u'A'), 21);
+		EXPECT_TRUE(isAllowedARect(font.GetGlyphRect(u'A')));
+		EXPECT_TRUE(font.IsGlyphProvided(u'A') > 0);
+#ifndef _MSC_VER // MSVC has problems with unicode literals
+		EXPECT_TRUE(font.IsGlyphProvided(u'л') == 0);
+		EXPECT_EQUAL(font.GetGlyphAdvance(u'¼'), rawAdvance(u'¼'));
+#endif
+
+		// cache is flushed when metrics change
+		font.SetOutline(2);
+		EXPECT_EQUAL(font.GetGlyphAdvance(u'A'), rawAdvance(u'A'));
+		font.SetStyle(TTF_STYLE_BOLD);
+		EXPECT_EQUAL(font.GetGlyphAdvance(u'A'), rawAdvance(u'A'));
+		font.SetOutline();
+		font.SetStyle();
+		EXPECT_EQUAL(font.GetGlyphAdvance(u'A'), 21);
+	}
+
 	{
 		// Rendering
 		// XXX: add real pixel color tests
@@ -152,4 +181,43 @@ BEGIN_TEST(int, char*[])
 		EXPECT_TRUE(isAllowedAADims(font.RenderUTF8_Blended(u8"AA", SDL_Color{255, 255, 255, 255}).GetSize()));
 		EXPECT_TRUE(isAllowedAADims(font.RenderUNICODE_Blended(u"AA", SDL_Color{255, 255, 255, 255}).GetSize()));
 	}
+
+	{
+		// Rendering into existing surface
+		Surface surface(0, 64, 48, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+		surface.FillRect(NullOpt, 0xff000000);
+
+		Rect rect = font.RenderUTF8_Blended(u8"AA", SDL_Color{255, 255, 255, 255}, surface, Point(4, 4));
+		EXPECT_TRUE(rect.x >= 4 && rect.x <= 5 && rect.y == 4 && rect.h == font.GetHeight());
+		EXPECT_TRUE(rect.w >= 40 && rect.w <= 43);
+
+		int inside = 0, outside = 0;
+		{
+			Surface::LockHandle lock = surface.Lock();
+			for (int y = 0; y < 48; y++) {
+				for (int x = 0; x < 64; x++) {
+					Uint32 pixel = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(lock.GetPixels()) + y * lock.GetPitch())[x];
+					if (pixel != 0xff000000)
+						(rect.Contains(x, y) ? inside : outside)++;
+				}
+			}
+		}
+		EXPECT_TRUE(inside > 0);
+		EXPECT_EQUAL(outside, 0);
+
+		// clipped by surface clip rectangle
+		surface.SetClipRect(Rect(0, 0, 16, 16));
+		rect = font.RenderUTF8_Blended(u8"AA", SDL_Color{255, 255, 255, 255}, surface, Point(4, 4));
+		EXPECT_TRUE(rect == Rect(4, 4, 12, 12) || rect == Rect(5, 4, 11, 12));
+		surface.SetClipRect();
+
+		// empty text touches nothing
+		EXPECT_TRUE(font.RenderUTF8_Blended("", SDL_Color{255, 255, 255, 255}, surface, Point(4, 4)) == Rect(4, 4, 0, 0));
+
+		// same dimensions as surface created by SDL_ttf
+		SurfacePool pool;
+		EXPECT_TRUE(isAllowedAADims(font.RenderUTF8_Blended(u8"AA", SDL_Color{255, 255, 255, 255}, pool).GetSurface().GetSize()));
+		EXPECT_TRUE(isAllowedAADims(font.RenderUTF8_Blended(u8"AA", SDL_Color{255, 255, 255, 255}, pool).GetSurface().GetSize()));
+		EXPECT_EQUAL(pool.GetHits(), 1UL);
+	}
 END_TEST()
@@ -0,0 +1,118 @@
+#include <sstream>
+
+#include <SDL_main.h>
+
+#include <SDL2pp/FPoint.hh>
+#include <SDL2pp/FRect.hh>
+
+#include "testing.h"
+
+using namespace SDL2pp;
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+// compile-time checks
+static_assert(FPoint(1.5f, 2.0f) + FPoint(0.5f, 1.0f) == FPoint(2.0f, 3.0f), "");
+static_assert(FPoint(1.0f, 2.0f) * 2.0f - FPoint(0.5f, 0.5f) == FPoint(1.5f, 3.5f), "");
+static_assert(-FPoint(1.0f, 2.0f) / 2.0f == FPoint(-0.5f, -1.0f), "");
+static_assert(FPoint(Point(1, 2)) == FPoint(1.0f, 2.0f), "");
+static_assert(FRect(Rect(1, 2, 3, 4)) == FRect(1.0f, 2.0f, 3.0f, 4.0f), "");
+static_assert(FRect::FromCorners(0.5f, 0.5f, 2.0f, 3.0f) == FRect(0.5f, 0.5f, 1.5f, 2.5f), "");
+static_assert(FRect::FromCenter(FPoint(1.0f, 1.0f), FPoint(1.0f, 3.0f)) == FRect(0.5f, -0.5f, 1.0f, 3.0f), "");
+static_assert(FRect(0.0f, 0.0f, 1.0f, 1.0f).Contains(FPoint(0.5f, 0.5f)), "");
+static_assert(FRect(0.0f, 0.0f, 1.0f, 1.0f).Intersects(FRect(0.5f, 0.5f, 1.0f, 1.0f)), "");
+static_assert(FRect(0.0f, 0.0f, 1.0f, 1.0f) + FPoint(1.0f, 2.0f) == FRect(1.0f, 2.0f, 1.0f, 1.0f), "");
+#endif
+
+BEGIN_TEST(int, char*[])
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+	{
+		// FPoint basic ops
+		FPoint p(1.5f, 2.5f);
+
+		EXPECT_TRUE(p.GetX() == 1.5f && p.GetY() == 2.5f);
+		EXPECT_TRUE(p == FPoint(1.5f, 2.5f));
+		EXPECT_TRUE(p != FPoint(1.5f, 2.0f));
+
+		p.SetX(4.0f).SetY(5.25f);
+		EXPECT_EQUAL(p, FPoint(4.0f, 5.25f));
+
+		p += FPoint(1.0f, 0.75f);
+		EXPECT_EQUAL(p, FPoint(5.0f, 6.0f));
+
+		p -= FPoint(1.0f, 2.0f);
+		p *= 0.5f;
+		EXPECT_EQUAL(p, FPoint(2.0f, 2.0f));
+
+		p *= FPoint(2.0f, 3.0f);
+		p /= FPoint(4.0f, 2.0f);
+		p /= 2.0f;
+		EXPECT_EQUAL(p, FPoint(0.5f, 1.5f));
+
+		EXPECT_EQUAL(FPoint(1.4f, -1.6f).GetRounded(), Point(1, -2));
+		EXPECT_EQUAL(FPoint(-1.0f, 5.0f).GetClamped(FRect(0.0f, 0.0f, 2.5f, 2.5f)), FPoint(0.0f, 2.5f));
+	}
+
+	{
+		// FRect basic ops
+		FRect r(1.0f, 2.0f, 3.0f, 4.0f);
+
+		EXPECT_TRUE(r.GetX() == 1.0f && r.GetY() == 2.0f && r.GetW() == 3.0f && r.GetH() == 4.0f);
+		EXPECT_TRUE(r.GetX2() == 4.0f && r.GetY2() == 6.0f);
+		EXPECT_EQUAL(r.GetTopLeft(), FPoint(1.0f, 2.0f));
+		EXPECT_EQUAL(r.GetBottomRight(), FPoint(4.0f, 6.0f));
+		EXPECT_EQUAL(r.GetCentroid(), FPoint(2.5f, 4.0f));
+		EXPECT_EQUAL(r.GetSize(), FPoint(3.0f, 4.0f));
+
+		r.SetX2(5.5f).SetY2(2.5f);
+		EXPECT_EQUAL(r, FRect(1.0f, 2.0f, 4.5f, 0.5f));
+
+		r += FPoint(0.5f, 0.5f);
+		EXPECT_EQUAL(r, FRect(1.5f, 2.5f, 4.5f, 0.5f));
+		r -= FPoint(1.5f, 2.5f);
+		EXPECT_EQUAL(r, FRect(0.0f, 0.0f, 4.5f, 0.5f));
+	}
+
+	{
+		// FRect containment and intersection
+		FRect r(0.0f, 0.0f, 2.0f, 2.0f);
+
+		EXPECT_TRUE(r.Contains(0.0f, 0.0f));
+		EXPECT_TRUE(r.Contains(1.99f, 1.99f));
+		EXPECT_TRUE(!r.Contains(2.0f, 1.0f));
+		EXPECT_TRUE(!r.Contains(-0.01f, 1.0f));
+
+		EXPECT_TRUE(r.Contains(FRect(0.0f, 0.0f, 2.0f, 2.0f)));
+		EXPECT_TRUE(r.Contains(FRect(0.5f, 0.5f, 1.0f, 1.0f)));
+		EXPECT_TRUE(!r.Contains(FRect(0.5f, 0.5f, 2.0f, 1.0f)));
+
+		// touching rectangles do not intersect
+		EXPECT_TRUE(r.Intersects(FRect(1.5f, 1.5f, 1.0f, 1.0f)));
+		EXPECT_TRUE(!r.Intersects(FRect(2.0f, 0.0f, 1.0f, 1.0f)));
+		EXPECT_TRUE(!r.Intersects(FRect(1.0f, 1.0f, 0.0f, 0.0f)));
+
+		EXPECT_TRUE(r.GetIntersection(FRect(1.5f, -1.0f, 1.0f, 2.0f)) == FRect(1.5f, 0.0f, 0.5f, 1.0f));
+		EXPECT_TRUE(!r.GetIntersection(FRect(2.0f, 2.0f, 1.0f, 1.0f)));
+
+		EXPECT_EQUAL(r.GetUnion(FRect(3.0f, -1.0f, 1.0f, 1.0f)), FRect(0.0f, -1.0f, 4.0f, 3.0f));
+		EXPECT_EQUAL(r.GetExtension(0.5f), FRect(-0.5f, -0.5f, 3.0f, 3.0f));
+		EXPECT_EQUAL(r.GetExtension(0.5f, 1.0f), FRect(-0.5f, -1.0f, 3.0f, 4.0f));
+
+		// edges are rounded independently
+		EXPECT_EQUAL(FRect(0.4f, 0.6f, 1.2f, 1.0f).GetRounded(), Rect(0, 1, 2, 1));
+	}
+
+	{
+		// Comparison, hashing and output
+		EXPECT_TRUE(FPoint(0.0f, 1.0f) < FPoint(1.0f, 0.0f));
+		EXPECT_TRUE(FRect(0.0f, 0.0f, 1.0f, 1.0f) < FRect(0.0f, 0.0f, 1.0f, 2.0f));
+
+		EXPECT_TRUE(std::hash<FPoint>()(FPoint(1.5f, 2.0f)) == std::hash<FPoint>()(FPoint(1.5f, 2.0f)));
+		EXPECT_TRUE(std::hash<FPoint>()(FPoint(1.0f, 0.0f)) != std::hash<FPoint>()(FPoint(0.0f, 1.0f)));
+		EXPECT_TRUE(std::hash<FRect>()(FRect(1.0f, 2.0f, 3.0f, 4.0f)) != std::hash<FRect>()(FRect(2.0f, 1.0f, 3.0f, 4.0f)));
+
+		std::stringstream stream;
+		stream << FPoint(1.5f, 2.0f) << FRect(1.0f, 2.0f, 3.0f, 4.5f);
+		EXPECT_EQUAL(stream.str(), "[x:1.5,y:2][x:1,y:2,w:3,h:4.5]");
+	}
+#endif
+END_TEST()
@@ -0,0 +1,164 @@
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <SDL_main.h>
+
+#include <SDL2pp/Color.hh>
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Renderer.hh>
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/TiledRasterizer.hh>
+
+#include "testing.h"
+
+using namespace SDL2pp;
+
+static Surface MakeSurface(int w, int h) {
+	return Surface(0, w, h, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+}
+
+static bool SamePixels(Surface& a, Surface& b) {
+	Surface::LockHandle lock_a = a.Lock();
+	Surface::LockHandle lock_b = b.Lock();
+	for (int y = 0; y < a.GetHeight(); y++)
+		if (std::memcmp(static_cast<const Uint8*>(lock_a.GetPixels()) + y * lock_a.GetPitch(), static_cast<const Uint8*>(lock_b.GetPixels()) + y * lock_b.GetPitch(), static_cast<size_t>(a.GetWidth()) * 4) != 0)
+			return false;
+	return true;
+}
+
+static Uint32 GetPixel(Surface& surface, int x, int y) {
+	Surface::LockHandle lock = surface.Lock();
+	return *reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(lock.GetPixels()) + y * lock.GetPitch() + x * 4);
+}
+
+BEGIN_TEST(int, char*[])
+	{
+		// Software renderer without window
+		Surface target = MakeSurface(16, 16);
+		Renderer renderer(target);
+
+		renderer.SetDrawColor(255, 0, 0, 255);
+		renderer.Clear();
+		renderer.Present();
+
+		EXPECT_EQUAL(GetPixel(target, 0, 0), 0xffff0000U);
+		EXPECT_EQUAL(GetPixel(target, 15, 15), 0xffff0000U);
+	}
+
+	{
+		// Construction
+		Surface target = MakeSurface(100, 50);
+
+		TiledRasterizer rasterizer(target, 32, 3);
+		EXPECT_EQUAL(rasterizer.GetNumTiles(), 8);
+		EXPECT_EQUAL(rasterizer.GetNumThreads(), 3);
+		EXPECT_EQUAL(rasterizer.GetNumCommands(), 0U);
+
+		TiledRasterizer automatic(target);
+		EXPECT_TRUE(automatic.GetNumThreads() >= 1);
+
+		EXPECT_EXCEPTION(TiledRasterizer(target, 0), std::invalid_argument);
+
+		// flushing with nothing recorded is no-op
+		rasterizer.Flush();
+	}
+
+	{
+		// Tiled output is identical to direct drawing
+		const Point star[] = { Point(60, 5), Point(75, 55), Point(35, 25), Point(85, 25), Point(45, 55) };
+
+		Surface sprite = MakeSurface(20, 20);
+		sprite.FillRect(NullOpt, 0x80ff00ff);
+		sprite.FillRect(Rect(5, 5, 10, 10), 0xff00ff00);
+		sprite.SetBlendMode(SDL_BLENDMODE_BLEND);
+
+		auto draw_direct = [&](Surface& surface) {
+			surface.FillRect(NullOpt, 0xff102030);
+			surface.FillRect(Rect(-5, 10, 40, 30), 0xffffffff);
+			surface.BlendFillRect(Rect(20, 20, 60, 30), Color(255, 0, 0, 128));
+			surface.DrawLine(3.5f, 70.0f, 97.25f, 3.0f, Color(0, 255, 0));
+			surface.DrawCircle(50.0f, 40.0f, 30.0f, Color(0, 0, 255, 200));
+			surface.FillCircle(95.0f, 75.0f, 12.5f, Color(255, 255, 0, 100));
+			surface.DrawPolygon(star, 5, Color(255, 128, 0));
+			surface.FillPolygon(star, 5, Color(0, 128, 255, 64));
+			sprite.Blit(NullOpt, surface, Rect(25, 55, 20, 20));
+			sprite.Blit(Rect(5, 0, 15, 20), surface, Rect(90, -5, 15, 20));
+		};
+
+		Surface expected = MakeSurface(100, 80);
+		draw_direct(expected);
+
+		Surface actual = MakeSurface(100, 80);
+		TiledRasterizer rasterizer(actual, 16, 4);
+
+		rasterizer.Clear(Color(0x10, 0x20, 0x30));
+		rasterizer.FillRect(Rect(-5, 10, 40, 30), Color(255, 255, 255));
+		rasterizer.BlendFillRect(Rect(20, 20, 60, 30), Color(255, 0, 0, 128));
+		rasterizer.DrawLine(3.5f, 70.0f, 97.25f, 3.0f, Color(0, 255, 0));
+		rasterizer.DrawCircle(50.0f, 40.0f, 30.0f, Color(0, 0, 255, 200));
+		rasterizer.FillCircle(95.0f, 75.0f, 12.5f, Color(255, 255, 0, 100));
+		rasterizer.DrawPolygon(star, 5, Color(255, 128, 0));
+		rasterizer.FillPolygon(star, 5, Color(0, 128, 255, 64));
+		rasterizer.Copy(sprite, NullOpt, Rect(25, 55, 20, 20));
+		rasterizer.Copy(sprite, Rect(5, 0, 15, 20), Rect(90, -5, 15, 20));
+
+		EXPECT_EQUAL(rasterizer.GetNumCommands(), 10U);
+		rasterizer.Flush();
+		EXPECT_EQUAL(rasterizer.GetNumCommands(), 0U);
+
+		EXPECT_TRUE(SamePixels(expected, actual));
+
+		// rasterizer is reusable, and respects clipping rectangle
+		expected.SetClipRect(Rect(10, 10, 50, 50));
+		actual.SetClipRect(Rect(10, 10, 50, 50));
+
+		expected.FillCircle(40.0f, 40.0f, 40.0f, Color(255, 255, 255, 128));
+		rasterizer.FillCircle(40.0f, 40.0f, 40.0f, Color(255, 255, 255, 128));
+		rasterizer.Flush();
+
+		EXPECT_TRUE(SamePixels(expected, actual));
+	}
+
+	{
+		// Far away coordinates give the same result as direct drawing
+		const Point huge[] = { Point(-2000000000, -2000000000), Point(2000000000, -2000000000), Point(0, 2000000000) };
+
+		Surface expected = MakeSurface(64, 64);
+		expected.FillRect(NullOpt, 0xff000000);
+		expected.FillPolygon(huge, 3, Color(0, 0, 255, 128));
+		expected.DrawLine(-1e12f, 10.5f, 1e12f, 10.5f, Color(255, 0, 0));
+		expected.DrawLine(20.5f, -1e12f, 20.5f, 1e12f, Color(0, 255, 0));
+
+		Surface actual = MakeSurface(64, 64);
+		TiledRasterizer rasterizer(actual, 16, 2);
+		rasterizer.Clear(Color(0, 0, 0));
+		rasterizer.FillPolygon(huge, 3, Color(0, 0, 255, 128));
+		rasterizer.DrawLine(-1e12f, 10.5f, 1e12f, 10.5f, Color(255, 0, 0));
+		rasterizer.DrawLine(20.5f, -1e12f, 20.5f, 1e12f, Color(0, 255, 0));
+		rasterizer.DrawLine(-1e12f, -1e12f, 1e12f, -1e12f, Color(255, 255, 255));
+		rasterizer.DrawLine(std::numeric_limits<float>::quiet_NaN(), 0.0f, 10.0f, 10.0f, Color(255, 255, 255));
+		rasterizer.Flush();
+
+		EXPECT_TRUE(SamePixels(expected, actual));
+		EXPECT_EQUAL(GetPixel(actual, 0, 10), 0xffff0000U);
+		EXPECT_EQUAL(GetPixel(actual, 20, 63), 0xff00ff00U);
+	}
+
+	{
+		// Scaled copy
+		Surface sprite = MakeSurface(4, 4);
+		sprite.FillRect(NullOpt, 0xff00ff00);
+
+		Surface target = MakeSurface(64, 64);
+		TiledRasterizer rasterizer(target, 16, 2);
+		rasterizer.Clear(Color(0, 0, 0)).Copy(sprite, NullOpt, Rect(8, 8, 40, 40)).Flush();
+
+		EXPECT_EQUAL(GetPixel(target, 7, 7), 0xff000000U);
+		EXPECT_EQUAL(GetPixel(target, 8, 8), 0xff00ff00U);
+		EXPECT_EQUAL(GetPixel(target, 30, 30), 0xff00ff00U);
+		EXPECT_EQUAL(GetPixel(target, 47, 47), 0xff00ff00U);
+		EXPECT_EQUAL(GetPixel(target, 48, 48), 0xff000000U);
+	}
+END_TEST()
@@ -0,0 +1,84 @@
+#include <SDL_main.h>
+
+#include <SDL2pp/Color.hh>
+#include <SDL2pp/ParticleSystem.hh>
+
+#include "testing.h"
+
+using namespace SDL2pp;
+
+BEGIN_TEST(int, char*[])
+	{
+		// Emission
+		ParticleSystem particles(3);
+
+		EXPECT_EQUAL(particles.GetMaxParticles(), 3U);
+		EXPECT_EQUAL(particles.GetNumParticles(), 0U);
+
+		EXPECT_TRUE(particles.Emit(0.0f, 0.0f, 1.0f, 0.0f, 1.0f, Color(255, 0, 0)));
+		EXPECT_TRUE(!particles.Emit(0.0f, 0.0f, 1.0f, 0.0f, 0.0f, Color(255, 0, 0)));
+		EXPECT_TRUE(particles.Emit(0.0f, 0.0f, 1.0f, 0.0f, 1.0f, Color(255, 0, 0)));
+		EXPECT_TRUE(particles.Emit(0.0f, 0.0f, 1.0f, 0.0f, 1.0f, Color(255, 0, 0)));
+		EXPECT_TRUE(!particles.Emit(0.0f, 0.0f, 1.0f, 0.0f, 1.0f, Color(255, 0, 0)));
+
+		EXPECT_EQUAL(particles.GetNumParticles(), 3U);
+
+		particles.Clear();
+		EXPECT_EQUAL(particles.GetNumParticles(), 0U);
+	}
+
+	{
+		// Motion
+		ParticleSystem particles(10);
+
+		particles.Emit(10.0f, 20.0f, 4.0f, -2.0f, 10.0f, Color(0, 0, 0));
+		particles.Update(0.5f);
+
+		EXPECT_EQUAL(particles.GetX()[0], 12.0f);
+		EXPECT_EQUAL(particles.GetY()[0], 19.0f);
+		EXPECT_EQUAL(particles.GetLife()[0], 9.5f);
+
+		// gravity is applied to velocity before integrating position
+		particles.SetGravity(0.0f, 4.0f);
+		particles.Update(0.5f);
+
+		EXPECT_EQUAL(particles.GetX()[0], 14.0f);
+		EXPECT_EQUAL(particles.GetY()[0], 19.0f);
+
+		// full drag stops particles
+		particles.SetGravity(0.0f, 0.0f);
+		particles.SetDrag(2.0f);
+		particles.Update(0.5f);
+
+		EXPECT_EQUAL(particles.GetX()[0], 14.0f);
+		EXPECT_EQUAL(particles.GetY()[0], 19.0f);
+	}
+
+	{
+		// Expiration keeps order of live particles
+		ParticleSystem particles(100);
+
+		for (int i = 0; i < 100; i++)
+			particles.Emit(static_cast<float>(i), 0.0f, 0.0f, 0.0f, (i % 3 == 0) ? 1.0f : 3.0f, Color(0, 0, 0));
+
+		particles.Update(0.5f);
+		EXPECT_EQUAL(particles.GetNumParticles(), 100U);
+
+		particles.Update(1.0f);
+		EXPECT_EQUAL(particles.GetNumParticles(), 66U);
+
+		bool ordered = true;
+		for (size_t i = 0; i < particles.GetNumParticles(); i++)
+			if (particles.GetX()[i] != static_cast<float>(i / 2 * 3 + 1 + i % 2))
+				ordered = false;
+		EXPECT_TRUE(ordered);
+
+		// room is freed for new particles
+		for (int i = 0; i < 40; i++)
+			particles.Emit(0.0f, 0.0f, 0.0f, 0.0f, 1.0f, Color(0, 0, 0));
+		EXPECT_EQUAL(particles.GetNumParticles(), 100U);
+
+		particles.Update(5.0f);
+		EXPECT_EQUAL(particles.GetNumParticles(), 0U);
+	}
+END_TEST()
@@ -0,0 +1,92 @@
+#include <stdexcept>
+
+#include <SDL_main.h>
+
+#include <SDL2pp/Color.hh>
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/PixelView.hh>
+
+#include "testing.h"
+
+using namespace SDL2pp;
+
+// compile-time checks
+static_assert(PixelView<SDL_PIXELFORMAT_ARGB8888>::MapRGBA(1, 2, 3, 4) == 0x04010203, "");
+static_assert(PixelView<SDL_PIXELFORMAT_ABGR8888>::MapRGBA(1, 2, 3) == 0xff030201, "");
+static_assert(PixelView<SDL_PIXELFORMAT_RGB565>::MapRGBA(255, 0, 255) == 0xf81f, "");
+static_assert(PixelView<SDL_PIXELFORMAT_RGB565>::GetColor(0x07e0) == Color(0, 255, 0), "");
+static_assert(PixelView<SDL_PIXELFORMAT_ARGB4444>::GetColor(0x8f0a) == Color(255, 0, 170, 136), "");
+static_assert(PixelView<SDL_PIXELFORMAT_RGB332>::GetColor(0xe1) == Color(255, 0, 85), "");
+static_assert(PixelView<SDL_PIXELFORMAT_RGBA8888>::GetColor(0x01020304) == Color(1, 2, 3, 4), "");
+
+BEGIN_TEST(int, char*[])
+	{
+		// Raw view
+		Uint16 data[3 * 4] = {};
+		PixelView<SDL_PIXELFORMAT_RGB565> view(data, 4 * sizeof(Uint16), 3, 3);
+
+		EXPECT_EQUAL(view.GetWidth(), 3);
+		EXPECT_EQUAL(view.GetHeight(), 3);
+		EXPECT_EQUAL(view.GetPitch(), 8);
+		EXPECT_TRUE(view.GetSize() == Point(3, 3));
+
+		view.Fill(0x1234);
+		EXPECT_EQUAL(data[0], 0x1234);
+		EXPECT_EQUAL(data[2], 0x1234);
+		EXPECT_EQUAL(data[3], 0); // padding is not touched
+		EXPECT_EQUAL(data[10], 0x1234);
+
+		view.Fill(Rect(2, -1, 5, 3), 0xffff);
+		EXPECT_EQUAL(data[1], 0x1234);
+		EXPECT_EQUAL(data[2], 0xffff);
+		EXPECT_EQUAL(data[3], 0);
+		EXPECT_EQUAL(data[6], 0xffff);
+		EXPECT_EQUAL(data[10], 0x1234);
+
+		// rectangles completely outside of the view are no-op
+		view.Fill(Rect(5, 0, 2, 2), 0);
+		view.Fill(Rect(-4, 0, 2, 2), 0);
+		view.Fill(Rect(0, 5, 2, 2), 0);
+		view.Fill(Rect(0, -4, 2, 2), 0);
+		EXPECT_EQUAL(data[0], 0x1234);
+		EXPECT_EQUAL(data[2], 0xffff);
+		EXPECT_EQUAL(data[3], 0);
+		EXPECT_EQUAL(data[7], 0);
+		EXPECT_EQUAL(data[10], 0x1234);
+		EXPECT_EQUAL(data[11], 0);
+
+		view(1, 2) = 0x4321;
+		EXPECT_EQUAL(data[9], 0x4321);
+		EXPECT_EQUAL(view.GetRow(2)[1], 0x4321);
+		EXPECT_EQUAL(view.GetRow(2).size(), 3);
+	}
+
+	{
+		// Surface view
+		Surface surface(0, 16, 8, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+		Surface::LockHandle lock = surface.Lock();
+		PixelView<SDL_PIXELFORMAT_ARGB8888> view(lock);
+
+		EXPECT_TRUE(view.GetSize() == Point(16, 8));
+
+		view.Fill(view.MapColor(Color(10, 20, 30, 40)));
+
+		int count = 0;
+		for (int y = 0; y < view.GetHeight(); y++)
+			for (Uint32 pixel : view.GetRow(y))
+				count += view.GetColor(pixel) == Color(10, 20, 30, 40);
+		EXPECT_EQUAL(count, 16 * 8);
+
+		view.TransformColors([](const Color& c) {
+				return Color(255 - c.r, c.g, c.b, c.a);
+			});
+		EXPECT_TRUE(view.GetColor(view(15, 7)) == Color(245, 20, 30, 40));
+
+		view.Transform([](Uint32 pixel) {
+				return pixel | 0xff000000;
+			});
+		EXPECT_TRUE(view.GetColor(view(0, 0)) == Color(245, 20, 30, 255));
+
+		EXPECT_EXCEPTION(PixelView<SDL_PIXELFORMAT_ABGR8888> wrong(lock), std::invalid_argument);
+	}
+END_TEST()
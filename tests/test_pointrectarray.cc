@@ -0,0 +1,168 @@
+#include <vector>
+
+#include <SDL_main.h>
+
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/PointArray.hh>
+#include <SDL2pp/RectArray.hh>
+
+#include "testing.h"
+
+using namespace SDL2pp;
+
+BEGIN_TEST(int, char*[])
+	// deterministic pseudo-random data covering all cases of
+	// containment and intersection with the test rectangle
+	std::vector<Point> points;
+	std::vector<Rect> rects;
+	for (int i = 0; i < 1000; i++) {
+		points.emplace_back(i * 37 % 200 - 50, i * 53 % 200 - 50);
+		rects.emplace_back(i * 41 % 200 - 50, i * 59 % 200 - 50, i * 7 % 40, i * 11 % 40);
+	}
+
+	const Rect clip(10, 20, 80, 60);
+
+	{
+		// PointArray basic ops
+		PointArray array;
+		EXPECT_TRUE(array.IsEmpty());
+
+		array.Add(Point(1, 2));
+		array.Add(Point(3, 4));
+		EXPECT_EQUAL(array.GetSize(), 2U);
+		EXPECT_EQUAL(array.Get(1), Point(3, 4));
+
+		array.Set(0, Point(5, 6));
+		EXPECT_EQUAL(array.GetX()[0], 5);
+		EXPECT_EQUAL(array.GetY()[0], 6);
+
+		array.Translate(Point(1, -1)).Scale(Point(2, 3));
+		EXPECT_EQUAL(array.Get(0), Point(12, 15));
+		EXPECT_EQUAL(array.Get(1), Point(8, 9));
+
+		array.Clear();
+		EXPECT_TRUE(array.IsEmpty());
+	}
+
+	{
+		// PointArray bulk ops match scalar ones
+		PointArray clipped(points.data(), points.size());
+		clipped.Clip(clip);
+
+		PointArray culled(points.data(), points.size());
+		culled.Cull(clip);
+
+		size_t kept = 0;
+		bool clip_ok = true, cull_ok = true;
+		for (size_t i = 0; i < points.size(); i++) {
+			if (clipped.Get(i) != points[i].GetClamped(clip))
+				clip_ok = false;
+			if (clip.Contains(points[i]) && (kept >= culled.GetSize() || culled.Get(kept++) != points[i]))
+				cull_ok = false;
+		}
+
+		EXPECT_TRUE(clip_ok);
+		EXPECT_TRUE(cull_ok);
+		EXPECT_EQUAL(culled.GetSize(), kept);
+
+		std::vector<Point> aos(culled.GetSize());
+		culled.ToAoS(aos.data());
+		EXPECT_TRUE(aos.empty() || aos.back() == culled.GetAoS()[aos.size() - 1]);
+	}
+
+	{
+		// RectArray basic ops
+		RectArray array;
+		array.Add(Rect(1, 2, 3, 4));
+		EXPECT_EQUAL(array.Get(0), Rect(1, 2, 3, 4));
+
+		array.Translate(Point(1, 1)).Scale(2);
+		EXPECT_EQUAL(array.Get(0), Rect(4, 6, 6, 8));
+		EXPECT_EQUAL(array.GetW()[0], 6);
+		EXPECT_EQUAL(array.GetH()[0], 8);
+	}
+
+	{
+		// RectArray bulk ops match scalar ones
+		RectArray clipped(rects.data(), rects.size());
+		clipped.Clip(clip);
+
+		RectArray culled(rects.data(), rects.size());
+		culled.Cull(clip);
+
+		size_t kept = 0;
+		bool clip_ok = true, cull_ok = true;
+		for (size_t i = 0; i < rects.size(); i++) {
+			Optional<Rect> intersection = rects[i].GetIntersection(clip);
+			if (intersection && intersection->w > 0 && intersection->h > 0 && clipped.Get(i) != *intersection)
+				clip_ok = false;
+			if (!intersection && clipped.Get(i).w != 0 && clipped.Get(i).h != 0)
+				clip_ok = false;
+			if (clip.Intersects(rects[i]) && (kept >= culled.GetSize() || culled.Get(kept++) != rects[i]))
+				cull_ok = false;
+		}
+
+		EXPECT_TRUE(clip_ok);
+		EXPECT_TRUE(cull_ok);
+		EXPECT_EQUAL(culled.GetSize(), kept);
+		EXPECT_EQUAL(culled.GetAoS()[0], culled.Get(0));
+	}
+
+	{
+		// Rect batch tests match scalar ones
+		std::vector<size_t> indices(rects.size());
+		std::vector<Uint64> mask((rects.size() + 63) / 64);
+
+		size_t intersecting = clip.FindIntersecting(rects.data(), rects.size(), indices.data());
+		EXPECT_EQUAL(clip.GetIntersectsMask(rects.data(), rects.size(), mask.data()), intersecting);
+
+		size_t found = 0;
+		bool indices_ok = true, mask_ok = true;
+		for (size_t i = 0; i < rects.size(); i++) {
+			bool expected = clip.Intersects(rects[i]);
+			if (expected && (found >= intersecting || indices[found++] != i))
+				indices_ok = false;
+			if (((mask[i / 64] >> (i % 64)) & 1) != (expected ? 1U : 0U))
+				mask_ok = false;
+		}
+		EXPECT_EQUAL(found, intersecting);
+		EXPECT_TRUE(indices_ok);
+		EXPECT_TRUE(mask_ok);
+
+		size_t contained = clip.FindContained(rects.data(), rects.size(), indices.data());
+		EXPECT_EQUAL(clip.GetContainsMask(rects.data(), rects.size(), mask.data()), contained);
+
+		found = 0;
+		indices_ok = mask_ok = true;
+		for (size_t i = 0; i < rects.size(); i++) {
+			bool expected = clip.Contains(rects[i]);
+			if (expected && (found >= contained || indices[found++] != i))
+				indices_ok = false;
+			if (((mask[i / 64] >> (i % 64)) & 1) != (expected ? 1U : 0U))
+				mask_ok = false;
+		}
+		EXPECT_EQUAL(found, contained);
+		EXPECT_TRUE(indices_ok);
+		EXPECT_TRUE(mask_ok);
+	}
+
+	{
+		// batch line clipping matches scalar one
+		std::vector<Point> lines(points);
+		std::vector<Uint64> mask((lines.size() / 2 + 63) / 64);
+		size_t visible = clip.IntersectLines(lines.data(), lines.size() / 2, mask.data());
+
+		size_t expected_visible = 0;
+		bool lines_ok = true;
+		for (size_t i = 0; i < lines.size() / 2; i++) {
+			Point p1 = points[i * 2], p2 = points[i * 2 + 1];
+			bool expected = clip.IntersectLine(p1, p2);
+			expected_visible += expected;
+			if (((mask[i / 64] >> (i % 64)) & 1) != (expected ? 1U : 0U) || lines[i * 2] != p1 || lines[i * 2 + 1] != p2)
+				lines_ok = false;
+		}
+		EXPECT_EQUAL(visible, expected_visible);
+		EXPECT_TRUE(lines_ok);
+	}
+END_TEST()
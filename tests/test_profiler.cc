@@ -0,0 +1,70 @@
+#include <sstream>
+#include <string>
+
+#include <SDL_main.h>
+
+#include <SDL2pp/Profiler.hh>
+#include <SDL2pp/Surface.hh>
+
+#include "testing.h"
+
+using namespace SDL2pp;
+
+BEGIN_TEST(int, char*[])
+	Profiler::Reset();
+
+	{
+		// Frame without calls
+		Profiler::EndFrame();
+
+		EXPECT_EQUAL(Profiler::GetLastFrame(Profiler::Counter::SurfaceConvert).calls, 0U);
+		EXPECT_EQUAL(Profiler::GetLastFrame(Profiler::Counter::SurfaceBlit).calls, 0U);
+	}
+
+	{
+		// Instrumented library calls
+		Surface surface(0, 16, 16, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+		Surface converted = surface.Convert(SDL_PIXELFORMAT_ABGR8888);
+		converted = converted.Convert(SDL_PIXELFORMAT_ARGB8888);
+		surface.Blit(NullOpt, converted, Rect(0, 0, 16, 16));
+
+		Profiler::EndFrame();
+
+		EXPECT_EQUAL(Profiler::GetLastFrame(Profiler::Counter::SurfaceConvert).calls, 2U);
+		EXPECT_EQUAL(Profiler::GetLastFrame(Profiler::Counter::SurfaceBlit).calls, 1U);
+		EXPECT_EQUAL(Profiler::GetLastFrame(Profiler::Counter::RendererCopy).calls, 0U);
+	}
+
+	{
+		// Counters are reset on frame end
+		Profiler::Record(Profiler::Counter::RendererCopy, 0);
+		Profiler::EndFrame();
+
+		EXPECT_EQUAL(Profiler::GetLastFrame(Profiler::Counter::SurfaceConvert).calls, 0U);
+		EXPECT_EQUAL(Profiler::GetLastFrame(Profiler::Counter::RendererCopy).calls, 1U);
+		EXPECT_EQUAL(Profiler::GetLastFrame(Profiler::Counter::RendererCopy).nanoseconds, 0U);
+	}
+
+	{
+		// Chrome trace
+		std::ostringstream trace;
+		Profiler::WriteChromeTrace(trace);
+
+		std::string json = trace.str();
+		EXPECT_EQUAL(json.substr(0, 40), std::string("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"));
+		EXPECT_TRUE(json.find("\"name\":\"Surface::Convert\",\"ph\":\"C\"") != std::string::npos);
+		EXPECT_TRUE(json.find("\"calls\":2,") != std::string::npos);
+		EXPECT_EQUAL(json.substr(json.size() - 4), std::string("\n]}\n"));
+	}
+
+	{
+		// History limit
+		Profiler::SetMaxFrames(1);
+
+		std::ostringstream trace;
+		Profiler::WriteChromeTrace(trace);
+		EXPECT_TRUE(trace.str().find("\"calls\":2,") == std::string::npos);
+	}
+
+	EXPECT_EQUAL(std::string(Profiler::GetCounterName(Profiler::Counter::FontRender)), "Font::Render");
+END_TEST()
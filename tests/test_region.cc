@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <vector>
+
+#include <SDL_main.h>
+
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Region.hh>
+
+#include "testing.h"
+
+using namespace SDL2pp;
+
+namespace {
+
+// regions are checked against plain bitmaps of this size,
+// with coordinates offset to cover negative ones as well
+const int size = 64;
+const int offset = 16;
+
+typedef std::vector<bool> Bitmap;
+
+int Random(unsigned int& state, int min, int max) {
+	state = state * 1103515245U + 12345U;
+	return min + static_cast<int>((state >> 8) % static_cast<unsigned int>(max - min));
+}
+
+Bitmap ToBitmap(const Rect& rect) {
+	Bitmap bitmap(size * size);
+	for (int y = 0; y < size; y++)
+		for (int x = 0; x < size; x++)
+			bitmap[y * size + x] = rect.w > 0 && rect.h > 0 && rect.Contains(x - offset, y - offset);
+	return bitmap;
+}
+
+Bitmap ToBitmap(const Region& region) {
+	Bitmap bitmap(size * size);
+	for (int y = 0; y < size; y++)
+		for (int x = 0; x < size; x++)
+			bitmap[y * size + x] = region.Contains(Point(x - offset, y - offset));
+	return bitmap;
+}
+
+// checks that rects don't overlap and cover exactly the bitmap
+bool CheckRects(const Region& region, const Bitmap& expected) {
+	Bitmap covered(size * size);
+	for (const Rect& rect : region.GetRects()) {
+		for (int y = rect.y; y <= rect.GetY2(); y++) {
+			for (int x = rect.x; x <= rect.GetX2(); x++) {
+				const size_t pixel = static_cast<size_t>((y + offset) * size + x + offset);
+				if (covered[pixel])
+					return false;
+				covered[pixel] = true;
+			}
+		}
+	}
+	return covered == expected;
+}
+
+}
+
+BEGIN_TEST(int, char*[])
+	{
+		// basic operations
+		Region region;
+		EXPECT_TRUE(region.IsEmpty());
+		EXPECT_EQUAL(region.GetBoundingBox(), Rect(0, 0, 0, 0));
+
+		region.Union(Rect(0, 0, 10, 10));
+		region.Union(Rect(10, 0, 10, 10));
+		EXPECT_EQUAL(region.GetNumRects(), 1U);
+		EXPECT_EQUAL(region.GetRects()[0], Rect(0, 0, 20, 10));
+
+		region.Union(Rect(0, 10, 20, 5));
+		EXPECT_EQUAL(region.GetNumRects(), 1U);
+		EXPECT_EQUAL(region.GetBoundingBox(), Rect(0, 0, 20, 15));
+
+		// scattered damage stays small unlike bounding box
+		region.Union(Rect(100, 100, 5, 5));
+		EXPECT_EQUAL(region.GetNumRects(), 2U);
+		EXPECT_EQUAL(region.GetArea(), 20LL * 15 + 5 * 5);
+		EXPECT_EQUAL(region.GetBoundingBox(), Rect(0, 0, 105, 105));
+
+		region.Subtract(Rect(5, 5, 5, 5));
+		EXPECT_TRUE(!region.Contains(Point(7, 7)));
+		EXPECT_TRUE(region.Contains(Point(4, 7)));
+		EXPECT_TRUE(region.Intersects(Rect(7, 7, 10, 1)));
+		EXPECT_TRUE(!region.Intersects(Rect(5, 5, 5, 5)));
+		EXPECT_TRUE(!region.Intersects(Rect(0, 0, 0, 0)));
+
+		region.Intersect(Rect(0, 0, 50, 50));
+		EXPECT_EQUAL(region.GetArea(), 20LL * 15 - 5 * 5);
+
+		region.Translate(Point(1, 2));
+		EXPECT_EQUAL(region.GetBoundingBox(), Rect(1, 2, 20, 15));
+
+		// empty rects contribute nothing
+		EXPECT_TRUE(Region(Rect(0, 0, 0, 10)).IsEmpty());
+		EXPECT_TRUE(Region(Rect(0, 0, 10, -1)).IsEmpty());
+
+		// representation is canonical
+		Rect rects[] = { Rect(0, 0, 10, 20), Rect(10, 0, 10, 10), Rect(10, 10, 10, 10) };
+		EXPECT_TRUE(Region(rects, 3) == Region(Rect(0, 0, 20, 20)));
+		EXPECT_TRUE(Region(rects, 2) != Region(Rect(0, 0, 20, 20)));
+	}
+
+	{
+		// random operations match bitmaps
+		unsigned int state = 1;
+		bool ok = true, rects_ok = true;
+
+		for (int round = 0; round < 200; round++) {
+			Region region;
+			Bitmap expected(size * size);
+
+			for (int step = 0; step < 12; step++) {
+				Rect rect(Random(state, -offset, size - offset), Random(state, -offset, size - offset), Random(state, -2, 30), Random(state, -2, 30));
+				Bitmap rect_bitmap = ToBitmap(rect);
+				int op = Random(state, 0, 3);
+
+				// rects are clipped to bitmap area
+				rect = Rect(
+						std::max(rect.x, -offset),
+						std::max(rect.y, -offset),
+						std::min(rect.GetX2(), size - offset - 1) - std::max(rect.x, -offset) + 1,
+						std::min(rect.GetY2(), size - offset - 1) - std::max(rect.y, -offset) + 1
+					);
+
+				for (size_t i = 0; i < expected.size(); i++) {
+					if (op == 0)
+						expected[i] = expected[i] || rect_bitmap[i];
+					else if (op == 1)
+						expected[i] = expected[i] && !rect_bitmap[i];
+					else if (step % 4 == 3)
+						expected[i] = expected[i] && rect_bitmap[i];
+				}
+
+				if (op == 0)
+					region.Union(rect);
+				else if (op == 1)
+					region.Subtract(rect);
+				else if (step % 4 == 3)
+					region.Intersect(rect);
+
+				if (ToBitmap(region) != expected)
+					ok = false;
+				if (!CheckRects(region, expected))
+					rects_ok = false;
+			}
+
+			// canonical form: rebuilding from own rects gives same region
+			std::vector<Rect> rects = region.GetRects();
+			if (Region(rects.data(), rects.size()) != region)
+				ok = false;
+		}
+
+		EXPECT_TRUE(ok);
+		EXPECT_TRUE(rects_ok);
+	}
+END_TEST()
@@ -0,0 +1,46 @@
+#include <SDL_main.h>
+
+#include <SDL2pp/Optional.hh>
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/Renderer.hh>
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/Texture.hh>
+
+#include "testing.h"
+
+using namespace SDL2pp;
+
+// This mostly checks that calls which compiled before float
+// overloads were introduced are still not ambiguous
+BEGIN_TEST(int, char*[])
+	Surface target(0, 32, 32, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+	Renderer renderer(target);
+
+	Surface source(0, 4, 4, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+	Texture texture(renderer, source);
+
+	int x = 1, y = 2;
+
+	{
+		// Brace-initialized integer destinations
+		EXPECT_NO_EXCEPTION(renderer.Copy(texture, NullOpt, {x, y}));
+		EXPECT_NO_EXCEPTION(renderer.Copy(texture, NullOpt, {10, 20}));
+		EXPECT_NO_EXCEPTION(renderer.Copy(texture, NullOpt, {x, y}, 30.0));
+		EXPECT_NO_EXCEPTION(renderer.Copy(texture, Rect(0, 0, 2, 2), {x, y}));
+
+		EXPECT_TRUE(static_cast<bool>(renderer.TryCopy(texture, NullOpt, {x, y})));
+		EXPECT_TRUE(static_cast<bool>(renderer.TryCopy(texture, NullOpt, {x, y}, 30.0)));
+	}
+
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+	{
+		// Float destinations
+		EXPECT_NO_EXCEPTION(renderer.CopyF(texture, NullOpt, {1.5f, 2.5f}));
+		EXPECT_NO_EXCEPTION(renderer.CopyF(texture, NullOpt, {1.5f, 2.5f}, 30.0));
+		EXPECT_NO_EXCEPTION(renderer.CopyF(texture, NullOpt, {1.5f, 2.5f, 8.0f, 8.0f}));
+
+		EXPECT_TRUE(static_cast<bool>(renderer.TryCopyF(texture, NullOpt, FPoint(1.5f, 2.5f))));
+	}
+#endif
+END_TEST()
@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <SDL_main.h>
+
+#include <SDL2pp/Point.hh>
+#include <SDL2pp/Rect.hh>
+#include <SDL2pp/SpatialGrid.hh>
+
+#include "testing.h"
+
+using namespace SDL2pp;
+
+namespace {
+
+// deterministic pseudo-random numbers in [min, max)
+int Random(unsigned int& state, int min, int max) {
+	state = state * 1103515245U + 12345U;
+	return min + static_cast<int>((state >> 8) % static_cast<unsigned int>(max - min));
+}
+
+std::vector<size_t> BruteForce(const std::vector<Rect>& rects, const std::vector<bool>& alive, const Rect& query) {
+	std::vector<size_t> result;
+	for (size_t id = 0; id < rects.size(); id++)
+		if (alive[id] && query.Intersects(rects[id]))
+			result.push_back(id);
+	return result;
+}
+
+std::vector<size_t> BruteForce(const std::vector<Rect>& rects, const std::vector<bool>& alive, const Point& query) {
+	std::vector<size_t> result;
+	for (size_t id = 0; id < rects.size(); id++)
+		if (alive[id] && rects[id].Contains(query))
+			result.push_back(id);
+	return result;
+}
+
+}
+
+BEGIN_TEST(int, char*[])
+	{
+		// basic operations
+		SpatialGrid grid(16);
+		EXPECT_EQUAL(grid.GetCellSize(), 16);
+
+		size_t a = grid.Insert(Rect(0, 0, 10, 10));
+		size_t b = grid.Insert(Rect(20, 20, 40, 40));
+		EXPECT_EQUAL(a, 0U);
+		EXPECT_EQUAL(b, 1U);
+		EXPECT_EQUAL(grid.GetNumItems(), 2U);
+		EXPECT_EQUAL(grid.GetRect(b), Rect(20, 20, 40, 40));
+
+		std::vector<size_t> result;
+		EXPECT_EQUAL(grid.Query(Point(5, 5), result), 1U);
+		EXPECT_EQUAL(result[0], a);
+
+		result.clear();
+		EXPECT_EQUAL(grid.Query(Rect(5, 5, 20, 20), result), 2U);
+
+		grid.Move(a, Rect(100, 100, 10, 10));
+		result.clear();
+		EXPECT_EQUAL(grid.Query(Point(5, 5), result), 0U);
+		EXPECT_EQUAL(grid.Query(Point(105, 105), result), 1U);
+
+		grid.Remove(a);
+		EXPECT_EQUAL(grid.GetNumItems(), 1U);
+		EXPECT_EXCEPTION(grid.Remove(a), std::out_of_range);
+		EXPECT_EXCEPTION(grid.GetRect(a), std::out_of_range);
+
+		// removed id is reused
+		EXPECT_EQUAL(grid.Insert(Rect(0, 0, 1, 1)), a);
+
+		grid.Clear();
+		EXPECT_EQUAL(grid.GetNumItems(), 0U);
+		EXPECT_EQUAL(grid.GetNumCells(), 0U);
+
+		EXPECT_EXCEPTION(SpatialGrid(0), std::invalid_argument);
+	}
+
+	{
+		// oversized items are not stored in cells
+		SpatialGrid grid(16);
+		size_t background = grid.Insert(Rect(0, 0, 1000000, 1000000));
+		size_t small = grid.Insert(Rect(10, 10, 4, 4));
+		EXPECT_EQUAL(grid.GetNumCells(), 1U);
+
+		std::vector<size_t> result;
+		EXPECT_EQUAL(grid.Query(Point(12, 12), result), 2U);
+		result.clear();
+		EXPECT_EQUAL(grid.Query(Point(500000, 500000), result), 1U);
+		EXPECT_EQUAL(result[0], background);
+		result.clear();
+		EXPECT_EQUAL(grid.Query(Rect(-10, -10, 5, 5), result), 0U);
+		EXPECT_EQUAL(grid.Query(Rect(999990, 5, 100, 100), result), 1U);
+
+		// moving between large and small
+		grid.Move(background, Rect(100, 100, 4, 4));
+		EXPECT_EQUAL(grid.GetNumCells(), 2U);
+		result.clear();
+		EXPECT_EQUAL(grid.Query(Point(500000, 500000), result), 0U);
+		grid.Move(small, Rect(-1000000, -1000000, 2000000, 2000000));
+		EXPECT_EQUAL(grid.GetNumCells(), 1U);
+		result.clear();
+		EXPECT_EQUAL(grid.Query(Point(-500000, 0), result), 1U);
+		EXPECT_EQUAL(result[0], small);
+
+		grid.Remove(small);
+		result.clear();
+		EXPECT_EQUAL(grid.Query(Point(0, 0), result), 0U);
+		EXPECT_EQUAL(grid.GetNumItems(), 1U);
+	}
+
+	{
+		// random operations match brute force, including negative
+		// coordinates, degenerate rects and rects larger than cells
+		SpatialGrid grid(32);
+		std::vector<Rect> rects;
+		std::vector<bool> alive;
+		unsigned int state = 1;
+
+		bool rect_queries_ok = true, point_queries_ok = true;
+		for (int step = 0; step < 2000; step++) {
+			int op = Random(state, 0, 10);
+			// some items are large enough to be kept out of cells
+			int max_size = Random(state, 0, 8) == 0 ? 600 : 100;
+			Rect rect(Random(state, -300, 300), Random(state, -300, 300), Random(state, -2, max_size), Random(state, -2, max_size));
+
+			if (op < 4 || rects.empty()) {
+				size_t id = grid.Insert(rect);
+				if (id == rects.size()) {
+					rects.push_back(rect);
+					alive.push_back(true);
+				} else {
+					rects[id] = rect;
+					alive[id] = true;
+				}
+			} else if (op < 7) {
+				size_t id = static_cast<size_t>(Random(state, 0, static_cast<int>(rects.size())));
+				if (alive[id]) {
+					grid.Move(id, rect);
+					rects[id] = rect;
+				}
+			} else if (op < 8) {
+				size_t id = static_cast<size_t>(Random(state, 0, static_cast<int>(rects.size())));
+				if (alive[id]) {
+					grid.Remove(id);
+					alive[id] = false;
+				}
+			}
+
+			std::vector<size_t> result;
+			grid.Query(rect, result);
+			std::sort(result.begin(), result.end());
+			if (result != BruteForce(rects, alive, rect))
+				rect_queries_ok = false;
+
+			result.clear();
+			grid.Query(rect.GetTopLeft(), result);
+			std::sort(result.begin(), result.end());
+			if (result != BruteForce(rects, alive, rect.GetTopLeft()))
+				point_queries_ok = false;
+		}
+
+		EXPECT_TRUE(rect_queries_ok);
+		EXPECT_TRUE(point_queries_ok);
+		EXPECT_EQUAL(grid.GetNumItems(), static_cast<size_t>(std::count(alive.begin(), alive.end(), true)));
+	}
+END_TEST()
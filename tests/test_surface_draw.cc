@@ -0,0 +1,227 @@
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <SDL_main.h>
+
+#include <SDL2pp/Surface.hh>
+
+#include "testing.h"
+
+using namespace SDL2pp;
+
+// Surface pixel operations which do not need SDL_image
+BEGIN_TEST(int, char*[])
+	{
+		// Premultiplied alpha
+		Surface surface(0, 4, 1, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+		{
+			Surface::LockHandle lock = surface.Lock();
+			Uint32* pixels = static_cast<Uint32*>(lock.GetPixels());
+			pixels[0] = 0xffc08040;
+			pixels[1] = 0x80ff8000;
+			pixels[2] = 0x00ffffff;
+			pixels[3] = 0x40804020;
+		}
+
+		surface.PremultiplyAlpha();
+		{
+			Surface::LockHandle lock = surface.Lock();
+			Uint32* pixels = static_cast<Uint32*>(lock.GetPixels());
+			EXPECT_EQUAL(pixels[0], 0xffc08040U);
+			EXPECT_EQUAL(pixels[1], 0x80804000U);
+			EXPECT_EQUAL(pixels[2], 0x00000000U);
+			EXPECT_EQUAL(pixels[3], 0x40201008U);
+		}
+
+		surface.UnpremultiplyAlpha();
+		{
+			Surface::LockHandle lock = surface.Lock();
+			Uint32* pixels = static_cast<Uint32*>(lock.GetPixels());
+			EXPECT_EQUAL(pixels[0], 0xffc08040U);
+			EXPECT_EQUAL(pixels[1], 0x80ff8000U);
+			EXPECT_EQUAL(pixels[2], 0x00000000U);
+			EXPECT_EQUAL(pixels[3], 0x40804020U);
+		}
+	}
+
+	{
+		// Resampling
+		Surface surface(0, 8, 4, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+		{
+			Surface::LockHandle lock = surface.Lock();
+			for (int y = 0; y < 4; ++y) {
+				Uint32* row = reinterpret_cast<Uint32*>(static_cast<Uint8*>(lock.GetPixels()) + y * lock.GetPitch());
+				for (int x = 0; x < 8; ++x)
+					row[x] = (x % 2) ? 0xff204060 : 0xff406080;
+			}
+		}
+
+		// box downscaling averages pixels
+		Surface half = surface.Resample(NullOpt, Point(4, 2), Surface::ResampleFilter::Box);
+		EXPECT_EQUAL(half.GetSize(), Point(4, 2));
+		EXPECT_EQUAL(half.GetFormat(), surface.GetFormat());
+		{
+			Surface::LockHandle lock = half.Lock();
+			EXPECT_EQUAL(static_cast<Uint32*>(lock.GetPixels())[0], 0xff305070U);
+		}
+
+		// solid area stays solid with any filter, fully transparent
+		// neighbours do not bleed into opaque pixels
+		surface.FillRect(Rect(0, 0, 4, 4), 0xffc08040);
+		surface.FillRect(Rect(4, 0, 4, 4), 0x00ffffff);
+		for (auto filter : { Surface::ResampleFilter::Box, Surface::ResampleFilter::Bilinear, Surface::ResampleFilter::Lanczos3 }) {
+			Surface scaled = surface.Resample(Rect(0, 0, 8, 4), Point(16, 8), filter);
+			Surface::LockHandle lock = scaled.Lock();
+			EXPECT_EQUAL(static_cast<Uint32*>(lock.GetPixels())[0], 0xffc08040U);
+			EXPECT_EQUAL(static_cast<Uint32*>(lock.GetPixels())[2], 0xffc08040U);
+			EXPECT_EQUAL(static_cast<Uint32*>(lock.GetPixels())[15], 0x00000000U);
+		}
+	}
+
+	{
+		// Drawing primitives, same results for fast and generic paths
+		for (Uint32 format : { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888 }) {
+			int bpp;
+			Uint32 rmask, gmask, bmask, amask;
+			SDL_PixelFormatEnumToMasks(format, &bpp, &rmask, &gmask, &bmask, &amask);
+			Surface surface(0, 32, 32, bpp, rmask, gmask, bmask, amask);
+
+			auto pixel = [&surface](int x, int y) {
+				Surface::LockHandle lock = surface.Lock();
+				Uint32 value;
+				std::memcpy(&value, static_cast<Uint8*>(lock.GetPixels()) + y * lock.GetPitch() + x * 4, sizeof(value));
+				Color color;
+				SDL_GetRGBA(value, &lock.GetFormat(), &color.r, &color.g, &color.b, &color.a);
+				return color;
+			};
+
+			// alpha blended fill
+			surface.FillRect(NullOpt, SDL_MapRGBA(surface.Get()->format, 0, 0, 0, 255));
+			surface.BlendFillRect(Rect(-4, -4, 8, 8), Color(255, 128, 0, 255));
+			surface.BlendFillRects(std::vector<Rect>{ Rect(2, 2, 4, 4) }.data(), 1, Color(0, 0, 255, 128));
+			EXPECT_TRUE(pixel(0, 0) == Color(255, 128, 0, 255));
+			EXPECT_TRUE(pixel(3, 3) == Color(127, 64, 128, 255));
+			EXPECT_TRUE(pixel(5, 5) == Color(0, 0, 128, 255));
+			EXPECT_TRUE(pixel(6, 6) == Color(0, 0, 0, 255));
+
+			// clip rectangle is respected
+			surface.SetClipRect(Rect(0, 0, 16, 32));
+			surface.BlendFillRect(NullOpt, Color(255, 255, 255));
+			surface.SetClipRect();
+			EXPECT_TRUE(pixel(15, 20) == Color(255, 255, 255, 255));
+			EXPECT_TRUE(pixel(16, 20) == Color(0, 0, 0, 255));
+
+			// axis aligned line through pixel centers is solid, and
+			// covers half of endpoint pixels
+			surface.FillRect(NullOpt, SDL_MapRGBA(surface.Get()->format, 0, 0, 0, 255));
+			surface.DrawLine(2.5f, 10.5f, 20.5f, 10.5f, Color(255, 0, 0));
+			EXPECT_TRUE(pixel(2, 10) == Color(128, 0, 0, 255));
+			EXPECT_TRUE(pixel(3, 10) == Color(255, 0, 0, 255));
+			EXPECT_TRUE(pixel(19, 10) == Color(255, 0, 0, 255));
+			EXPECT_TRUE(pixel(20, 10) == Color(128, 0, 0, 255));
+			EXPECT_TRUE(pixel(21, 10) == Color(0, 0, 0, 255));
+			EXPECT_TRUE(pixel(10, 9) == Color(0, 0, 0, 255));
+
+			// line between pixel rows is split between them
+			surface.DrawLine(2.5f, 20.0f, 20.5f, 20.0f, Color(255, 0, 0));
+			EXPECT_TRUE(pixel(10, 19) == Color(128, 0, 0, 255));
+			EXPECT_TRUE(pixel(10, 20) == Color(128, 0, 0, 255));
+
+			// lines are clipped: parts far outside of the surface
+			// change nothing, and visible part is drawn the same
+			surface.FillRect(NullOpt, SDL_MapRGBA(surface.Get()->format, 0, 0, 0, 255));
+			surface.DrawLine(-1e12f, -1e12f, 1e12f, -1e12f, Color(255, 0, 0));
+			surface.DrawLine(-1e12f, 40.5f, 1e12f, 40.5f, Color(255, 0, 0));
+			surface.DrawLine(1e30f, 1e30f, -1e30f, 1e30f, Color(255, 0, 0));
+			EXPECT_TRUE(pixel(0, 31) == Color(0, 0, 0, 255));
+			EXPECT_TRUE(pixel(31, 31) == Color(0, 0, 0, 255));
+
+			surface.DrawLine(-1e12f, 10.5f, 1e12f, 10.5f, Color(255, 0, 0));
+			surface.DrawLine(5.5f, -1e9f, 5.5f, 1e9f, Color(0, 255, 0));
+			EXPECT_TRUE(pixel(0, 10) == Color(255, 0, 0, 255));
+			EXPECT_TRUE(pixel(31, 10) == Color(255, 0, 0, 255));
+			EXPECT_TRUE(pixel(5, 0) == Color(0, 255, 0, 255));
+			EXPECT_TRUE(pixel(5, 31) == Color(0, 255, 0, 255));
+			EXPECT_TRUE(pixel(10, 9) == Color(0, 0, 0, 255));
+
+			surface.FillRect(NullOpt, SDL_MapRGBA(surface.Get()->format, 0, 0, 0, 255));
+			surface.SetClipRect(Rect(8, 8, 16, 16));
+			surface.DrawLine(0.5f, 0.5f, 31.5f, 31.5f, Color(255, 0, 0));
+			surface.SetClipRect();
+			EXPECT_TRUE(pixel(7, 7) == Color(0, 0, 0, 255));
+			EXPECT_TRUE(pixel(8, 8) == Color(255, 0, 0, 255));
+			EXPECT_TRUE(pixel(23, 23) == Color(255, 0, 0, 255));
+			EXPECT_TRUE(pixel(24, 24) == Color(0, 0, 0, 255));
+
+			// filled circle is solid inside and smooth at the edge
+			surface.FillRect(NullOpt, SDL_MapRGBA(surface.Get()->format, 0, 0, 0, 255));
+			surface.FillCircle(16.0f, 16.0f, 8.0f, Color(0, 255, 0));
+			EXPECT_TRUE(pixel(16, 16) == Color(0, 255, 0, 255));
+			EXPECT_TRUE(pixel(16, 9) == Color(0, 255, 0, 255));
+			EXPECT_TRUE(pixel(16, 7) == Color(0, 0, 0, 255));
+			EXPECT_TRUE(pixel(21, 21).g > 0 && pixel(21, 21).g < 255);
+
+			// circles far away or huge are clipped, and non-finite
+			// ones are skipped
+			surface.FillRect(NullOpt, SDL_MapRGBA(surface.Get()->format, 0, 0, 0, 255));
+			surface.FillCircle(1e12f, 1e12f, 8.0f, Color(0, 255, 0));
+			surface.DrawCircle(-1e12f, 16.0f, 8.0f, Color(0, 255, 0));
+			surface.DrawCircle(16.0f, 16.0f, 1e12f, Color(0, 255, 0));
+			surface.FillCircle(16.0f, 16.0f, std::numeric_limits<float>::quiet_NaN(), Color(0, 255, 0));
+			EXPECT_TRUE(pixel(0, 0) == Color(0, 0, 0, 255));
+			EXPECT_TRUE(pixel(16, 16) == Color(0, 0, 0, 255));
+			EXPECT_TRUE(pixel(31, 31) == Color(0, 0, 0, 255));
+
+			surface.FillCircle(16.0f, 16.0f, 1e12f, Color(0, 255, 0));
+			EXPECT_TRUE(pixel(0, 0) == Color(0, 255, 0, 255));
+			EXPECT_TRUE(pixel(31, 31) == Color(0, 255, 0, 255));
+
+			// circle outline leaves interior untouched
+			surface.FillRect(NullOpt, SDL_MapRGBA(surface.Get()->format, 0, 0, 0, 255));
+			surface.DrawCircle(16.0f, 16.0f, 8.0f, Color(0, 255, 0));
+			EXPECT_TRUE(pixel(16, 16) == Color(0, 0, 0, 255));
+			EXPECT_TRUE(pixel(16, 8).g > 0);
+			EXPECT_TRUE(pixel(16, 5) == Color(0, 0, 0, 255));
+
+			// polygons
+			const Point triangle[] = { Point(4, 4), Point(28, 4), Point(4, 28) };
+			surface.FillRect(NullOpt, SDL_MapRGBA(surface.Get()->format, 0, 0, 0, 255));
+			surface.FillPolygon(triangle, 3, Color(0, 0, 255));
+			EXPECT_TRUE(pixel(4, 4) == Color(0, 0, 255, 255));
+			EXPECT_TRUE(pixel(10, 10) == Color(0, 0, 255, 255));
+			EXPECT_TRUE(pixel(3, 10) == Color(0, 0, 0, 255));
+			EXPECT_TRUE(pixel(20, 20) == Color(0, 0, 0, 255));
+
+			surface.FillRect(NullOpt, SDL_MapRGBA(surface.Get()->format, 0, 0, 0, 255));
+			surface.DrawPolygon(triangle, 3, Color(0, 0, 255));
+			EXPECT_TRUE(pixel(4, 10) == Color(0, 0, 255, 255));
+			EXPECT_TRUE(pixel(10, 4) == Color(0, 0, 255, 255));
+			EXPECT_TRUE(pixel(10, 10) == Color(0, 0, 0, 255));
+
+			// polygon with extreme coordinates covers the whole surface
+			const Point huge[] = { Point(-2000000000, -2000000000), Point(2000000000, -2000000000), Point(0, 2000000000) };
+			surface.FillRect(NullOpt, SDL_MapRGBA(surface.Get()->format, 0, 0, 0, 255));
+			surface.FillPolygon(huge, 3, Color(0, 0, 255));
+			EXPECT_TRUE(pixel(0, 0) == Color(0, 0, 255, 255));
+			EXPECT_TRUE(pixel(31, 31) == Color(0, 0, 255, 255));
+
+			// coverage mask, partially outside of the surface
+			const Uint8 mask[] = {
+				255, 128, 255, 0,
+				0,   255, 255, 0,
+			};
+			surface.FillRect(NullOpt, SDL_MapRGBA(surface.Get()->format, 0, 0, 0, 255));
+			surface.BlendMask(Rect(30, 0, 3, 2), mask, 4, Color(255, 0, 0));
+			EXPECT_TRUE(pixel(30, 0) == Color(255, 0, 0, 255));
+			EXPECT_TRUE(pixel(31, 0) == Color(128, 0, 0, 255));
+			EXPECT_TRUE(pixel(30, 1) == Color(0, 0, 0, 255));
+			EXPECT_TRUE(pixel(31, 1) == Color(255, 0, 0, 255));
+
+			// mask coverage is combined with color alpha
+			surface.BlendMask(Rect(0, 0, 2, 1), mask, 4, Color(0, 255, 0, 128));
+			EXPECT_TRUE(pixel(0, 0) == Color(0, 128, 0, 255));
+			EXPECT_TRUE(pixel(1, 0) == Color(0, 64, 0, 255));
+		}
+	}
+END_TEST()
@@ -0,0 +1,96 @@
+#include <stdexcept>
+#include <utility>
+
+#include <SDL_main.h>
+
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/SurfacePool.hh>
+
+#include "testing.h"
+
+using namespace SDL2pp;
+
+BEGIN_TEST(int, char*[])
+	{
+		// Acquire and recycle
+		SurfacePool pool(2);
+
+		EXPECT_EQUAL(pool.GetNumLeased(), 0U);
+		EXPECT_EQUAL(pool.GetNumIdle(), 0U);
+
+		void* pixels;
+		{
+			SurfacePool::Lease lease = pool.Acquire(SDL_PIXELFORMAT_RGB24, 3, 2);
+			EXPECT_TRUE(static_cast<bool>(lease));
+			EXPECT_EQUAL(lease.GetSurface().GetWidth(), 3);
+			EXPECT_EQUAL(lease.GetSurface().GetHeight(), 2);
+			EXPECT_EQUAL(lease.GetSurface().GetFormat(), (Uint32)SDL_PIXELFORMAT_RGB24);
+			EXPECT_EQUAL(lease.GetSurface().Get()->pitch, 12);
+			EXPECT_EQUAL(pool.GetNumLeased(), 1U);
+
+			pixels = lease.GetSurface().Get()->pixels;
+		}
+
+		EXPECT_EQUAL(pool.GetNumLeased(), 0U);
+		EXPECT_EQUAL(pool.GetNumIdle(), 1U);
+
+		{
+			// same class reuses both surface and pixel buffer
+			SurfacePool::Lease lease = pool.Acquire(SDL_PIXELFORMAT_RGB24, 3, 2);
+			EXPECT_TRUE(lease.GetSurface().Get()->pixels == pixels);
+			EXPECT_EQUAL(pool.GetNumIdle(), 0U);
+
+			// different pitch is a different class
+			SurfacePool::Lease padded = pool.Acquire(SDL_PIXELFORMAT_RGB24, 3, 2, 16);
+			EXPECT_EQUAL(padded.GetSurface().Get()->pitch, 16);
+			EXPECT_TRUE(padded.GetSurface().Get()->pixels != pixels);
+
+			// move and early release
+			SurfacePool::Lease moved(std::move(padded));
+			EXPECT_TRUE(!padded);
+			EXPECT_TRUE(static_cast<bool>(moved));
+			moved.Release();
+			EXPECT_TRUE(!moved);
+			EXPECT_EQUAL(pool.GetNumIdle(), 1U);
+		}
+
+		EXPECT_EQUAL(pool.GetHits(), 1UL);
+		EXPECT_EQUAL(pool.GetMisses(), 2UL);
+		EXPECT_EQUAL(pool.GetNumIdle(), 2U);
+
+		// stale surfaces are destroyed
+		pool.NextFrame();
+		pool.NextFrame();
+		EXPECT_EQUAL(pool.GetNumIdle(), 2U);
+		pool.NextFrame();
+		EXPECT_EQUAL(pool.GetNumIdle(), 0U);
+
+		pool.ResetStats();
+		EXPECT_EQUAL(pool.GetHitRate(), 0.0f);
+
+		EXPECT_EXCEPTION(pool.Acquire(SDL_PIXELFORMAT_INDEX8, 3, 2), std::invalid_argument);
+		EXPECT_EXCEPTION(pool.Acquire(SDL_PIXELFORMAT_RGB24, 0, 2), std::invalid_argument);
+		EXPECT_EXCEPTION(pool.Acquire(SDL_PIXELFORMAT_RGB24, 3, 2, 8), std::invalid_argument);
+	}
+
+	{
+		// Pooled conversion
+		SurfacePool pool;
+
+		Surface source(0, 4, 4, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+		source.FillRect(NullOpt, 0x80102030);
+
+		for (int i = 0; i < 3; i++) {
+			SurfacePool::Lease converted = pool.Convert(source, SDL_PIXELFORMAT_ABGR8888);
+			Surface& surface = converted.GetSurface();
+			EXPECT_EQUAL(surface.GetFormat(), (Uint32)SDL_PIXELFORMAT_ABGR8888);
+
+			Surface::LockHandle lock = surface.Lock();
+			EXPECT_EQUAL(static_cast<const Uint32*>(lock.GetPixels())[0], 0x80302010U);
+			EXPECT_EQUAL(static_cast<const Uint32*>(lock.GetPixels())[15], 0x80302010U);
+		}
+
+		EXPECT_EQUAL(pool.GetHits(), 2UL);
+		EXPECT_EQUAL(pool.GetMisses(), 1UL);
+	}
+END_TEST()
@@ -0,0 +1,162 @@
+#include <stdexcept>
+#include <string>
+
+#include <SDL_main.h>
+
+#include <SDL2pp/Font.hh>
+#include <SDL2pp/SDLTTF.hh>
+#include <SDL2pp/Surface.hh>
+#include <SDL2pp/TextLayout.hh>
+
+#include "testing.h"
+
+using namespace SDL2pp;
+
+static bool SameLayout(const TextLayout& a, const TextLayout& b) {
+	if (a.GetLines().size() != b.GetLines().size() || a.GetGlyphs().size() != b.GetGlyphs().size())
+		return false;
+
+	for (size_t i = 0; i < a.GetLines().size(); i++) {
+		const TextLayout::Line& la = a.GetLines()[i];
+		const TextLayout::Line& lb = b.GetLines()[i];
+		if (la.begin != lb.begin || la.end != lb.end || la.first_glyph != lb.first_glyph || la.num_glyphs != lb.num_glyphs || la.width != lb.width)
+			return false;
+	}
+
+	for (size_t i = 0; i < a.GetGlyphs().size(); i++) {
+		const TextLayout::Glyph& ga = a.GetGlyphs()[i];
+		const TextLayout::Glyph& gb = b.GetGlyphs()[i];
+		if (ga.ch != gb.ch || ga.offset != gb.offset || ga.x != gb.x || ga.advance != gb.advance)
+			return false;
+	}
+
+	return true;
+}
+
+BEGIN_TEST(int, char*[])
+	SDLTTF ttf;
+	Font font(TESTDATA_DIR "/Vera.ttf", 30);
+	font.SetKerning(false);
+
+	const int a = font.GetGlyphAdvance(u'A');
+	const int space = font.GetGlyphAdvance(u' ');
+
+	{
+		// Empty text
+		TextLayout layout(font);
+		EXPECT_EQUAL(layout.GetLines().size(), 1U);
+		EXPECT_EQUAL(layout.GetLines()[0].num_glyphs, 0U);
+		EXPECT_EQUAL(layout.GetGlyphs().size(), 0U);
+		EXPECT_EQUAL(layout.GetSize(), Point(0, font.GetHeight()));
+
+		EXPECT_EXCEPTION(TextLayout(font, -1), std::invalid_argument);
+	}
+
+	{
+		// Single line
+		TextLayout layout(font, "AA A");
+		EXPECT_EQUAL(layout.GetLines().size(), 1U);
+		EXPECT_EQUAL(layout.GetGlyphs().size(), 4U);
+		EXPECT_EQUAL(layout.GetGlyphs()[1].x, a);
+		EXPECT_EQUAL(layout.GetGlyphs()[3].x, a * 2 + space);
+		EXPECT_EQUAL(layout.GetLines()[0].width, a * 3 + space);
+	}
+
+	{
+		// Hard line breaks
+		TextLayout layout(font, "A\n\nA\n");
+		EXPECT_EQUAL(layout.GetLines().size(), 4U);
+		EXPECT_EQUAL(layout.GetLines()[1].begin, 2U);
+		EXPECT_EQUAL(layout.GetLines()[1].end, 2U);
+		EXPECT_EQUAL(layout.GetLines()[2].begin, 3U);
+		EXPECT_EQUAL(layout.GetLines()[2].num_glyphs, 2U);
+		EXPECT_EQUAL(layout.GetLines()[3].num_glyphs, 0U);
+		EXPECT_EQUAL(layout.GetSize(), Point(a, font.GetLineSkip() * 3 + font.GetHeight()));
+	}
+
+	{
+		// Wrapping at spaces, trailing spaces do not count
+		TextLayout layout(font, "AA  AA", a * 3);
+		EXPECT_EQUAL(layout.GetLines().size(), 2U);
+		EXPECT_EQUAL(layout.GetLines()[0].end, 2U);
+		EXPECT_EQUAL(layout.GetLines()[0].num_glyphs, 4U);
+		EXPECT_EQUAL(layout.GetLines()[0].width, a * 2);
+		EXPECT_EQUAL(layout.GetLines()[1].begin, 4U);
+		EXPECT_EQUAL(layout.GetGlyphs()[4].x, 0);
+
+		// wrapping after hyphen
+		layout.SetText("AA-AA");
+		EXPECT_EQUAL(layout.GetLines().size(), 2U);
+		EXPECT_EQUAL(layout.GetLines()[1].begin, 3U);
+
+		// long words are broken between glyphs
+		layout.SetText("AAAAAAA");
+		EXPECT_EQUAL(layout.GetLines().size(), 3U);
+		EXPECT_EQUAL(layout.GetLines()[1].begin, 3U);
+		EXPECT_EQUAL(layout.GetLines()[2].begin, 6U);
+
+		// unlimited width
+		layout.SetWidth(0);
+		EXPECT_EQUAL(layout.GetLines().size(), 1U);
+	}
+
+	{
+		// UTF-8
+		TextLayout layout(font, u8"A¼A");
+		EXPECT_EQUAL(layout.GetGlyphs().size(), 3U);
+		EXPECT_EQUAL(layout.GetGlyphs()[1].ch, 0xbcU);
+		EXPECT_EQUAL(layout.GetGlyphs()[2].offset, 3U);
+		EXPECT_EQUAL(layout.GetGlyphs()[2].x, a + font.GetGlyphAdvance(0xbc));
+	}
+
+	{
+		// Incremental layout gives the same result as full one
+		font.SetKerning(true);
+
+		const std::string words[] = { "AVA ", "To", "\n", "long-word ", "AAAAAAAAAAAA", " " };
+
+		TextLayout appended(font, a * 5);
+		TextLayout edited(font, a * 5);
+		std::string text;
+		for (int i = 0; i < 40; i++) {
+			const std::string& word = words[(i * 7) % 6];
+			text += word;
+			appended.Append(word);
+
+			// edit in the middle of the text and back
+			std::string changed = text;
+			changed.insert(text.size() / 2, "A ");
+			edited.SetText(changed);
+			EXPECT_TRUE(SameLayout(edited, TextLayout(font, changed, a * 5)));
+			edited.SetText(text);
+		}
+
+		EXPECT_TRUE(SameLayout(appended, TextLayout(font, text, a * 5)));
+		EXPECT_TRUE(SameLayout(edited, TextLayout(font, text, a * 5)));
+
+		// metrics are cached, and need invalidation
+		font.SetOutline(2);
+		appended.Invalidate();
+		EXPECT_TRUE(SameLayout(appended, TextLayout(font, text, a * 5)));
+		font.SetOutline();
+	}
+
+	{
+		// Rendering
+		Surface surface(0, 200, 200, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+		surface.FillRect(NullOpt, 0xff000000);
+
+		// enough lines to overflow the surface
+		TextLayout layout(font);
+		for (int y = 0; y < 200; y += font.GetLineSkip())
+			layout.Append("AA\n");
+
+		Rect rect = layout.Render(SDL_Color{255, 255, 255, 255}, surface, Point(10, 10));
+		EXPECT_TRUE(rect.x >= 10 && rect.y == 10 && rect.GetY2() == 199);
+
+		// lines outside of clip rectangle are skipped
+		surface.SetClipRect(Rect(0, 100, 200, 20));
+		rect = layout.Render(SDL_Color{255, 255, 255, 255}, surface, Point(10, 10));
+		EXPECT_TRUE(rect.y >= 100 && rect.h > 0 && rect.GetY2() <= 119);
+	}
+END_TEST()
@@ -0,0 +1,106 @@
+#include <SDL_main.h>
+
+#include <SDL2pp/VertexBuffer.hh>
+
+#include "testing.h"
+
+using namespace SDL2pp;
+
+BEGIN_TEST(int, char*[])
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+	{
+		// Empty buffer
+		VertexBuffer buffer;
+
+		EXPECT_TRUE(buffer.IsEmpty());
+		EXPECT_EQUAL(buffer.GetNumVertices(), 0U);
+		EXPECT_EQUAL(buffer.GetNumIndices(), 0U);
+	}
+
+	{
+		// Plain quad
+		VertexBuffer buffer;
+
+		buffer.AddQuad(Rect(10, 20, 30, 40), Color(1, 2, 3, 4));
+
+		EXPECT_TRUE(!buffer.IsEmpty());
+		EXPECT_EQUAL(buffer.GetNumVertices(), 4U);
+		EXPECT_EQUAL(buffer.GetNumIndices(), 6U);
+
+		const SDL_Vertex* v = buffer.GetVertices();
+		EXPECT_EQUAL(v[0].position.x, 10.0f);
+		EXPECT_EQUAL(v[0].position.y, 20.0f);
+		EXPECT_EQUAL(v[2].position.x, 40.0f);
+		EXPECT_EQUAL(v[2].position.y, 60.0f);
+		EXPECT_EQUAL(v[3].position.x, 10.0f);
+		EXPECT_EQUAL(v[3].position.y, 60.0f);
+		EXPECT_EQUAL((int)v[1].color.r, 1);
+		EXPECT_EQUAL((int)v[1].color.a, 4);
+
+		const int* i = buffer.GetIndices();
+		EXPECT_EQUAL(i[0], 0);
+		EXPECT_EQUAL(i[2], 2);
+		EXPECT_EQUAL(i[5], 0);
+	}
+
+	{
+		// Textured quads, indices are offset by preceding vertices
+		VertexBuffer buffer;
+
+		buffer.AddTriangle(FPoint(0.0f, 0.0f), FPoint(1.0f, 0.0f), FPoint(0.0f, 1.0f), Color(0, 0, 0));
+		buffer.AddQuad(FRect(0.5f, 0.5f, 8.0f, 8.0f), Rect(16, 32, 16, 16), Point(64, 64));
+
+		EXPECT_EQUAL(buffer.GetNumVertices(), 7U);
+		EXPECT_EQUAL(buffer.GetNumIndices(), 9U);
+
+		const SDL_Vertex* v = buffer.GetVertices();
+		EXPECT_EQUAL(v[3].position.x, 0.5f);
+		EXPECT_EQUAL(v[3].tex_coord.x, 0.25f);
+		EXPECT_EQUAL(v[3].tex_coord.y, 0.5f);
+		EXPECT_EQUAL(v[5].tex_coord.x, 0.5f);
+		EXPECT_EQUAL(v[5].tex_coord.y, 0.75f);
+		EXPECT_EQUAL((int)v[5].color.g, 255);
+
+		const int* i = buffer.GetIndices();
+		EXPECT_EQUAL(i[2], 2);
+		EXPECT_EQUAL(i[3], 3);
+		EXPECT_EQUAL(i[8], 3);
+	}
+
+	{
+		// Manual vertices and direct allocation
+		VertexBuffer buffer;
+
+		int a = buffer.AddVertex(FPoint(0.0f, 0.0f), Color(0, 0, 0));
+		int b = buffer.AddVertex(FPoint(1.0f, 0.0f), Color(0, 0, 0));
+		SDL_Vertex* c = buffer.AllocVertices(1);
+		*c = SDL_Vertex{ { 1.0f, 1.0f }, { 0, 0, 0, 255 }, { 0.0f, 0.0f } };
+		buffer.AddTriangle(a, b, 2);
+
+		EXPECT_EQUAL(a, 0);
+		EXPECT_EQUAL(b, 1);
+		EXPECT_EQUAL(buffer.GetNumVertices(), 3U);
+		EXPECT_EQUAL(buffer.GetIndices()[1], 1);
+		EXPECT_EQUAL(buffer.GetVertices()[2].position.y, 1.0f);
+	}
+
+	{
+		// Clear keeps memory for reuse
+		VertexBuffer buffer;
+
+		for (int n = 0; n < 100; ++n)
+			buffer.AddQuad(Rect(n, n, 1, 1), Color(0, 0, 0));
+
+		const SDL_Vertex* vertices = buffer.GetVertices();
+		buffer.Clear();
+
+		EXPECT_TRUE(buffer.IsEmpty());
+		EXPECT_EQUAL(buffer.GetNumVertices(), 0U);
+
+		for (int n = 0; n < 100; ++n)
+			buffer.AddQuad(Rect(n, n, 1, 1), Color(0, 0, 0));
+
+		EXPECT_TRUE(buffer.GetVertices() == vertices);
+	}
+#endif
+END_TEST()